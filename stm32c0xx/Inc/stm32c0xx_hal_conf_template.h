@@ -163,6 +163,7 @@ in voltage and temperature.*/
 #define  VDD_VALUE                    (3300UL) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            ((1UL<<__NVIC_PRIO_BITS) - 1UL) /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U
 #define  PREFETCH_ENABLE              1U
 #define  INSTRUCTION_CACHE_ENABLE     1U
 
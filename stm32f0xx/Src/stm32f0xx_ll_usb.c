@@ -826,6 +826,8 @@ HAL_StatusTypeDef USB_DeActivateRemoteWakeup(USB_TypeDef *USBx)
 
 /**
   * @brief Copy a buffer from user memory area to packet memory area (PMA)
+  * @note   Halfword aligned user buffers are copied four halfwords per loop iteration,
+  *         unaligned ones fall back to the byte-wise copy.
   * @param   USBx USB peripheral instance register address.
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
@@ -840,27 +842,55 @@ void USB_WritePMA(USB_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAd
   uint16_t WrVal;
   __IO uint16_t *pdwVal;
   uint8_t *pBuf = pbUsrBuf;
+  const uint16_t *pBuf16;
 
   pdwVal = (__IO uint16_t *)(BaseAddr + 0x400U + ((uint32_t)wPMABufAddr * PMA_ACCESS));
 
-  for (count = n; count != 0U; count--)
+  if (((uint32_t)pBuf & 0x1U) == 0U)
   {
-    WrVal = pBuf[0];
-    WrVal |= (uint16_t)pBuf[1] << 8;
-    *pdwVal = (WrVal & 0xFFFFU);
-    pdwVal++;
+    /* Halfword aligned buffer: unrolled halfword copies */
+    pBuf16 = (const uint16_t *)(void *)pBuf;
+
+    for (count = n >> 2U; count != 0U; count--)
+    {
+      pdwVal[0] = pBuf16[0];
+      pdwVal[PMA_ACCESS] = pBuf16[1];
+      pdwVal[2U * PMA_ACCESS] = pBuf16[2];
+      pdwVal[3U * PMA_ACCESS] = pBuf16[3];
+      pdwVal = &pdwVal[4U * PMA_ACCESS];
+      pBuf16 = &pBuf16[4];
+    }
+
+    for (count = n & 0x3U; count != 0U; count--)
+    {
+      *pdwVal = *pBuf16;
+      pdwVal = &pdwVal[PMA_ACCESS];
+      pBuf16++;
+    }
+  }
+  else
+  {
+    for (count = n; count != 0U; count--)
+    {
+      WrVal = pBuf[0];
+      WrVal |= (uint16_t)pBuf[1] << 8;
+      *pdwVal = (WrVal & 0xFFFFU);
+      pdwVal++;
 
 #if PMA_ACCESS > 1U
-    pdwVal++;
+      pdwVal++;
 #endif /* PMA_ACCESS */
 
-    pBuf++;
-    pBuf++;
+      pBuf++;
+      pBuf++;
+    }
   }
 }
 
 /**
   * @brief Copy data from packet memory area (PMA) to user memory buffer
+  * @note   Halfword aligned user buffers are copied four halfwords per loop iteration,
+  *         unaligned ones fall back to the byte-wise copy.
   * @param   USBx USB peripheral instance register address.
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
@@ -875,21 +905,49 @@ void USB_ReadPMA(USB_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABufAdd
   uint32_t RdVal;
   __IO uint16_t *pdwVal;
   uint8_t *pBuf = pbUsrBuf;
+  uint16_t *pBuf16;
 
   pdwVal = (__IO uint16_t *)(BaseAddr + 0x400U + ((uint32_t)wPMABufAddr * PMA_ACCESS));
 
-  for (count = n; count != 0U; count--)
+  if (((uint32_t)pBuf & 0x1U) == 0U)
   {
-    RdVal = *(__IO uint16_t *)pdwVal;
-    pdwVal++;
-    *pBuf = (uint8_t)((RdVal >> 0) & 0xFFU);
-    pBuf++;
-    *pBuf = (uint8_t)((RdVal >> 8) & 0xFFU);
-    pBuf++;
+    /* Halfword aligned buffer: unrolled halfword copies */
+    pBuf16 = (uint16_t *)(void *)pBuf;
+
+    for (count = n >> 2U; count != 0U; count--)
+    {
+      pBuf16[0] = pdwVal[0];
+      pBuf16[1] = pdwVal[PMA_ACCESS];
+      pBuf16[2] = pdwVal[2U * PMA_ACCESS];
+      pBuf16[3] = pdwVal[3U * PMA_ACCESS];
+      pdwVal = &pdwVal[4U * PMA_ACCESS];
+      pBuf16 = &pBuf16[4];
+    }
+
+    for (count = n & 0x3U; count != 0U; count--)
+    {
+      *pBuf16 = *pdwVal;
+      pdwVal = &pdwVal[PMA_ACCESS];
+      pBuf16++;
+    }
+
+    pBuf = (uint8_t *)(void *)pBuf16;
+  }
+  else
+  {
+    for (count = n; count != 0U; count--)
+    {
+      RdVal = *(__IO uint16_t *)pdwVal;
+      pdwVal++;
+      *pBuf = (uint8_t)((RdVal >> 0) & 0xFFU);
+      pBuf++;
+      *pBuf = (uint8_t)((RdVal >> 8) & 0xFFU);
+      pBuf++;
 
 #if PMA_ACCESS > 1U
-    pdwVal++;
+      pdwVal++;
 #endif /* PMA_ACCESS */
+    }
   }
 
   if ((wNBytes % 2U) != 0U)
@@ -133,6 +133,7 @@
 #define  VDD_VALUE                      3300U /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY              0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                          0U
+#define  USE_HAL_ATOMIC_LOCK               0U
 #define  PREFETCH_ENABLE                   1U
 #define  INSTRUCTION_CACHE_ENABLE          1U
 #define  DATA_CACHE_ENABLE                 1U
@@ -88,6 +88,84 @@ typedef enum
 
 #if (USE_RTOS == 1U)
   #error " USE_RTOS should be 0 in the current HAL release "
+#elif defined(USE_HAL_ATOMIC_LOCK) && (USE_HAL_ATOMIC_LOCK == 1U)
+/**
+  * @brief  Take the lock of a handle atomically.
+  * @note   The lock is taken with exclusive accesses, or with interrupts masked on cores
+  *         without exclusive access instructions, so that a handle can be shared between
+  *         thread and interrupt contexts without a global critical section.
+  * @param  pLock Pointer to the Lock field of the handle.
+  * @retval HAL_OK if the lock has been taken, HAL_BUSY if it was already taken
+  */
+__STATIC_INLINE HAL_StatusTypeDef HAL_AtomicLock(__IO HAL_LockTypeDef *pLock)
+{
+  HAL_StatusTypeDef status = HAL_BUSY;
+#if (__CORTEX_M == 0U)
+  uint32_t primask = __get_PRIMASK();
+
+  __disable_irq();
+  if (*pLock == HAL_UNLOCKED)
+  {
+    *pLock = HAL_LOCKED;
+    status = HAL_OK;
+  }
+  __set_PRIMASK(primask);
+#else
+  /* The lock value is held by the lowest byte whatever the size of the enumeration */
+  __IO uint8_t *plock = (__IO uint8_t *)pLock;
+  uint32_t retry;
+
+  do
+  {
+    retry = 0U;
+    if (__LDREXB(plock) == (uint8_t)HAL_UNLOCKED)
+    {
+      /* The store fails when the exclusive access has been lost, e.g. on an interrupt */
+      retry = __STREXB((uint8_t)HAL_LOCKED, plock);
+      if (retry == 0U)
+      {
+        status = HAL_OK;
+      }
+    }
+    else
+    {
+      __CLREX();
+    }
+  } while (retry != 0U);
+
+  /* Accesses to the handle are not performed before the lock is taken */
+  __DMB();
+#endif /* __CORTEX_M */
+
+  return status;
+}
+
+/**
+  * @brief  Release the lock of a handle taken with HAL_AtomicLock().
+  * @param  pLock Pointer to the Lock field of the handle.
+  * @retval None
+  */
+__STATIC_INLINE void HAL_AtomicUnlock(__IO HAL_LockTypeDef *pLock)
+{
+#if (__CORTEX_M != 0U)
+  /* Complete the accesses to the handle before releasing the lock */
+  __DMB();
+#endif /* __CORTEX_M */
+  *pLock = HAL_UNLOCKED;
+}
+
+  #define __HAL_LOCK(__HANDLE__)                                           \
+                                do{                                        \
+                                    if(HAL_AtomicLock(&(__HANDLE__)->Lock) != HAL_OK) \
+                                    {                                      \
+                                       return HAL_BUSY;                    \
+                                    }                                      \
+                                  }while (0)
+
+  #define __HAL_UNLOCK(__HANDLE__)                                          \
+                                  do{                                       \
+                                      HAL_AtomicUnlock(&(__HANDLE__)->Lock); \
+                                    }while (0)
 #else
   #define __HAL_LOCK(__HANDLE__)                                           \
                                 do{                                        \
@@ -154,6 +154,36 @@ typedef uint32_t HAL_UART_RxTypeTypeDef;
   */
 typedef uint32_t HAL_UART_RxEventTypeTypeDef;
 
+/**
+  * @brief  UART Tx queue buffer descriptor definition
+  */
+typedef struct
+{
+  const uint8_t            *pData;                   /*!< Data to send (u8 or u16 data elements)         */
+
+  uint16_t                 Size;                     /*!< Amount of data elements to send                */
+
+  void                     *pContext;                /*!< Application cookie given back on completion    */
+} UART_TxBufferTypeDef;
+
+/**
+  * @brief  UART Tx queue structure definition
+  * @note   Buffers are sent in the order they are enqueued; the counters are free running and
+  *         the descriptor of a buffer is at index (count % BufferNumber) of the array.
+  */
+typedef struct
+{
+  UART_TxBufferTypeDef     *pBuffers;                /*!< Array of buffer descriptors                    */
+
+  uint32_t                 BufferNumber;             /*!< Number of descriptors of the array             */
+
+  __IO uint32_t            PutCount;                 /*!< Number of buffers enqueued                     */
+
+  __IO uint32_t            GetCount;                 /*!< Number of buffers sent                         */
+
+  __IO uint32_t            Active;                   /*!< Set while a queued buffer is being sent        */
+} UART_TxQueueTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -183,6 +213,8 @@ typedef struct __UART_HandleTypeDef
 
   DMA_HandleTypeDef             *hdmarx;          /*!< UART Rx DMA Handle parameters      */
 
+  UART_TxQueueTypeDef           *pTxQueue;        /*!< UART Tx queue, NULL if not used    */
+
   HAL_LockTypeDef               Lock;             /*!< Locking object                     */
 
   __IO HAL_UART_StateTypeDef    gState;           /*!< UART state information related to global Handle management
@@ -205,6 +237,8 @@ typedef struct __UART_HandleTypeDef
   void (* AbortReceiveCpltCallback)(struct __UART_HandleTypeDef *huart);  /*!< UART Abort Receive Complete Callback  */
   void (* WakeupCallback)(struct __UART_HandleTypeDef *huart);            /*!< UART Wakeup Callback                  */
   void (* RxEventCallback)(struct __UART_HandleTypeDef *huart, uint16_t Pos); /*!< UART Reception Event Callback     */
+  void (* TxBufferCpltCallback)(struct __UART_HandleTypeDef *huart, void *pContext); /*!< UART Tx Queue Buffer
+                                                                                         Complete Callback   */
 
   void (* MspInitCallback)(struct __UART_HandleTypeDef *huart);           /*!< UART Msp Init callback                */
   void (* MspDeInitCallback)(struct __UART_HandleTypeDef *huart);         /*!< UART Msp DeInit callback              */
@@ -238,6 +272,7 @@ typedef enum
   */
 typedef  void (*pUART_CallbackTypeDef)(UART_HandleTypeDef *huart);  /*!< pointer to an UART callback function */
 typedef  void (*pUART_RxEventCallbackTypeDef)(struct __UART_HandleTypeDef *huart, uint16_t Pos);   /*!< pointer to a UART Rx Event specific callback function */
+typedef  void (*pUART_TxBufferCpltCallbackTypeDef)(struct __UART_HandleTypeDef *huart, void *pContext); /*!< pointer to a UART Tx Queue Buffer Complete specific callback function */
 
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
@@ -731,6 +766,10 @@ HAL_StatusTypeDef HAL_UART_UnRegisterCallback(UART_HandleTypeDef *huart, HAL_UAR
 
 HAL_StatusTypeDef HAL_UART_RegisterRxEventCallback(UART_HandleTypeDef *huart, pUART_RxEventCallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart);
+
+HAL_StatusTypeDef HAL_UART_RegisterTxBufferCpltCallback(UART_HandleTypeDef *huart,
+                                                        pUART_TxBufferCpltCallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_UART_UnRegisterTxBufferCpltCallback(UART_HandleTypeDef *huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -759,6 +798,12 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
 
 HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart);
 
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Init(UART_HandleTypeDef *huart, UART_TxQueueTypeDef *pQueue,
+                                          UART_TxBufferTypeDef *pBuffers, uint32_t BufferNumber);
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_DeInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Enqueue(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                             void *pContext);
+
 /* Transfer Abort functions */
 HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef HAL_UART_AbortTransmit(UART_HandleTypeDef *huart);
@@ -778,6 +823,7 @@ void HAL_UART_AbortTransmitCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_AbortReceiveCpltCallback(UART_HandleTypeDef *huart);
 
 void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+void HAL_UARTEx_TxBufferCpltCallback(UART_HandleTypeDef *huart, void *pContext);
 
 /**
   * @}
@@ -888,6 +934,7 @@ uint32_t              HAL_UART_GetError(const UART_HandleTypeDef *huart);
 
 HAL_StatusTypeDef UART_Start_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef UART_TxQueueStart(UART_HandleTypeDef *huart);
 
 /**
   * @}
@@ -119,6 +119,8 @@
     [..]
     For specific callback RxEventCallback, use dedicated registration/reset functions:
     respectively HAL_UART_RegisterRxEventCallback() , HAL_UART_UnRegisterRxEventCallback().
+    For specific callback TxBufferCpltCallback, use dedicated registration/reset functions:
+    respectively HAL_UART_RegisterTxBufferCpltCallback() , HAL_UART_UnRegisterTxBufferCpltCallback().
 
     [..]
     By default, after the HAL_UART_Init() and when the state is HAL_UART_STATE_RESET
@@ -217,6 +219,15 @@
     (#) Non-Blocking mode API with DMA:
         (+) HAL_UARTEx_ReceiveToIdle_DMA()
 
+    (#) Queued transmission API with DMA:
+        (+) HAL_UARTEx_TxQueue_Init()
+        (+) HAL_UARTEx_TxQueue_DeInit()
+        (+) HAL_UARTEx_TxQueue_Enqueue()
+        Enqueued buffers are sent back to back: the Tx DMA is restarted on the next buffer from
+        the DMA Transfer Complete interrupt, while the last data of the previous buffer is still
+        being shifted out. HAL_UARTEx_TxBufferCpltCallback() is executed for each buffer once read
+        by the DMA, HAL_UART_TxCpltCallback() once the queue is empty and the line is idle.
+
 
      *** UART HAL driver macros list ***
      =============================================
@@ -288,6 +299,7 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart);
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef UART_TxQueueNext(UART_HandleTypeDef *huart);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
@@ -383,6 +395,9 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue attached */
+    huart->pTxQueue = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -450,6 +465,9 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue attached */
+    huart->pTxQueue = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -527,6 +545,9 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue attached */
+    huart->pTxQueue = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -610,6 +631,9 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue attached */
+    huart->pTxQueue = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -1034,6 +1058,64 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
   __HAL_UNLOCK(huart);
   return status;
 }
+
+/**
+  * @brief  Register a User UART Tx Queue Buffer Complete Callback
+  *         To be used instead of the weak predefined callback
+  * @param  huart     Uart handle
+  * @param  pCallback Pointer to the Tx Queue Buffer Complete Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_RegisterTxBufferCpltCallback(UART_HandleTypeDef *huart,
+                                                        pUART_TxBufferCpltCallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    return HAL_ERROR;
+  }
+
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    huart->TxBufferCpltCallback = pCallback;
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  UnRegister the UART Tx Queue Buffer Complete Callback
+  *         UART Tx Queue Buffer Complete Callback is redirected to the weak HAL_UARTEx_TxBufferCpltCallback()
+  *         predefined callback
+  * @param  huart     Uart handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_UnRegisterTxBufferCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    huart->TxBufferCpltCallback = HAL_UARTEx_TxBufferCpltCallback; /* Legacy weak UART Tx Buffer Complete Callback */
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -1102,6 +1184,9 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
     (#) A Rx Event Reception Callback (Rx event notification) is available for Non_Blocking modes of enhanced reception services:
         (+) HAL_UARTEx_RxEventCallback()
 
+    (#) A Tx buffer completion Callback is available for the queued transmission services:
+        (+) HAL_UARTEx_TxBufferCpltCallback()
+
     (#) In Non-Blocking mode transfers, possible errors are split into 2 categories.
         Errors are handled as follows :
        (+) Error is considered as Recoverable and non blocking : Transfer could go till end, but error severity is
@@ -1849,6 +1934,120 @@ HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(UART_HandleTypeDef *huart)
   return(huart->RxEventType);
 }
 
+/**
+  * @brief  Attach a Tx queue to the UART.
+  * @note   The Tx DMA channel must be configured in normal mode. While the queue is attached,
+  *         DMA transmissions must only be requested through HAL_UARTEx_TxQueue_Enqueue().
+  * @param  huart        UART handle.
+  * @param  pQueue       Pointer to the queue structure, owned by the caller while attached.
+  * @param  pBuffers     Pointer to the array of buffer descriptors used by the queue.
+  * @param  BufferNumber Number of descriptors of the array.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Init(UART_HandleTypeDef *huart, UART_TxQueueTypeDef *pQueue,
+                                          UART_TxBufferTypeDef *pBuffers, uint32_t BufferNumber)
+{
+  /* Check that a Tx process is not already ongoing */
+  if (huart->gState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pQueue == NULL) || (pBuffers == NULL) || (BufferNumber == 0U) || (huart->hdmatx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Buffers are chained on the DMA Transfer Complete event */
+  if (huart->hdmatx->Init.Mode == DMA_CIRCULAR)
+  {
+    return HAL_ERROR;
+  }
+
+  pQueue->pBuffers     = pBuffers;
+  pQueue->BufferNumber = BufferNumber;
+  pQueue->PutCount     = 0U;
+  pQueue->GetCount     = 0U;
+  pQueue->Active       = 0U;
+
+  huart->pTxQueue = pQueue;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the Tx queue from the UART.
+  * @note   The ongoing transmission is aborted and the buffers not yet sent are dropped
+  *         without completion callback.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_DeInit(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status;
+
+  if (huart->pTxQueue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HAL_UART_AbortTransmit(huart);
+
+  huart->pTxQueue = NULL;
+
+  return status;
+}
+
+/**
+  * @brief  Add a buffer to the Tx queue.
+  * @note   The buffer is sent right away when the UART is idle, otherwise the DMA is restarted
+  *         on it as soon as the previous buffers have been read, without idle time on the line.
+  * @note   HAL_UARTEx_TxBufferCpltCallback() is executed with pContext once the buffer has been
+  *         read by the DMA; the buffer must not be modified before.
+  * @note   This function can be called from thread and interrupt contexts.
+  * @param  huart    UART handle.
+  * @param  pData    Pointer to data buffer (u8 or u16 data elements).
+  * @param  Size     Amount of data elements (u8 or u16) to be sent.
+  * @param  pContext Application cookie given back on completion.
+  * @retval HAL status (HAL_BUSY when the queue is full)
+  */
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Enqueue(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                             void *pContext)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  UART_TxBufferTypeDef *pbuffer;
+  HAL_StatusTypeDef status = HAL_BUSY;
+  uint32_t primask;
+
+  if ((pqueue == NULL) || (pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((pqueue->PutCount - pqueue->GetCount) < pqueue->BufferNumber)
+  {
+    pbuffer = &pqueue->pBuffers[pqueue->PutCount % pqueue->BufferNumber];
+    pbuffer->pData    = pData;
+    pbuffer->Size     = Size;
+    pbuffer->pContext = pContext;
+    pqueue->PutCount++;
+
+    /* Start the transmission if the UART is idle */
+    status = UART_TxQueueStart(huart);
+    if (status != HAL_OK)
+    {
+      pqueue->PutCount--;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
 /**
   * @brief  Abort ongoing transfers (blocking mode).
   * @param  huart UART handle.
@@ -2748,6 +2947,26 @@ __weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
    */
 }
 
+/**
+  * @brief  Tx queue buffer completion callback.
+  * @note   Called once the DMA has read all the data of a buffer enqueued with
+  *         HAL_UARTEx_TxQueue_Enqueue(): the buffer can be reused, while its last data may
+  *         still be in transmission.
+  * @param  huart    UART handle.
+  * @param  pContext Application cookie given with the buffer.
+  * @retval None
+  */
+__weak void HAL_UARTEx_TxBufferCpltCallback(UART_HandleTypeDef *huart, void *pContext)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(pContext);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_TxBufferCpltCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -3002,6 +3221,7 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart)
   huart->AbortTransmitCpltCallback = HAL_UART_AbortTransmitCpltCallback; /* Legacy weak AbortTransmitCpltCallback */
   huart->AbortReceiveCpltCallback  = HAL_UART_AbortReceiveCpltCallback;  /* Legacy weak AbortReceiveCpltCallback  */
   huart->RxEventCallback           = HAL_UARTEx_RxEventCallback;         /* Legacy weak RxEventCallback           */
+  huart->TxBufferCpltCallback      = HAL_UARTEx_TxBufferCpltCallback;    /* Legacy weak TxBufferCpltCallback      */
 
 }
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
@@ -3020,13 +3240,16 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   {
     huart->TxXferCount = 0x00U;
 
-    /* Disable the DMA transfer for transmit request by setting the DMAT bit
-       in the UART CR3 register */
-    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
-
-    /* Enable the UART Transmit Complete Interrupt */
-    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+    /* Chain the next buffer of the Tx queue, if any */
+    if (UART_TxQueueNext(huart) != HAL_OK)
+    {
+      /* Disable the DMA transfer for transmit request by setting the DMAT bit
+         in the UART CR3 register */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
+      /* Enable the UART Transmit Complete Interrupt */
+      ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+    }
   }
   /* DMA Circular mode */
   else
@@ -3348,6 +3571,83 @@ HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pDa
   return HAL_OK;
 }
 
+/**
+  * @brief  Start the transmission of the next buffer of the UART Tx queue.
+  * @note   Nothing is done when a Tx process is ongoing or when the queue is empty.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UART_TxQueueStart(UART_HandleTypeDef *huart)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  const UART_TxBufferTypeDef *pbuffer;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  /* Buffers may be enqueued from interrupts of any priority */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((huart->gState == HAL_UART_STATE_READY) && (pqueue->PutCount != pqueue->GetCount))
+  {
+    pbuffer = &pqueue->pBuffers[pqueue->GetCount % pqueue->BufferNumber];
+
+    pqueue->Active = 1U;
+    status = HAL_UART_Transmit_DMA(huart, pbuffer->pData, pbuffer->Size);
+    if (status != HAL_OK)
+    {
+      pqueue->Active = 0U;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Release the buffer of the UART Tx queue read by the DMA and chain the next one.
+  * @note   The next buffer is started while the last data of the previous one is still
+  *         being shifted out, so that no idle time is inserted between queued buffers.
+  * @param  huart UART handle.
+  * @retval HAL_OK when the next buffer is being sent, HAL_ERROR otherwise
+  */
+static HAL_StatusTypeDef UART_TxQueueNext(UART_HandleTypeDef *huart)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  HAL_StatusTypeDef status = HAL_ERROR;
+  void *pcontext;
+
+  if ((pqueue != NULL) && (pqueue->Active != 0U))
+  {
+    pcontext = pqueue->pBuffers[pqueue->GetCount % pqueue->BufferNumber].pContext;
+    pqueue->GetCount++;
+    pqueue->Active = 0U;
+
+    huart->gState = HAL_UART_STATE_READY;
+    if ((UART_TxQueueStart(huart) == HAL_OK) && (pqueue->Active != 0U))
+    {
+      status = HAL_OK;
+    }
+    else
+    {
+      /* No buffer left: end the transmission on the UART Transmit Complete event */
+      huart->gState = HAL_UART_STATE_BUSY_TX;
+    }
+
+    /* The buffer has been read by the DMA and can be reused by the application */
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+    /* Call registered Tx Buffer Complete Callback */
+    huart->TxBufferCpltCallback(huart, pcontext);
+#else
+    /* Call legacy weak Tx Buffer Complete Callback */
+    HAL_UARTEx_TxBufferCpltCallback(huart, pcontext);
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+  }
+
+  return status;
+}
+
 /**
   * @brief  End ongoing Tx transfer on UART peripheral (following error detection or Transmit completion).
   * @param  huart UART handle.
@@ -3616,6 +3916,12 @@ static HAL_StatusTypeDef UART_EndTransmit_IT(UART_HandleTypeDef *huart)
   HAL_UART_TxCpltCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
+  /* Start the buffers enqueued while the previous transmission was ending */
+  if (huart->pTxQueue != NULL)
+  {
+    (void)UART_TxQueueStart(huart);
+  }
+
   return HAL_OK;
 }
 
@@ -146,8 +146,12 @@
 #define  VDD_VALUE                    3300U /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            0x0FU /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U
 #define  PREFETCH_ENABLE              1U /* To enable prefetch */
 #define  ART_ACCELERATOR_ENABLE       1U /* To enable ART Accelerator */
+#define  USE_HAL_DMA_DCACHE_MAINTENANCE 0U /* To enable D-cache maintenance in the DMA based APIs */
+#define  HAL_DMA_BOUNCE_BUFFER_NBR    2U /* Number of bounce buffers for unaligned DMA receptions */
+#define  HAL_DMA_BOUNCE_BUFFER_SIZE   256U /* Size in bytes of a bounce buffer, multiple of 32 */
 
 #define  USE_HAL_ADC_REGISTER_CALLBACKS         0U /* ADC register callback disabled       */
 #define  USE_HAL_CAN_REGISTER_CALLBACKS         0U /* CAN register callback disabled       */
@@ -94,9 +94,27 @@
 
 /* Private types -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U) && defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+/** @defgroup CORTEX_Private_Variables CORTEX Private Variables
+  * @{
+  */
+/* Bounce buffers of the DMA receptions whose buffer is not aligned on the data cache lines */
+static ALIGN_32BYTES(uint8_t CORTEX_BounceBuffer[HAL_DMA_BOUNCE_BUFFER_NBR][HAL_DMA_BOUNCE_BUFFER_SIZE]);
+/* Owner (peripheral handle) of each bounce buffer, NULL when the bounce buffer is free */
+static const void *CORTEX_BounceOwner[HAL_DMA_BOUNCE_BUFFER_NBR];
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE && __DCACHE_PRESENT */
 /* Private constants ---------------------------------------------------------*/
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+#define CORTEX_DCACHE_LINE_SIZE  32U   /* Cortex-M7 data cache line size in bytes */
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 /* Private macros ------------------------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U) && defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+static void CORTEX_InvalidateDCacheRange(const void *pBuffer, uint32_t Size);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE && __DCACHE_PRESENT */
 /* Exported functions --------------------------------------------------------*/
 
 /** @defgroup CORTEX_Exported_Functions CORTEX Exported Functions
@@ -514,9 +532,237 @@ __weak void HAL_SYSTICK_Callback(void)
   * @}
   */
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+/** @defgroup CORTEX_Exported_Functions_Group3 DMA data cache maintenance functions
+ *  @brief   DMA data cache maintenance functions
+ *
+@verbatim
+  ==============================================================================
+                ##### DMA data cache maintenance functions #####
+  ==============================================================================
+    [..]
+      This subsection provides a set of functions keeping the DMA buffers coherent
+      with the data cache. They are called by the HAL DMA based APIs when
+      USE_HAL_DMA_DCACHE_MAINTENANCE is set to 1U in the HAL configuration file,
+      and can also be used by the application for its own DMA transfers.
+      (+) HAL_DCACHE_CleanForDMA() writes back the cache lines of a buffer before
+          it is read by a DMA.
+      (+) HAL_DCACHE_PrepareRxDMA() invalidates the cache lines of a buffer before
+          it is written by a DMA. A buffer whose address or size is not a multiple
+          of the 32-byte cache line shares lines with other data: the DMA then
+          writes into a bounce buffer taken from a pool of HAL_DMA_BOUNCE_BUFFER_NBR
+          buffers of HAL_DMA_BOUNCE_BUFFER_SIZE bytes.
+      (+) HAL_DCACHE_SyncRxDMA() makes the data written by the DMA visible to the
+          CPU, copying it from the bounce buffer when one is used.
+      (+) HAL_DCACHE_ReleaseRxDMA() returns the bounce buffer to the pool.
+    [..]
+      Each peripheral handle owns at most one bounce buffer, which it reuses for
+      its next reception when the previous one was aborted.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Clean the data cache lines of a buffer before a DMA reads it.
+  * @param  pBuffer Pointer to the buffer.
+  * @param  Size Size of the buffer in bytes.
+  * @retval None
+  */
+void HAL_DCACHE_CleanForDMA(const void *pBuffer, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t start;
+  uint32_t end;
+
+  if ((Size != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    /* Cleaning the partial lines around the buffer only writes back their data */
+    start = ((uint32_t)pBuffer & ~(CORTEX_DCACHE_LINE_SIZE - 1U));
+    end = (((uint32_t)pBuffer + Size + CORTEX_DCACHE_LINE_SIZE - 1U) & ~(CORTEX_DCACHE_LINE_SIZE - 1U));
+    SCB_CleanDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+  }
+#else
+  UNUSED(pBuffer);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Prepare a buffer to be written by a DMA.
+  * @note   The buffer lines are invalidated so that no eviction overwrites the
+  *         received data. When the buffer is not aligned on the data cache lines,
+  *         the DMA must be programmed with the bounce buffer returned in
+  *         ppDmaBuffer, or an error is returned if ppDmaBuffer is NULL.
+  * @param  pOwner Pointer to the handle of the peripheral owning the reception.
+  * @param  pBuffer Pointer to the reception buffer.
+  * @param  Size Size of the reception buffer in bytes.
+  * @param  ppDmaBuffer Pointer to the address to program in the DMA, or NULL
+  *         when no bounce buffer can be used (circular transfers).
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_DCACHE_PrepareRxDMA(const void *pOwner, uint8_t *pBuffer, uint32_t Size,
+                                          uint8_t **ppDmaBuffer)
+{
+  uint8_t *pDmaBuffer = pBuffer;
+  HAL_StatusTypeDef status = HAL_OK;
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t index = 0U;
+  uint32_t primask;
+
+  /* Release the bounce buffer of a previous reception of the same owner */
+  HAL_DCACHE_ReleaseRxDMA(pOwner);
+
+  if ((Size != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    if ((((uint32_t)pBuffer | Size) & (CORTEX_DCACHE_LINE_SIZE - 1U)) == 0U)
+    {
+      SCB_InvalidateDCache_by_Addr((uint32_t *)pBuffer, (int32_t)Size);
+    }
+    else if ((ppDmaBuffer == NULL) || (Size > HAL_DMA_BOUNCE_BUFFER_SIZE))
+    {
+      /* The buffer shares cache lines with other data and cannot be bounced */
+      status = HAL_ERROR;
+    }
+    else
+    {
+      /* Take a free bounce buffer */
+      primask = __get_PRIMASK();
+      __disable_irq();
+      while ((index < HAL_DMA_BOUNCE_BUFFER_NBR) && (CORTEX_BounceOwner[index] != NULL))
+      {
+        index++;
+      }
+      if (index < HAL_DMA_BOUNCE_BUFFER_NBR)
+      {
+        CORTEX_BounceOwner[index] = pOwner;
+      }
+      __set_PRIMASK(primask);
+
+      if (index < HAL_DMA_BOUNCE_BUFFER_NBR)
+      {
+        pDmaBuffer = CORTEX_BounceBuffer[index];
+        SCB_InvalidateDCache_by_Addr((uint32_t *)pDmaBuffer, (int32_t)HAL_DMA_BOUNCE_BUFFER_SIZE);
+      }
+      else
+      {
+        status = HAL_ERROR;
+      }
+    }
+  }
+#else
+  UNUSED(pOwner);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+
+  if (ppDmaBuffer != NULL)
+  {
+    *ppDmaBuffer = pDmaBuffer;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Make the data written by a DMA visible to the CPU.
+  * @note   This function can be called on transfer progress events (half
+  *         transfer, idle line) as well as on transfer completion.
+  * @param  pOwner Pointer to the handle of the peripheral owning the reception.
+  * @param  pBuffer Pointer to the reception buffer given to HAL_DCACHE_PrepareRxDMA().
+  * @param  Size Number of bytes to synchronize from the start of the buffer.
+  * @retval None
+  */
+void HAL_DCACHE_SyncRxDMA(const void *pOwner, uint8_t *pBuffer, uint32_t Size)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t index = 0U;
+  uint32_t count;
+
+  while ((index < HAL_DMA_BOUNCE_BUFFER_NBR) && (CORTEX_BounceOwner[index] != pOwner))
+  {
+    index++;
+  }
+
+  if (index < HAL_DMA_BOUNCE_BUFFER_NBR)
+  {
+    /* Read the received data from memory and copy it to the reception buffer */
+    CORTEX_InvalidateDCacheRange(CORTEX_BounceBuffer[index], Size);
+    for (count = 0U; count < Size; count++)
+    {
+      pBuffer[count] = CORTEX_BounceBuffer[index][count];
+    }
+  }
+  else
+  {
+    /* Drop the lines which may have been speculatively loaded during the transfer */
+    CORTEX_InvalidateDCacheRange(pBuffer, Size);
+  }
+#else
+  UNUSED(pOwner);
+  UNUSED(pBuffer);
+  UNUSED(Size);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @brief  Release the bounce buffer used by the DMA reception of a peripheral.
+  * @param  pOwner Pointer to the handle of the peripheral owning the reception.
+  * @retval None
+  */
+void HAL_DCACHE_ReleaseRxDMA(const void *pOwner)
+{
+#if defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  uint32_t index;
+
+  for (index = 0U; index < HAL_DMA_BOUNCE_BUFFER_NBR; index++)
+  {
+    if (CORTEX_BounceOwner[index] == pOwner)
+    {
+      CORTEX_BounceOwner[index] = NULL;
+    }
+  }
+#else
+  UNUSED(pOwner);
+#endif /* __DCACHE_PRESENT */
+}
+
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
+/**
+  * @}
+  */
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U) && defined(__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+/** @defgroup CORTEX_Private_Functions CORTEX Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Invalidate the data cache lines of a buffer aligned on the cache lines.
+  * @param  pBuffer Pointer to the buffer, or to a position inside it.
+  * @param  Size Number of bytes to invalidate.
+  * @retval None
+  */
+static void CORTEX_InvalidateDCacheRange(const void *pBuffer, uint32_t Size)
+{
+  uint32_t start;
+  uint32_t end;
+
+  if ((Size != 0U) && ((SCB->CCR & SCB_CCR_DC_Msk) != 0U))
+  {
+    start = ((uint32_t)pBuffer & ~(CORTEX_DCACHE_LINE_SIZE - 1U));
+    end = (((uint32_t)pBuffer + Size + CORTEX_DCACHE_LINE_SIZE - 1U) & ~(CORTEX_DCACHE_LINE_SIZE - 1U));
+    SCB_InvalidateDCache_by_Addr((uint32_t *)start, (int32_t)(end - start));
+  }
+}
+
 /**
   * @}
   */
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE && __DCACHE_PRESENT */
 
 #endif /* HAL_CORTEX_MODULE_ENABLED */
 /**
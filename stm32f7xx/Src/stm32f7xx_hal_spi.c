@@ -263,6 +263,9 @@ static void SPI_CloseRx_ISR(SPI_HandleTypeDef *hspi);
 static void SPI_CloseTx_ISR(SPI_HandleTypeDef *hspi);
 static HAL_StatusTypeDef SPI_EndRxTransaction(SPI_HandleTypeDef *hspi, uint32_t Timeout, uint32_t Tickstart);
 static HAL_StatusTypeDef SPI_EndRxTxTransaction(SPI_HandleTypeDef *hspi, uint32_t Timeout, uint32_t Tickstart);
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+static uint32_t SPI_DMABufferSize(const SPI_HandleTypeDef *hspi, uint16_t Size);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 /**
   * @}
   */
@@ -1976,6 +1979,11 @@ HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *p
     }
   }
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Write the data to transmit back to memory */
+  HAL_DCACHE_CleanForDMA(hspi->pTxBuffPtr, SPI_DMABufferSize(hspi, Size));
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
   /* Enable the Tx DMA Stream/Channel */
   if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmatx, (uint32_t)hspi->pTxBuffPtr, (uint32_t)&hspi->Instance->DR,
                                  hspi->TxXferCount))
@@ -2018,6 +2026,8 @@ HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *p
   */
 HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
 {
+  uint8_t *pDmaBuffer = pData;
+
   /* Check rx dma handle */
   assert_param(IS_SPI_DMA_HANDLE(hspi->hdmarx));
 
@@ -2116,8 +2126,22 @@ HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, u
   /* Set the DMA AbortCpltCallback */
   hspi->hdmarx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Invalidate the reception buffer, a circular reception cannot use a bounce buffer */
+  if (HAL_OK != HAL_DCACHE_PrepareRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, Size),
+                                        (hspi->hdmarx->Init.Mode != DMA_CIRCULAR) ? &pDmaBuffer : NULL))
+  {
+    /* Update SPI error code */
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->State = HAL_SPI_STATE_READY;
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspi);
+    return HAL_ERROR;
+  }
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
   /* Enable the Rx DMA Stream/Channel  */
-  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)hspi->pRxBuffPtr,
+  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)pDmaBuffer,
                                  hspi->RxXferCount))
   {
     /* Update SPI error code */
@@ -2161,6 +2185,7 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uin
 {
   uint32_t             tmp_mode;
   HAL_SPI_StateTypeDef tmp_state;
+  uint8_t              *pDmaBuffer = pRxData;
 
   /* Check rx & tx dma handles */
   assert_param(IS_SPI_DMA_HANDLE(hspi->hdmarx));
@@ -2281,8 +2306,25 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uin
   /* Set the DMA AbortCpltCallback */
   hspi->hdmarx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Write the data to transmit back to memory */
+  HAL_DCACHE_CleanForDMA(hspi->pTxBuffPtr, SPI_DMABufferSize(hspi, Size));
+
+  /* Invalidate the reception buffer, a circular reception cannot use a bounce buffer */
+  if (HAL_OK != HAL_DCACHE_PrepareRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, Size),
+                                        (hspi->hdmarx->Init.Mode != DMA_CIRCULAR) ? &pDmaBuffer : NULL))
+  {
+    /* Update SPI error code */
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->State = HAL_SPI_STATE_READY;
+    /* Process Unlocked */
+    __HAL_UNLOCK(hspi);
+    return HAL_ERROR;
+  }
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
   /* Enable the Rx DMA Stream/Channel  */
-  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)hspi->pRxBuffPtr,
+  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->DR, (uint32_t)pDmaBuffer,
                                  hspi->RxXferCount))
   {
     /* Update SPI error code */
@@ -2741,6 +2783,12 @@ HAL_StatusTypeDef HAL_SPI_DMAStop(SPI_HandleTypeDef *hspi)
   /* Disable the SPI DMA Tx & Rx requests */
   CLEAR_BIT(hspi->Instance->CR2, SPI_CR2_TXDMAEN | SPI_CR2_RXDMAEN);
   hspi->State = HAL_SPI_STATE_READY;
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Release the bounce buffer of the reception */
+  HAL_DCACHE_ReleaseRxDMA(hspi);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   return errorcode;
 }
 
@@ -3113,6 +3161,11 @@ static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
   /* Init tickstart for timeout management*/
   tickstart = HAL_GetTick();
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* DMA Normal Mode */
   if ((hdma->Instance->CR & DMA_SxCR_CIRC) != DMA_SxCR_CIRC)
   {
@@ -3183,6 +3236,11 @@ static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     hspi->RxXferCount = 0U;
     hspi->State = HAL_SPI_STATE_READY;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+    /* Release the bounce buffer of the reception */
+    HAL_DCACHE_ReleaseRxDMA(hspi);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 #if (USE_SPI_CRC != 0U)
     /* Check if CRC error occurred */
     if (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_CRCERR))
@@ -3230,6 +3288,11 @@ static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma)
   /* Init tickstart for timeout management*/
   tickstart = HAL_GetTick();
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* DMA Normal Mode */
   if ((hdma->Instance->CR & DMA_SxCR_CIRC) != DMA_SxCR_CIRC)
   {
@@ -3284,6 +3347,11 @@ static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma)
     hspi->RxXferCount = 0U;
     hspi->State = HAL_SPI_STATE_READY;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+    /* Release the bounce buffer of the reception */
+    HAL_DCACHE_ReleaseRxDMA(hspi);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 #if (USE_SPI_CRC != 0U)
     /* Check if CRC error occurred */
     if (__HAL_SPI_GET_FLAG(hspi, SPI_FLAG_CRCERR))
@@ -3340,6 +3408,11 @@ static void SPI_DMAHalfReceiveCplt(DMA_HandleTypeDef *hdma)
 {
   SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the first half of the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize / 2U));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* Call user Rx half complete callback */
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1U)
   hspi->RxHalfCpltCallback(hspi);
@@ -3358,6 +3431,11 @@ static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma)
 {
   SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)(((DMA_HandleTypeDef *)hdma)->Parent);
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the first half of the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize / 2U));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* Call user TxRx half complete callback */
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1U)
   hspi->TxRxHalfCpltCallback(hspi);
@@ -3381,6 +3459,12 @@ static void SPI_DMAError(DMA_HandleTypeDef *hdma)
 
   SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
   hspi->State = HAL_SPI_STATE_READY;
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Release the bounce buffer of the reception */
+  HAL_DCACHE_ReleaseRxDMA(hspi);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* Call user error callback */
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1U)
   hspi->ErrorCallback(hspi);
@@ -4516,6 +4600,27 @@ static void SPI_AbortTx_ISR(SPI_HandleTypeDef *hspi)
   hspi->State = HAL_SPI_STATE_ABORT;
 }
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Compute the size in bytes of a SPI DMA buffer.
+  * @param  hspi pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  Size amount of data frames
+  * @retval Size in bytes
+  */
+static uint32_t SPI_DMABufferSize(const SPI_HandleTypeDef *hspi, uint16_t Size)
+{
+  uint32_t nbytes = Size;
+
+  if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
+  {
+    nbytes *= sizeof(uint16_t);
+  }
+
+  return nbytes;
+}
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 /**
   * @}
   */
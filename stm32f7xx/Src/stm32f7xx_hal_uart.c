@@ -196,6 +196,9 @@ static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+static uint32_t UART_DMABufferSize(const UART_HandleTypeDef *huart, uint16_t Size);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAError(DMA_HandleTypeDef *hdma);
 static void UART_DMAAbortOnError(DMA_HandleTypeDef *hdma);
@@ -310,6 +313,9 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -377,6 +383,9 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -465,6 +474,9 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -551,6 +563,9 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -646,6 +661,7 @@ HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
   huart->gState = HAL_UART_STATE_RESET;
   huart->RxState = HAL_UART_STATE_RESET;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
   huart->RxEventType = HAL_UART_RXEVENT_TC;
 
   __HAL_UNLOCK(huart);
@@ -1385,6 +1401,11 @@ HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t
       /* Set the DMA abort callback */
       huart->hdmatx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+      /* Write the data to transmit back to memory */
+      HAL_DCACHE_CleanForDMA(huart->pTxBuffPtr, UART_DMABufferSize(huart, Size));
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
       /* Enable the UART transmit DMA channel */
       if (HAL_DMA_Start_IT(huart->hdmatx, (uint32_t)huart->pTxBuffPtr, (uint32_t)&huart->Instance->TDR, Size) != HAL_OK)
       {
@@ -1436,6 +1457,7 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
 
     /* Set Reception type to Standard reception */
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* Check that USART RTOEN bit is set */
     if (READ_BIT(huart->Instance->CR2, USART_CR2_RTOEN) != 0U)
@@ -1672,6 +1694,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   huart->ErrorCode = HAL_UART_ERROR_NONE;
 
@@ -1793,6 +1816,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   return HAL_OK;
 }
@@ -1930,6 +1954,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2092,6 +2117,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
       /* Restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
       huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      huart->pRxStream = NULL;
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2117,6 +2143,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     /* Restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2320,6 +2347,14 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
         /* Reception is not complete */
         huart->RxXferCount = nb_remaining_rx_data;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+        /* Make the received data visible to the CPU, a circular buffer may have wrapped */
+        HAL_DCACHE_SyncRxDMA(huart, huart->pRxBuffPtr,
+                             UART_DMABufferSize(huart, (huart->hdmarx->Init.Mode != DMA_CIRCULAR) ?
+                                                (huart->RxXferSize - huart->RxXferCount) :
+                                                huart->RxXferSize));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
         /* In Normal mode, end DMA xfer and HAL UART Rx process*/
         if (huart->hdmarx->Init.Mode != DMA_CIRCULAR)
         {
@@ -2339,6 +2374,11 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 
           /* Last bytes received, so no need as the abort is immediate */
           (void)HAL_DMA_Abort(huart->hdmarx);
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+          /* Release the bounce buffer of the reception */
+          HAL_DCACHE_ReleaseRxDMA(huart);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
         }
 
         /* Initialize type of RxEvent that correspond to RxEvent callback execution;
@@ -3339,6 +3379,8 @@ HAL_StatusTypeDef UART_Start_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pDat
   */
 HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
 {
+  uint8_t *pDmaBuffer = pData;
+
   huart->pRxBuffPtr = pData;
   huart->RxXferSize = Size;
 
@@ -3359,8 +3401,23 @@ HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pDa
     /* Set the DMA abort callback */
     huart->hdmarx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+    /* Invalidate the reception buffer, a circular reception cannot use a bounce buffer */
+    if (HAL_DCACHE_PrepareRxDMA(huart, pData, UART_DMABufferSize(huart, Size),
+                                (huart->hdmarx->Init.Mode != DMA_CIRCULAR) ? &pDmaBuffer : NULL) != HAL_OK)
+    {
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      /* Restore huart->RxState to ready */
+      huart->RxState = HAL_UART_STATE_READY;
+
+      return HAL_ERROR;
+    }
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
     /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, (uint32_t)huart->pRxBuffPtr, Size) != HAL_OK)
+    if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, (uint32_t)pDmaBuffer, Size) != HAL_OK)
     {
       /* Set error code to DMA */
       huart->ErrorCode = HAL_UART_ERROR_DMA;
@@ -3424,9 +3481,15 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Reset RxIsr function pointer */
   huart->RxISR = NULL;
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Release the bounce buffer of an interrupted DMA reception */
+  HAL_DCACHE_ReleaseRxDMA(huart);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 }
 
 
@@ -3491,6 +3554,11 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
 {
   UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(huart, huart->pRxBuffPtr, UART_DMABufferSize(huart, huart->RxXferSize));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* DMA Normal mode */
   if (hdma->Init.Mode != DMA_CIRCULAR)
   {
@@ -3507,6 +3575,11 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+    /* Release the bounce buffer of the reception */
+    HAL_DCACHE_ReleaseRxDMA(huart);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
     /* If Reception till IDLE event has been selected, Disable IDLE Interrupt */
     if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
     {
@@ -3514,6 +3587,12 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     }
   }
 
+  /* Count the Rx stream buffer wraps, the consumer derives the write position from them */
+  if (huart->pRxStream != NULL)
+  {
+    huart->pRxStream->WrapCount++;
+  }
+
   /* Initialize type of RxEvent that correspond to RxEvent callback execution;
      In this case, Rx Event type is Transfer Complete */
   huart->RxEventType = HAL_UART_RXEVENT_TC;
@@ -3564,6 +3643,11 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 {
   UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the first half of the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(huart, huart->pRxBuffPtr, UART_DMABufferSize(huart, huart->RxXferSize / 2U));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* Initialize type of RxEvent that correspond to RxEvent callback execution;
      In this case, Rx Event type is Half Transfer */
   huart->RxEventType = HAL_UART_RXEVENT_HT;
@@ -3603,6 +3687,27 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
   }
 }
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Compute the size in bytes of a UART DMA buffer.
+  * @param  huart UART handle.
+  * @param  Size Amount of data elements (u8 or u16).
+  * @retval Size in bytes
+  */
+static uint32_t UART_DMABufferSize(const UART_HandleTypeDef *huart, uint16_t Size)
+{
+  uint32_t nbytes = Size;
+
+  /* 9-bit data without parity are handled as a set of u16 */
+  if ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+  {
+    nbytes = 2U * (uint32_t)Size;
+  }
+
+  return nbytes;
+}
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 /**
   * @brief DMA UART communication error callback.
   * @param hdma DMA handle.
@@ -3700,6 +3805,7 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -3752,6 +3858,7 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -3815,6 +3922,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -153,6 +153,42 @@ typedef struct
 
 } FDCAN_FilterTypeDef;
 
+/**
+  * @brief  FDCAN software filter hash table entry structure definition
+  */
+typedef struct
+{
+  uint32_t Key;   /*!< Specifies the masked extended identifier of the rule,
+                       0xFFFFFFFF when the entry is unused                              */
+
+  uint32_t Group; /*!< Specifies the index of the rule mask in FDCAN_SwFilterTypeDef.ExtMasks */
+
+} FDCAN_SwFilterEntryTypeDef;
+
+/**
+  * @brief  FDCAN software filter structure definition
+  */
+typedef struct
+{
+  uint32_t StdBitmap[64];                /*!< Specifies the accepted standard identifiers,
+                                              one bit per identifier                             */
+
+  uint32_t ExtMasks[8];                  /*!< Specifies the distinct masks of the extended
+                                              identifier rules                                   */
+
+  uint32_t ExtMasksNbr;                  /*!< Specifies the number of used entries of ExtMasks  */
+
+  FDCAN_SwFilterEntryTypeDef *pExtTable; /*!< Specifies the hash table of the extended
+                                              identifier rules                                   */
+
+  uint32_t ExtTableSize;                 /*!< Specifies the number of entries of pExtTable      */
+
+  uint32_t ExtTableShift;                /*!< Specifies the hash shift, 32 - log2(ExtTableSize) */
+
+  uint32_t ExtRulesNbr;                  /*!< Specifies the number of used entries of pExtTable */
+
+} FDCAN_SwFilterTypeDef;
+
 /**
   * @brief  FDCAN Tx header structure definition
   */
@@ -193,6 +229,18 @@ typedef struct
 
 } FDCAN_TxHeaderTypeDef;
 
+/**
+  * @brief  FDCAN Tx message structure definition
+  */
+typedef struct
+{
+  FDCAN_TxHeaderTypeDef Header; /*!< Specifies the header of the frame to transmit                   */
+
+  const uint8_t *pData;         /*!< Specifies the payload of the frame to transmit, the number of
+                                     bytes is given by Header.DataLength                             */
+
+} FDCAN_TxMessageTypeDef;
+
 /**
   * @brief  FDCAN Rx header structure definition
   */
@@ -242,6 +290,18 @@ typedef struct
 
 } FDCAN_RxHeaderTypeDef;
 
+/**
+  * @brief  FDCAN Rx message structure definition
+  */
+typedef struct
+{
+  FDCAN_RxHeaderTypeDef Header; /*!< Specifies the header of the received frame                      */
+
+  uint8_t Data[64];             /*!< Specifies the payload of the received frame, the number of valid
+                                     bytes is given by Header.DataLength                             */
+
+} FDCAN_RxMessageTypeDef;
+
 /**
   * @brief  FDCAN Tx event FIFO structure definition
   */
@@ -440,6 +500,11 @@ typedef struct
   uint32_t                    LatestTxFifoQRequest; /*!< FDCAN Tx buffer index
                                                of latest Tx FIFO/Queue request */
 
+  FDCAN_SwFilterTypeDef       *pSwFilter;       /*!< FDCAN software filter     */
+
+  __IO uint32_t               TxBatchPending;   /*!< FDCAN Tx buffers of the pending
+                                                     HAL_FDCAN_AddMessagesToTxFifoQ batches */
+
   __IO HAL_FDCAN_StateTypeDef State;            /*!< FDCAN communication state */
 
   HAL_LockTypeDef             Lock;             /*!< FDCAN locking object      */
@@ -453,6 +518,7 @@ typedef struct
   void (* TxFifoEmptyCallback)(struct __FDCAN_HandleTypeDef *hfdcan);                              /*!< FDCAN Tx Fifo Empty callback         */
   void (* TxBufferCompleteCallback)(struct __FDCAN_HandleTypeDef *hfdcan, uint32_t BufferIndexes); /*!< FDCAN Tx Buffer complete callback    */
   void (* TxBufferAbortCallback)(struct __FDCAN_HandleTypeDef *hfdcan, uint32_t BufferIndexes);    /*!< FDCAN Tx Buffer abort callback       */
+  void (* TxBatchCompleteCallback)(struct __FDCAN_HandleTypeDef *hfdcan);                          /*!< FDCAN Tx batch complete callback     */
   void (* HighPriorityMessageCallback)(struct __FDCAN_HandleTypeDef *hfdcan);                      /*!< FDCAN High priority message callback */
   void (* TimestampWraparoundCallback)(struct __FDCAN_HandleTypeDef *hfdcan);                      /*!< FDCAN Timestamp wraparound callback  */
   void (* TimeoutOccurredCallback)(struct __FDCAN_HandleTypeDef *hfdcan);                          /*!< FDCAN Timeout occurred callback      */
@@ -481,6 +547,8 @@ typedef enum
   HAL_FDCAN_MSPINIT_CB_ID              = 0x05U,    /*!< FDCAN MspInit callback ID               */
   HAL_FDCAN_MSPDEINIT_CB_ID            = 0x06U,    /*!< FDCAN MspDeInit callback ID             */
 
+  HAL_FDCAN_TX_BATCH_COMPLETE_CB_ID    = 0x07U,    /*!< FDCAN Tx batch complete callback ID     */
+
 } HAL_FDCAN_CallbackIDTypeDef;
 
 /**
@@ -1172,6 +1240,10 @@ HAL_StatusTypeDef HAL_FDCAN_UnRegisterErrorStatusCallback(FDCAN_HandleTypeDef *h
   */
 /* Configuration functions ****************************************************/
 HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef *hfdcan, const FDCAN_FilterTypeDef *sFilterConfig);
+HAL_StatusTypeDef HAL_FDCAN_ConfigSoftwareFilter(FDCAN_HandleTypeDef *hfdcan, FDCAN_SwFilterTypeDef *pSwFilter,
+                                                 FDCAN_SwFilterEntryTypeDef *pExtTable, uint32_t ExtTableSize);
+uint32_t HAL_FDCAN_IsSoftwareFilterMatching(const FDCAN_HandleTypeDef *hfdcan, uint32_t IdType,
+                                            uint32_t Identifier);
 HAL_StatusTypeDef HAL_FDCAN_ConfigGlobalFilter(FDCAN_HandleTypeDef *hfdcan, uint32_t NonMatchingStd,
                                                uint32_t NonMatchingExt, uint32_t RejectRemoteStd,
                                                uint32_t RejectRemoteExt);
@@ -1209,10 +1281,20 @@ HAL_StatusTypeDef HAL_FDCAN_Start(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_Stop(FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_AddMessageToTxFifoQ(FDCAN_HandleTypeDef *hfdcan, const FDCAN_TxHeaderTypeDef *pTxHeader,
                                                 const uint8_t *pTxData);
+HAL_StatusTypeDef HAL_FDCAN_AddMessagesToTxFifoQ(FDCAN_HandleTypeDef *hfdcan,
+                                                 const FDCAN_TxMessageTypeDef *pTxMessages, uint32_t Count,
+                                                 uint32_t *pBufferIndexes);
 uint32_t HAL_FDCAN_GetLatestTxFifoQRequestBuffer(const FDCAN_HandleTypeDef *hfdcan);
 HAL_StatusTypeDef HAL_FDCAN_AbortTxRequest(FDCAN_HandleTypeDef *hfdcan, uint32_t BufferIndex);
 HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
                                          FDCAN_RxHeaderTypeDef *pRxHeader, uint8_t *pRxData);
+HAL_StatusTypeDef HAL_FDCAN_PeekRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                                          FDCAN_RxHeaderTypeDef *pRxHeader, const uint8_t **pRxData,
+                                          uint32_t *pRxIndex);
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t RxIndex);
+HAL_StatusTypeDef HAL_FDCAN_GetRxMessages(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo,
+                                          FDCAN_RxMessageTypeDef *pRxMessages, uint32_t Count,
+                                          uint32_t *pRxCount);
 HAL_StatusTypeDef HAL_FDCAN_GetTxEvent(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxEventFifoTypeDef *pTxEvent);
 HAL_StatusTypeDef HAL_FDCAN_GetHighPriorityMessageStatus(const FDCAN_HandleTypeDef *hfdcan,
                                                          FDCAN_HpMsgStatusTypeDef *HpMsgStatus);
@@ -1252,6 +1334,7 @@ void HAL_FDCAN_RxFifo1Callback(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo1ITs)
 void HAL_FDCAN_TxFifoEmptyCallback(FDCAN_HandleTypeDef *hfdcan);
 void HAL_FDCAN_TxBufferCompleteCallback(FDCAN_HandleTypeDef *hfdcan, uint32_t BufferIndexes);
 void HAL_FDCAN_TxBufferAbortCallback(FDCAN_HandleTypeDef *hfdcan, uint32_t BufferIndexes);
+void HAL_FDCAN_TxBatchCompleteCallback(FDCAN_HandleTypeDef *hfdcan);
 void HAL_FDCAN_HighPriorityMessageCallback(FDCAN_HandleTypeDef *hfdcan);
 void HAL_FDCAN_TimestampWraparoundCallback(FDCAN_HandleTypeDef *hfdcan);
 void HAL_FDCAN_TimeoutOccurredCallback(FDCAN_HandleTypeDef *hfdcan);
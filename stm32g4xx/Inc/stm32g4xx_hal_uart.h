@@ -211,6 +211,27 @@ typedef uint32_t HAL_UART_RxTypeTypeDef;
   */
 typedef uint32_t HAL_UART_RxEventTypeTypeDef;
 
+/**
+  * @brief  UART Rx stream structure definition
+  * @note   The stream buffer is filled by a circular DMA reception. The wrap count is only
+  *         updated by the DMA Transfer Complete interrupt, the consumer fields only by the
+  *         single context reading the stream, so that no interrupt masking is needed.
+  */
+typedef struct
+{
+  uint8_t                  *pBuffer;                 /*!< Circular reception buffer                      */
+
+  uint16_t                 Size;                     /*!< Size of the reception buffer in bytes          */
+
+  __IO uint32_t            WrapCount;                /*!< Number of DMA buffer wraps (producer)          */
+
+  uint16_t                 ReadIndex;                /*!< Buffer index of the next read (consumer)       */
+
+  uint32_t                 ReadCount;                /*!< Number of bytes consumed (consumer)            */
+
+  uint32_t                 OverrunCount;             /*!< Number of bytes lost on overrun (consumer)     */
+} UART_RxStreamTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -255,6 +276,8 @@ typedef struct __UART_HandleTypeDef
 
   DMA_HandleTypeDef        *hdmarx;                  /*!< UART Rx DMA Handle parameters      */
 
+  UART_RxStreamTypeDef     *pRxStream;               /*!< UART Rx stream, NULL if not used   */
+
   HAL_LockTypeDef           Lock;                    /*!< Locking object                     */
 
   __IO HAL_UART_StateTypeDef    gState;              /*!< UART state information related to global Handle management
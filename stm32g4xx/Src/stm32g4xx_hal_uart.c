@@ -328,6 +328,9 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -395,6 +398,9 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -483,6 +489,9 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -569,6 +578,9 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Rx stream attached */
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -664,6 +676,7 @@ HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
   huart->gState = HAL_UART_STATE_RESET;
   huart->RxState = HAL_UART_STATE_RESET;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
   huart->RxEventType = HAL_UART_RXEVENT_TC;
 
   __HAL_UNLOCK(huart);
@@ -1499,6 +1512,7 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
 
     /* Set Reception type to Standard reception */
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     if (!(IS_LPUART_INSTANCE(huart->Instance)))
     {
@@ -1740,6 +1754,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   huart->ErrorCode = HAL_UART_ERROR_NONE;
 
@@ -1861,6 +1876,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   return HAL_OK;
 }
@@ -2000,6 +2016,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2160,6 +2177,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
       /* Restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
       huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      huart->pRxStream = NULL;
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2182,6 +2200,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     /* Restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -3606,6 +3625,7 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Reset RxIsr function pointer */
   huart->RxISR = NULL;
@@ -3696,6 +3716,12 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     }
   }
 
+  /* Count the Rx stream buffer wraps, the consumer derives the write position from them */
+  if (huart->pRxStream != NULL)
+  {
+    huart->pRxStream->WrapCount++;
+  }
+
   /* Initialize type of RxEvent that correspond to RxEvent callback execution;
      In this case, Rx Event type is Transfer Complete */
   huart->RxEventType = HAL_UART_RXEVENT_TC;
@@ -3880,6 +3906,7 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -3928,6 +3955,7 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -3992,6 +4020,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
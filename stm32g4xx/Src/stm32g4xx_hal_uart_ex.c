@@ -75,6 +75,7 @@
   * @{
   */
 static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTypeDef WakeUpSelection);
+static uint32_t UARTEx_RxStreamWriteCount(const UART_HandleTypeDef *huart);
 static void UARTEx_SetNbDataToProcess(UART_HandleTypeDef *huart);
 /**
   * @}
@@ -367,6 +368,26 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
     (#) Non-Blocking mode API with DMA:
         (++) HAL_UARTEx_ReceiveToIdle_DMA()
 
+    (#) Circular reception stream API with DMA:
+        (++) HAL_UARTEx_RxStream_Start()
+        (++) HAL_UARTEx_RxStream_Stop()
+        (++) HAL_UARTEx_RxStream_Available()
+        (++) HAL_UARTEx_RxStream_Peek()
+        (++) HAL_UARTEx_RxStream_Read()
+        (++) HAL_UARTEx_RxStream_Consume()
+        The stream runs a reception till IDLE event on a circular DMA which is never stopped.
+        The driver only counts the buffer wraps on DMA Transfer Complete events, the consumer
+        derives the write position from the DMA counter; HAL_UARTEx_RxEventCallback() is still
+        executed and may be used to wake up the consumer. A single context reads the stream
+        without disabling interrupts:
+        HAL_UARTEx_RxStream_Peek() gives direct access to the contiguous received data,
+        HAL_UARTEx_RxStream_Consume() releases it and HAL_UARTEx_RxStream_Read() copies it.
+        When the consumer is late by more than the buffer size, the unread data is dropped and
+        counted in the OverrunCount field of the stream.
+        A reception error stopping the DMA or an abort of the reception ends the stream: the
+        stream is restarted by calling HAL_UARTEx_RxStream_Start() again, for instance from
+        HAL_UART_ErrorCallback().
+
 @endverbatim
   * @{
   */
@@ -903,6 +924,7 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
     /* Set Reception type to reception till IDLE Event*/
     huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
     huart->RxEventType = HAL_UART_RXEVENT_TC;
+    huart->pRxStream = NULL;
 
     status =  UART_Start_Receive_DMA(huart, pData, Size);
 
@@ -960,6 +982,235 @@ HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(const UART_HandleTypeDef *
   return (huart->RxEventType);
 }
 
+/**
+  * @brief  Start a circular DMA reception stream.
+  * @note   The Rx DMA channel must be configured in circular mode. The reception is never
+  *         stopped by the driver until HAL_UARTEx_RxStream_Stop() is called or a reception
+  *         error occurs.
+  * @note   The stream handles 8-bit data elements only: a 9-bit word length without parity is
+  *         not supported.
+  * @param  huart   UART handle.
+  * @param  pStream Pointer to the stream structure, owned by the caller for the stream lifetime.
+  * @param  pBuffer Pointer to the circular reception buffer.
+  * @param  Size    Size of the reception buffer in bytes.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Start(UART_HandleTypeDef *huart, UART_RxStreamTypeDef *pStream,
+                                            uint8_t *pBuffer, uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pStream == NULL) || (pBuffer == NULL) || (Size == 0U) || (huart->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the DMA mode and the data element size */
+  if ((HAL_IS_BIT_CLR(huart->hdmarx->Instance->CCR, DMA_CCR_CIRC))
+      || ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE)))
+  {
+    return HAL_ERROR;
+  }
+
+  pStream->pBuffer      = pBuffer;
+  pStream->Size         = Size;
+  pStream->WrapCount    = 0U;
+  pStream->ReadIndex    = 0U;
+  pStream->ReadCount    = 0U;
+  pStream->OverrunCount = 0U;
+
+  /* Set Reception type to reception till IDLE Event*/
+  huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+  huart->RxEventType = HAL_UART_RXEVENT_TC;
+  huart->pRxStream = pStream;
+
+  status =  UART_Start_Receive_DMA(huart, pBuffer, Size);
+
+  /* Check Rx process has been successfully started */
+  if (status == HAL_OK)
+  {
+    if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+    {
+      __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_IDLEF);
+      ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+    }
+    else
+    {
+      /* Errors already pending when reception is started may have aborted the reception */
+      status = HAL_ERROR;
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    huart->pRxStream = NULL;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the circular DMA reception stream.
+  * @note   Data received and not yet consumed is lost.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Stop(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status;
+
+  if (huart->pRxStream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The abort of the reception detaches the stream */
+  status = HAL_UART_AbortReceive(huart);
+
+  return status;
+}
+
+/**
+  * @brief  Return the number of bytes received and not yet consumed from the Rx stream.
+  * @note   When the DMA has overwritten data not yet consumed, all the unread data is dropped
+  *         and added to the OverrunCount field of the stream.
+  * @note   This function and the other consumer functions must be called from a single context.
+  * @param  huart UART handle.
+  * @retval Number of bytes available
+  */
+uint32_t HAL_UARTEx_RxStream_Available(UART_HandleTypeDef *huart)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t nb_data;
+  uint32_t index;
+
+  if (pstream == NULL)
+  {
+    return 0U;
+  }
+
+  nb_data = UARTEx_RxStreamWriteCount(huart) - pstream->ReadCount;
+
+  if (nb_data > pstream->Size)
+  {
+    /* Overrun : skip the data received so far */
+    index = ((uint32_t)pstream->ReadIndex + nb_data) % pstream->Size;
+    pstream->ReadIndex = (uint16_t)index;
+    pstream->ReadCount += nb_data;
+    pstream->OverrunCount += nb_data;
+    nb_data = 0U;
+  }
+
+  /* Ensure the buffer is read after the write count */
+  __DMB();
+
+  return nb_data;
+}
+
+/**
+  * @brief  Give direct access to the received data of the Rx stream without copying it.
+  * @note   The returned length covers the data stored contiguously from the read position:
+  *         the data located after the buffer wrap is returned by a next call, once the first
+  *         part has been released with HAL_UARTEx_RxStream_Consume().
+  * @param  huart  UART handle.
+  * @param  ppData Pointer filled with the address of the first unread byte.
+  * @retval Number of contiguous bytes available at *ppData
+  */
+uint32_t HAL_UARTEx_RxStream_Peek(UART_HandleTypeDef *huart, const uint8_t **ppData)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t nb_data;
+  uint32_t nb_contiguous;
+
+  nb_data = HAL_UARTEx_RxStream_Available(huart);
+
+  if (nb_data == 0U)
+  {
+    return 0U;
+  }
+
+  nb_contiguous = (uint32_t)pstream->Size - pstream->ReadIndex;
+  if (nb_data < nb_contiguous)
+  {
+    nb_contiguous = nb_data;
+  }
+
+  *ppData = &pstream->pBuffer[pstream->ReadIndex];
+
+  return nb_contiguous;
+}
+
+/**
+  * @brief  Copy received data from the Rx stream and release it.
+  * @param  huart UART handle.
+  * @param  pData Pointer to the destination buffer.
+  * @param  Size  Maximum number of bytes to copy.
+  * @retval Number of bytes copied
+  */
+uint32_t HAL_UARTEx_RxStream_Read(UART_HandleTypeDef *huart, uint8_t *pData, uint32_t Size)
+{
+  const uint8_t *psrc = NULL;
+  uint32_t nb_copied = 0U;
+  uint32_t nb_data;
+  uint32_t count;
+
+  nb_data = HAL_UARTEx_RxStream_Peek(huart, &psrc);
+
+  /* The data may be stored in two parts when the buffer has wrapped */
+  while ((nb_data != 0U) && (nb_copied < Size))
+  {
+    if (nb_data > (Size - nb_copied))
+    {
+      nb_data = Size - nb_copied;
+    }
+
+    for (count = 0U; count < nb_data; count++)
+    {
+      pData[nb_copied + count] = psrc[count];
+    }
+    nb_copied += nb_data;
+
+    (void)HAL_UARTEx_RxStream_Consume(huart, nb_data);
+
+    nb_data = (nb_copied < Size) ? HAL_UARTEx_RxStream_Peek(huart, &psrc) : 0U;
+  }
+
+  return nb_copied;
+}
+
+/**
+  * @brief  Release data of the Rx stream once processed by the consumer.
+  * @param  huart UART handle.
+  * @param  Size  Number of bytes to release.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Consume(UART_HandleTypeDef *huart, uint32_t Size)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t index;
+
+  if ((pstream == NULL) || (Size > (UARTEx_RxStreamWriteCount(huart) - pstream->ReadCount)))
+  {
+    return HAL_ERROR;
+  }
+
+  index = (uint32_t)pstream->ReadIndex + Size;
+  if (index >= pstream->Size)
+  {
+    index -= pstream->Size;
+  }
+  pstream->ReadIndex = (uint16_t)index;
+  pstream->ReadCount += Size;
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
@@ -989,6 +1240,43 @@ static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTy
   MODIFY_REG(huart->Instance->CR2, USART_CR2_ADD, ((uint32_t)WakeUpSelection.Address << UART_CR2_ADDRESS_LSB_POS));
 }
 
+/**
+  * @brief  Return the number of bytes written by the DMA since the start of the Rx stream.
+  * @note   The count is derived from a single read of the DMA counter and from the number of
+  *         buffer wraps counted by the DMA Transfer Complete interrupt: the wrap count is read
+  *         again after the DMA counter and the read is restarted if the interrupt ran in between.
+  * @note   A buffer wrap whose Transfer Complete interrupt is not served yet is detected from the
+  *         DMA Transfer Complete flag, sampled before and after the DMA counter.
+  * @param  huart UART handle.
+  * @retval Number of bytes written
+  */
+static uint32_t UARTEx_RxStreamWriteCount(const UART_HandleTypeDef *huart)
+{
+  const UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t wrap_count;
+  uint32_t position;
+  uint32_t write_count;
+  uint32_t tc_pending;
+  uint32_t tc_flag = __HAL_DMA_GET_TC_FLAG_INDEX(huart->hdmarx);
+
+  do
+  {
+    wrap_count = pstream->WrapCount;
+    tc_pending = __HAL_DMA_GET_FLAG(huart->hdmarx, tc_flag);
+    position = (uint32_t)pstream->Size - __HAL_DMA_GET_COUNTER(huart->hdmarx);
+  } while ((wrap_count != pstream->WrapCount) || (tc_pending != __HAL_DMA_GET_FLAG(huart->hdmarx, tc_flag)));
+
+  write_count = (wrap_count * pstream->Size) + position;
+
+  /* The DMA counter has already been reloaded for a buffer wrap not yet counted by the interrupt */
+  if (tc_pending != 0U)
+  {
+    write_count += pstream->Size;
+  }
+
+  return write_count;
+}
+
 /**
   * @brief Calculate the number of data to process in RX/TX ISR.
   * @note The RX FIFO depth and the TX FIFO depth is extracted from
@@ -214,6 +214,57 @@ typedef uint32_t HAL_UART_RxTypeTypeDef;
   */
 typedef uint32_t HAL_UART_RxEventTypeTypeDef;
 
+/**
+  * @brief  UART Rx stream structure definition
+  * @note   The stream buffer is filled by a circular DMA reception. The wrap count is only
+  *         updated by the DMA Transfer Complete interrupt, the consumer fields only by the
+  *         single context reading the stream, so that no interrupt masking is needed.
+  */
+typedef struct
+{
+  uint8_t                  *pBuffer;                 /*!< Circular reception buffer                      */
+
+  uint16_t                 Size;                     /*!< Size of the reception buffer in bytes          */
+
+  __IO uint32_t            WrapCount;                /*!< Number of DMA buffer wraps (producer)          */
+
+  uint16_t                 ReadIndex;                /*!< Buffer index of the next read (consumer)       */
+
+  uint32_t                 ReadCount;                /*!< Number of bytes consumed (consumer)            */
+
+  uint32_t                 OverrunCount;             /*!< Number of bytes lost on overrun (consumer)     */
+} UART_RxStreamTypeDef;
+
+/**
+  * @brief  UART Tx queue buffer descriptor definition
+  */
+typedef struct
+{
+  const uint8_t            *pData;                   /*!< Data to send (u8 or u16 data elements)         */
+
+  uint16_t                 Size;                     /*!< Amount of data elements to send                */
+
+  void                     *pContext;                /*!< Application cookie given back on completion    */
+} UART_TxBufferTypeDef;
+
+/**
+  * @brief  UART Tx queue structure definition
+  * @note   Buffers are sent in the order they are enqueued; the counters are free running and
+  *         the descriptor of a buffer is at index (count % BufferNumber) of the array.
+  */
+typedef struct
+{
+  UART_TxBufferTypeDef     *pBuffers;                /*!< Array of buffer descriptors                    */
+
+  uint32_t                 BufferNumber;             /*!< Number of descriptors of the array             */
+
+  __IO uint32_t            PutCount;                 /*!< Number of buffers enqueued                     */
+
+  __IO uint32_t            GetCount;                 /*!< Number of buffers sent                         */
+
+  __IO uint32_t            Active;                   /*!< Set while a queued buffer is being sent        */
+} UART_TxQueueTypeDef;
+
 /**
   * @brief  UART handle Structure definition
   */
@@ -259,6 +310,10 @@ typedef struct __UART_HandleTypeDef
 
   DMA_HandleTypeDef        *hdmarx;                  /*!< UART Rx DMA Handle parameters      */
 
+  UART_RxStreamTypeDef     *pRxStream;               /*!< UART Rx stream, NULL if not used   */
+
+  UART_TxQueueTypeDef      *pTxQueue;                /*!< UART Tx queue, NULL if not used    */
+
 #endif /* HAL_DMA_MODULE_ENABLED */
   HAL_LockTypeDef           Lock;                    /*!< Locking object                     */
 
@@ -284,6 +339,8 @@ typedef struct __UART_HandleTypeDef
   void (* RxFifoFullCallback)(struct __UART_HandleTypeDef *huart);        /*!< UART Rx Fifo Full Callback            */
   void (* TxFifoEmptyCallback)(struct __UART_HandleTypeDef *huart);       /*!< UART Tx Fifo Empty Callback           */
   void (* RxEventCallback)(struct __UART_HandleTypeDef *huart, uint16_t Pos); /*!< UART Reception Event Callback     */
+  void (* TxBufferCpltCallback)(struct __UART_HandleTypeDef *huart, void *pContext); /*!< UART Tx Queue Buffer
+                                                                                         Complete Callback   */
 
   void (* MspInitCallback)(struct __UART_HandleTypeDef *huart);           /*!< UART Msp Init callback                */
   void (* MspDeInitCallback)(struct __UART_HandleTypeDef *huart);         /*!< UART Msp DeInit callback              */
@@ -320,6 +377,9 @@ typedef enum
 typedef  void (*pUART_CallbackTypeDef)(UART_HandleTypeDef *huart); /*!< pointer to an UART callback function */
 typedef  void (*pUART_RxEventCallbackTypeDef)
 (struct __UART_HandleTypeDef *huart, uint16_t Pos); /*!< pointer to a UART Rx Event specific callback function */
+typedef  void (*pUART_TxBufferCpltCallbackTypeDef)
+(struct __UART_HandleTypeDef *huart, void *pContext); /*!< pointer to a UART Tx Queue Buffer Complete specific
+                                                         callback function */
 
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
@@ -1645,6 +1705,10 @@ HAL_StatusTypeDef HAL_UART_UnRegisterCallback(UART_HandleTypeDef *huart, HAL_UAR
 
 HAL_StatusTypeDef HAL_UART_RegisterRxEventCallback(UART_HandleTypeDef *huart, pUART_RxEventCallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart);
+
+HAL_StatusTypeDef HAL_UART_RegisterTxBufferCpltCallback(UART_HandleTypeDef *huart,
+                                                        pUART_TxBufferCpltCallbackTypeDef pCallback);
+HAL_StatusTypeDef HAL_UART_UnRegisterTxBufferCpltCallback(UART_HandleTypeDef *huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -1686,6 +1750,7 @@ void HAL_UART_AbortTransmitCpltCallback(UART_HandleTypeDef *huart);
 void HAL_UART_AbortReceiveCpltCallback(UART_HandleTypeDef *huart);
 
 void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size);
+void HAL_UARTEx_TxBufferCpltCallback(UART_HandleTypeDef *huart, void *pContext);
 
 /**
   * @}
@@ -1742,6 +1807,7 @@ void              UART_AdvFeatureConfig(UART_HandleTypeDef *huart);
 HAL_StatusTypeDef UART_Start_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
 #if defined(HAL_DMA_MODULE_ENABLED)
 HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size);
+HAL_StatusTypeDef UART_TxQueueStart(UART_HandleTypeDef *huart);
 #endif /* HAL_DMA_MODULE_ENABLED */
 
 /**
@@ -182,6 +182,21 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
 
 HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(const UART_HandleTypeDef *huart);
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Start(UART_HandleTypeDef *huart, UART_RxStreamTypeDef *pStream,
+                                            uint8_t *pBuffer, uint16_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Stop(UART_HandleTypeDef *huart);
+uint32_t HAL_UARTEx_RxStream_Available(UART_HandleTypeDef *huart);
+uint32_t HAL_UARTEx_RxStream_Peek(UART_HandleTypeDef *huart, const uint8_t **ppData);
+uint32_t HAL_UARTEx_RxStream_Read(UART_HandleTypeDef *huart, uint8_t *pData, uint32_t Size);
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Consume(UART_HandleTypeDef *huart, uint32_t Size);
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Init(UART_HandleTypeDef *huart, UART_TxQueueTypeDef *pQueue,
+                                          UART_TxBufferTypeDef *pBuffers, uint32_t BufferNumber);
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_DeInit(UART_HandleTypeDef *huart);
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Enqueue(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                             void *pContext);
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 
 /**
   * @}
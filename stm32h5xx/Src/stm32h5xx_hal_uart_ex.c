@@ -75,6 +75,9 @@
   * @{
   */
 static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTypeDef WakeUpSelection);
+#if defined(HAL_DMA_MODULE_ENABLED)
+static uint32_t UARTEx_RxStreamWriteCount(const UART_HandleTypeDef *huart);
+#endif /* HAL_DMA_MODULE_ENABLED */
 static void UARTEx_SetNbDataToProcess(UART_HandleTypeDef *huart);
 /**
   * @}
@@ -190,6 +193,11 @@ HAL_StatusTypeDef HAL_RS485Ex_Init(UART_HandleTypeDef *huart, uint32_t Polarity,
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+    /* No Tx queue attached */
+    huart->pTxQueue = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -367,6 +375,35 @@ __weak void HAL_UARTEx_TxFifoEmptyCallback(UART_HandleTypeDef *huart)
     (#) Non-Blocking mode API with DMA:
         (++) HAL_UARTEx_ReceiveToIdle_DMA()
 
+    (#) Circular reception stream API with DMA:
+        (++) HAL_UARTEx_RxStream_Start()
+        (++) HAL_UARTEx_RxStream_Stop()
+        (++) HAL_UARTEx_RxStream_Available()
+        (++) HAL_UARTEx_RxStream_Peek()
+        (++) HAL_UARTEx_RxStream_Read()
+        (++) HAL_UARTEx_RxStream_Consume()
+        The stream runs a reception till IDLE event on a circular DMA which is never stopped.
+        The driver only counts the buffer wraps on DMA Transfer Complete events, the consumer
+        derives the write position from the DMA counter; HAL_UARTEx_RxEventCallback() is still
+        executed and may be used to wake up the consumer. A single context reads the stream
+        without disabling interrupts:
+        HAL_UARTEx_RxStream_Peek() gives direct access to the contiguous received data,
+        HAL_UARTEx_RxStream_Consume() releases it and HAL_UARTEx_RxStream_Read() copies it.
+        When the consumer is late by more than the buffer size, the unread data is dropped and
+        counted in the OverrunCount field of the stream.
+        A reception error stopping the DMA or an abort of the reception ends the stream: the
+        stream is restarted by calling HAL_UARTEx_RxStream_Start() again, for instance from
+        HAL_UART_ErrorCallback().
+
+    (#) Queued transmission API with DMA:
+        (++) HAL_UARTEx_TxQueue_Init()
+        (++) HAL_UARTEx_TxQueue_DeInit()
+        (++) HAL_UARTEx_TxQueue_Enqueue()
+        Enqueued buffers are sent back to back: the Tx DMA is restarted on the next buffer from
+        the DMA Transfer Complete interrupt, while the last data of the previous buffer is still
+        being shifted out. HAL_UARTEx_TxBufferCpltCallback() is executed for each buffer once read
+        by the DMA, HAL_UART_TxCpltCallback() once the queue is empty and the line is idle.
+
 @endverbatim
   * @{
   */
@@ -920,6 +957,7 @@ HAL_StatusTypeDef HAL_UARTEx_ReceiveToIdle_DMA(UART_HandleTypeDef *huart, uint8_
     /* Set Reception type to reception till IDLE Event*/
     huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
     huart->RxEventType = HAL_UART_RXEVENT_TC;
+    huart->pRxStream = NULL;
 
     status =  UART_Start_Receive_DMA(huart, pData, Size);
 
@@ -978,6 +1016,351 @@ HAL_UART_RxEventTypeTypeDef HAL_UARTEx_GetRxEventType(const UART_HandleTypeDef *
   return (huart->RxEventType);
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Start a circular DMA reception stream.
+  * @note   The Rx DMA channel must be configured in circular mode. The reception is never
+  *         stopped by the driver until HAL_UARTEx_RxStream_Stop() is called or a reception
+  *         error occurs.
+  * @note   The stream handles 8-bit data elements only: a 9-bit word length without parity is
+  *         not supported.
+  * @param  huart   UART handle.
+  * @param  pStream Pointer to the stream structure, owned by the caller for the stream lifetime.
+  * @param  pBuffer Pointer to the circular reception buffer.
+  * @param  Size    Size of the reception buffer in bytes.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Start(UART_HandleTypeDef *huart, UART_RxStreamTypeDef *pStream,
+                                            uint8_t *pBuffer, uint16_t Size)
+{
+  HAL_StatusTypeDef status;
+
+  /* Check that a Rx process is not already ongoing */
+  if (huart->RxState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pStream == NULL) || (pBuffer == NULL) || (Size == 0U) || (huart->hdmarx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the DMA mode and the data element size */
+  if ((huart->hdmarx->Mode != DMA_LINKEDLIST_CIRCULAR)
+      || ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE)))
+  {
+    return HAL_ERROR;
+  }
+
+  pStream->pBuffer      = pBuffer;
+  pStream->Size         = Size;
+  pStream->WrapCount    = 0U;
+  pStream->ReadIndex    = 0U;
+  pStream->ReadCount    = 0U;
+  pStream->OverrunCount = 0U;
+
+  /* Set Reception type to reception till IDLE Event*/
+  huart->ReceptionType = HAL_UART_RECEPTION_TOIDLE;
+  huart->RxEventType = HAL_UART_RXEVENT_TC;
+  huart->pRxStream = pStream;
+
+  status =  UART_Start_Receive_DMA(huart, pBuffer, Size);
+
+  /* Check Rx process has been successfully started */
+  if (status == HAL_OK)
+  {
+    if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
+    {
+      __HAL_UART_CLEAR_FLAG(huart, UART_CLEAR_IDLEF);
+      ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_IDLEIE);
+    }
+    else
+    {
+      /* Errors already pending when reception is started may have aborted the reception */
+      status = HAL_ERROR;
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    huart->pRxStream = NULL;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Stop the circular DMA reception stream.
+  * @note   Data received and not yet consumed is lost.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Stop(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status;
+
+  if (huart->pRxStream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The abort of the reception detaches the stream */
+  status = HAL_UART_AbortReceive(huart);
+
+  return status;
+}
+
+/**
+  * @brief  Return the number of bytes received and not yet consumed from the Rx stream.
+  * @note   When the DMA has overwritten data not yet consumed, all the unread data is dropped
+  *         and added to the OverrunCount field of the stream.
+  * @note   This function and the other consumer functions must be called from a single context.
+  * @param  huart UART handle.
+  * @retval Number of bytes available
+  */
+uint32_t HAL_UARTEx_RxStream_Available(UART_HandleTypeDef *huart)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t nb_data;
+  uint32_t index;
+
+  if (pstream == NULL)
+  {
+    return 0U;
+  }
+
+  nb_data = UARTEx_RxStreamWriteCount(huart) - pstream->ReadCount;
+
+  if (nb_data > pstream->Size)
+  {
+    /* Overrun : skip the data received so far */
+    index = ((uint32_t)pstream->ReadIndex + nb_data) % pstream->Size;
+    pstream->ReadIndex = (uint16_t)index;
+    pstream->ReadCount += nb_data;
+    pstream->OverrunCount += nb_data;
+    nb_data = 0U;
+  }
+
+  /* Ensure the buffer is read after the write count */
+  __DMB();
+
+  return nb_data;
+}
+
+/**
+  * @brief  Give direct access to the received data of the Rx stream without copying it.
+  * @note   The returned length covers the data stored contiguously from the read position:
+  *         the data located after the buffer wrap is returned by a next call, once the first
+  *         part has been released with HAL_UARTEx_RxStream_Consume().
+  * @param  huart  UART handle.
+  * @param  ppData Pointer filled with the address of the first unread byte.
+  * @retval Number of contiguous bytes available at *ppData
+  */
+uint32_t HAL_UARTEx_RxStream_Peek(UART_HandleTypeDef *huart, const uint8_t **ppData)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t nb_data;
+  uint32_t nb_contiguous;
+
+  nb_data = HAL_UARTEx_RxStream_Available(huart);
+
+  if (nb_data == 0U)
+  {
+    return 0U;
+  }
+
+  nb_contiguous = (uint32_t)pstream->Size - pstream->ReadIndex;
+  if (nb_data < nb_contiguous)
+  {
+    nb_contiguous = nb_data;
+  }
+
+  *ppData = &pstream->pBuffer[pstream->ReadIndex];
+
+  return nb_contiguous;
+}
+
+/**
+  * @brief  Copy received data from the Rx stream and release it.
+  * @param  huart UART handle.
+  * @param  pData Pointer to the destination buffer.
+  * @param  Size  Maximum number of bytes to copy.
+  * @retval Number of bytes copied
+  */
+uint32_t HAL_UARTEx_RxStream_Read(UART_HandleTypeDef *huart, uint8_t *pData, uint32_t Size)
+{
+  const uint8_t *psrc = NULL;
+  uint32_t nb_copied = 0U;
+  uint32_t nb_data;
+  uint32_t count;
+
+  nb_data = HAL_UARTEx_RxStream_Peek(huart, &psrc);
+
+  /* The data may be stored in two parts when the buffer has wrapped */
+  while ((nb_data != 0U) && (nb_copied < Size))
+  {
+    if (nb_data > (Size - nb_copied))
+    {
+      nb_data = Size - nb_copied;
+    }
+
+    for (count = 0U; count < nb_data; count++)
+    {
+      pData[nb_copied + count] = psrc[count];
+    }
+    nb_copied += nb_data;
+
+    (void)HAL_UARTEx_RxStream_Consume(huart, nb_data);
+
+    nb_data = (nb_copied < Size) ? HAL_UARTEx_RxStream_Peek(huart, &psrc) : 0U;
+  }
+
+  return nb_copied;
+}
+
+/**
+  * @brief  Release data of the Rx stream once processed by the consumer.
+  * @param  huart UART handle.
+  * @param  Size  Number of bytes to release.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_RxStream_Consume(UART_HandleTypeDef *huart, uint32_t Size)
+{
+  UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t index;
+
+  if ((pstream == NULL) || (Size > (UARTEx_RxStreamWriteCount(huart) - pstream->ReadCount)))
+  {
+    return HAL_ERROR;
+  }
+
+  index = (uint32_t)pstream->ReadIndex + Size;
+  if (index >= pstream->Size)
+  {
+    index -= pstream->Size;
+  }
+  pstream->ReadIndex = (uint16_t)index;
+  pstream->ReadCount += Size;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Attach a Tx queue to the UART.
+  * @note   The Tx DMA channel must be configured in normal mode. While the queue is attached,
+  *         DMA transmissions must only be requested through HAL_UARTEx_TxQueue_Enqueue().
+  * @param  huart        UART handle.
+  * @param  pQueue       Pointer to the queue structure, owned by the caller while attached.
+  * @param  pBuffers     Pointer to the array of buffer descriptors used by the queue.
+  * @param  BufferNumber Number of descriptors of the array.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Init(UART_HandleTypeDef *huart, UART_TxQueueTypeDef *pQueue,
+                                          UART_TxBufferTypeDef *pBuffers, uint32_t BufferNumber)
+{
+  /* Check that a Tx process is not already ongoing */
+  if (huart->gState != HAL_UART_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((pQueue == NULL) || (pBuffers == NULL) || (BufferNumber == 0U) || (huart->hdmatx == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Buffers are chained on the DMA Transfer Complete event */
+  if (huart->hdmatx->Mode == DMA_LINKEDLIST_CIRCULAR)
+  {
+    return HAL_ERROR;
+  }
+
+  pQueue->pBuffers     = pBuffers;
+  pQueue->BufferNumber = BufferNumber;
+  pQueue->PutCount     = 0U;
+  pQueue->GetCount     = 0U;
+  pQueue->Active       = 0U;
+
+  huart->pTxQueue = pQueue;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Detach the Tx queue from the UART.
+  * @note   The ongoing transmission is aborted and the buffers not yet sent are dropped
+  *         without completion callback.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_DeInit(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status;
+
+  if (huart->pTxQueue == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  status = HAL_UART_AbortTransmit(huart);
+
+  huart->pTxQueue = NULL;
+
+  return status;
+}
+
+/**
+  * @brief  Add a buffer to the Tx queue.
+  * @note   The buffer is sent right away when the UART is idle, otherwise the DMA is restarted
+  *         on it as soon as the previous buffers have been read, without idle time on the line.
+  * @note   HAL_UARTEx_TxBufferCpltCallback() is executed with pContext once the buffer has been
+  *         read by the DMA; the buffer must not be modified before.
+  * @note   This function can be called from thread and interrupt contexts.
+  * @param  huart    UART handle.
+  * @param  pData    Pointer to data buffer (u8 or u16 data elements).
+  * @param  Size     Amount of data elements (u8 or u16) to be sent.
+  * @param  pContext Application cookie given back on completion.
+  * @retval HAL status (HAL_BUSY when the queue is full)
+  */
+HAL_StatusTypeDef HAL_UARTEx_TxQueue_Enqueue(UART_HandleTypeDef *huart, const uint8_t *pData, uint16_t Size,
+                                             void *pContext)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  UART_TxBufferTypeDef *pbuffer;
+  HAL_StatusTypeDef status = HAL_BUSY;
+  uint32_t primask;
+
+  if ((pqueue == NULL) || (pData == NULL) || (Size == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((pqueue->PutCount - pqueue->GetCount) < pqueue->BufferNumber)
+  {
+    pbuffer = &pqueue->pBuffers[pqueue->PutCount % pqueue->BufferNumber];
+    pbuffer->pData    = pData;
+    pbuffer->Size     = Size;
+    pbuffer->pContext = pContext;
+    pqueue->PutCount++;
+
+    /* Start the transmission if the UART is idle */
+    status = UART_TxQueueStart(huart);
+    if (status != HAL_OK)
+    {
+      pqueue->PutCount--;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @}
   */
@@ -1007,6 +1390,44 @@ static void UARTEx_Wakeup_AddressConfig(UART_HandleTypeDef *huart, UART_WakeUpTy
   MODIFY_REG(huart->Instance->CR2, USART_CR2_ADD, ((uint32_t)WakeUpSelection.Address << UART_CR2_ADDRESS_LSB_POS));
 }
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+/**
+  * @brief  Return the number of bytes written by the DMA since the start of the Rx stream.
+  * @note   The count is derived from a single read of the DMA counter and from the number of
+  *         buffer wraps counted by the DMA Transfer Complete interrupt: the wrap count is read
+  *         again after the DMA counter and the read is restarted if the interrupt ran in between.
+  * @note   A buffer wrap whose Transfer Complete interrupt is not served yet is detected from the
+  *         DMA Transfer Complete flag, sampled before and after the DMA counter.
+  * @param  huart UART handle.
+  * @retval Number of bytes written
+  */
+static uint32_t UARTEx_RxStreamWriteCount(const UART_HandleTypeDef *huart)
+{
+  const UART_RxStreamTypeDef *pstream = huart->pRxStream;
+  uint32_t wrap_count;
+  uint32_t position;
+  uint32_t write_count;
+  uint32_t tc_pending;
+
+  do
+  {
+    wrap_count = pstream->WrapCount;
+    tc_pending = __HAL_DMA_GET_FLAG(huart->hdmarx, DMA_FLAG_TC);
+    position = (uint32_t)pstream->Size - __HAL_DMA_GET_COUNTER(huart->hdmarx);
+  } while ((wrap_count != pstream->WrapCount) || (tc_pending != __HAL_DMA_GET_FLAG(huart->hdmarx, DMA_FLAG_TC)));
+
+  write_count = (wrap_count * pstream->Size) + position;
+
+  /* The DMA counter has already been reloaded for a buffer wrap not yet counted by the interrupt */
+  if (tc_pending != 0U)
+  {
+    write_count += pstream->Size;
+  }
+
+  return write_count;
+}
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 /**
   * @brief Calculate the number of data to process in RX/TX ISR.
   * @note The RX FIFO depth and the TX FIFO depth is extracted from
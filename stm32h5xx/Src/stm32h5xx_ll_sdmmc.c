@@ -961,6 +961,31 @@ uint32_t SDMMC_CmdBusWidth(SDMMC_TypeDef *SDMMCx, uint32_t BusWidth)
   return errorstate;
 }
 
+/**
+  * @brief  Send the Set Write Block Erase Count command (ACMD23) and check the response.
+  * @note   SDMMC_CmdAppCommand() must be sent with the card RCA before this command.
+  * @param  SDMMCx: Pointer to SDMMC register base
+  * @param  NbBlocks: Number of blocks to be pre-erased before the next multiple block write
+  * @retval HAL status
+  */
+uint32_t SDMMC_CmdSetWrBlkEraseCount(SDMMC_TypeDef *SDMMCx, uint32_t NbBlocks)
+{
+  SDMMC_CmdInitTypeDef  sdmmc_cmdinit;
+  uint32_t errorstate;
+
+  sdmmc_cmdinit.Argument         = (uint32_t)(NbBlocks & 0x007FFFFFU);
+  sdmmc_cmdinit.CmdIndex         = SDMMC_CMD_SD_APP_SET_WR_BLK_ERASE_COUNT;
+  sdmmc_cmdinit.Response         = SDMMC_RESPONSE_SHORT;
+  sdmmc_cmdinit.WaitForInterrupt = SDMMC_WAIT_NO;
+  sdmmc_cmdinit.CPSM             = SDMMC_CPSM_ENABLE;
+  (void)SDMMC_SendCommand(SDMMCx, &sdmmc_cmdinit);
+
+  /* Check for error conditions */
+  errorstate = SDMMC_GetCmdResp1(SDMMCx, SDMMC_CMD_SD_APP_SET_WR_BLK_ERASE_COUNT, SDMMC_CMDTIMEOUT);
+
+  return errorstate;
+}
+
 /**
   * @brief  Send the Send SCR command and check the response.
   * @param  SDMMCx: Pointer to SDMMC register base
@@ -175,6 +175,7 @@ extern "C" {
 #define VDD_VALUE          3300UL /*!< Value of VDD in mv */
 #define TICK_INT_PRIORITY  ((1UL<<__NVIC_PRIO_BITS) - 1UL)  /*!< tick interrupt priority (lowest by default) */
 #define USE_RTOS           0U
+#define USE_HAL_ATOMIC_LOCK 0U
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -466,6 +466,42 @@ typedef struct
   uint32_t                    TimestampSubsecondInc;        /*!< Subsecond Increment */
 
 } ETH_PTP_ConfigTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH PTP Clock Servo Configuration Structure definition
+  */
+typedef struct
+{
+  uint32_t                    BaseAddend;                   /*!< Addend value giving the nominal PTP clock frequency */
+  uint32_t                    Kp;                           /*!< Proportional gain in Q16 fixed point, in ppb of
+                                                                 frequency correction per ns of offset */
+  uint32_t                    Ki;                           /*!< Integral gain in Q16 fixed point, in ppb of
+                                                                 frequency correction per ns of offset */
+  uint32_t                    MaxFreqAdj;                   /*!< Maximum frequency correction in ppb. BaseAddend
+                                                                 corrected by MaxFreqAdj must fit in 32 bits */
+  uint32_t                    StepThreshold;                /*!< Offsets above this value in ns are corrected by
+                                                                 stepping the time, smaller ones by slewing the
+                                                                 frequency.
+                                                                 This parameter can be a value from 1 to 1000000000 */
+} ETH_PTP_ServoConfigTypeDef;
+/**
+  *
+  */
+
+/**
+  * @brief  ETH PTP Clock Servo Structure definition
+  */
+typedef struct
+{
+  ETH_PTP_ServoConfigTypeDef  Init;                         /*!< Servo configuration */
+  int64_t                     Integral;                     /*!< Integral term in Q16 fixed point ppb */
+  int32_t                     FreqAdj;                      /*!< Last frequency correction in ppb, positive when the
+                                                                 PTP clock is sped up */
+  uint32_t                    Addend;                       /*!< Addend value matching FreqAdj */
+} ETH_PTP_ServoTypeDef;
 /**
   *
   */
@@ -504,6 +540,15 @@ typedef  void (*pETH_txFreeCallbackTypeDef)(uint32_t *buffer);  /*!< pointer to
   *
   */
 
+/**
+  * @brief  HAL ETH Tx Free Burst Function definition
+  */
+typedef  void (*pETH_txFreeBurstCallbackTypeDef)(uint32_t **buffer,
+                                                  uint32_t Count); /*!< pointer to an ETH Tx Free Burst function */
+/**
+  *
+  */
+
 /**
   * @brief  HAL ETH Tx Free Function definition
   */
@@ -581,6 +626,7 @@ typedef struct
   pETH_rxAllocateCallbackTypeDef  rxAllocateCallback;  /*!< ETH Rx Get Buffer Function   */
   pETH_rxLinkCallbackTypeDef      rxLinkCallback; /*!< ETH Rx Set App Data Function */
   pETH_txFreeCallbackTypeDef      txFreeCallback;       /*!< ETH Tx Free Function         */
+  pETH_txFreeBurstCallbackTypeDef txFreeBurstCallback;  /*!< ETH Tx Free Burst Function   */
   pETH_txPtpCallbackTypeDef       txPtpCallback;  /*!< ETH Tx Handle Ptp Function */
 
 } ETH_HandleTypeDef;
@@ -1489,6 +1535,15 @@ typedef struct
   * @}
   */
 
+/** @defgroup ETH_PTP_Servo_Action ETH PTP Servo Action
+  * @{
+  */
+#define HAL_ETH_PTP_SERVO_SLEW            0x00000000U    /*!< Offset corrected by tuning the addend      */
+#define HAL_ETH_PTP_SERVO_STEP            0x00000001U    /*!< Offset corrected by stepping the PTP time  */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -1710,6 +1765,8 @@ HAL_StatusTypeDef HAL_ETH_Stop(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_Stop_IT(ETH_HandleTypeDef *heth);
 
 HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff);
+HAL_StatusTypeDef HAL_ETH_ReadDataBurst(ETH_HandleTypeDef *heth, void **pAppBuff, uint32_t Count,
+                                        uint32_t *pRxCount, ETH_TimeStampTypeDef *pTimeStamps);
 HAL_StatusTypeDef HAL_ETH_RegisterRxAllocateCallback(ETH_HandleTypeDef *heth,
                                                      pETH_rxAllocateCallbackTypeDef rxAllocateCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterRxAllocateCallback(ETH_HandleTypeDef *heth);
@@ -1719,6 +1776,10 @@ HAL_StatusTypeDef HAL_ETH_GetRxDataErrorCode(const ETH_HandleTypeDef *heth, uint
 HAL_StatusTypeDef HAL_ETH_RegisterTxFreeCallback(ETH_HandleTypeDef *heth, pETH_txFreeCallbackTypeDef txFreeCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterTxFreeCallback(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_RegisterTxFreeBurstCallback(ETH_HandleTypeDef *heth,
+                                                     pETH_txFreeBurstCallbackTypeDef txFreeBurstCallback);
+HAL_StatusTypeDef HAL_ETH_UnRegisterTxFreeBurstCallback(ETH_HandleTypeDef *heth);
+HAL_StatusTypeDef HAL_ETH_ReleaseTxPacketBurst(ETH_HandleTypeDef *heth);
 
 #ifdef HAL_ETH_USE_PTP
 HAL_StatusTypeDef HAL_ETH_PTP_SetConfig(ETH_HandleTypeDef *heth, ETH_PTP_ConfigTypeDef *ptpconfig);
@@ -1730,12 +1791,17 @@ HAL_StatusTypeDef HAL_ETH_PTP_AddTimeOffset(ETH_HandleTypeDef *heth, ETH_PtpUpda
 HAL_StatusTypeDef HAL_ETH_PTP_InsertTxTimestamp(ETH_HandleTypeDef *heth);
 HAL_StatusTypeDef HAL_ETH_PTP_GetTxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeStampTypeDef *timestamp);
 HAL_StatusTypeDef HAL_ETH_PTP_GetRxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeStampTypeDef *timestamp);
+HAL_StatusTypeDef HAL_ETH_PTP_ServoInit(ETH_PTP_ServoTypeDef *pServo, const ETH_PTP_ServoConfigTypeDef *pConfig);
+uint32_t          HAL_ETH_PTP_ServoCompute(ETH_PTP_ServoTypeDef *pServo, int64_t Offset);
+HAL_StatusTypeDef HAL_ETH_PTP_ServoUpdate(ETH_HandleTypeDef *heth, ETH_PTP_ServoTypeDef *pServo, int64_t Offset);
 HAL_StatusTypeDef HAL_ETH_RegisterTxPtpCallback(ETH_HandleTypeDef *heth, pETH_txPtpCallbackTypeDef txPtpCallback);
 HAL_StatusTypeDef HAL_ETH_UnRegisterTxPtpCallback(ETH_HandleTypeDef *heth);
 #endif /* HAL_ETH_USE_PTP */
 
 HAL_StatusTypeDef HAL_ETH_Transmit(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig, uint32_t Timeout);
 HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig);
+HAL_StatusTypeDef HAL_ETH_TransmitBurst_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig,
+                                           uint32_t Count, uint32_t *pTxCount);
 
 HAL_StatusTypeDef HAL_ETH_WritePHYRegister(const ETH_HandleTypeDef *heth, uint32_t PHYAddr, uint32_t PHYReg,
                                            uint32_t RegValue);
@@ -1752,6 +1818,7 @@ void              HAL_ETH_WakeUpCallback(ETH_HandleTypeDef *heth);
 void              HAL_ETH_RxAllocateCallback(uint8_t **buff);
 void              HAL_ETH_RxLinkCallback(void **pStart, void **pEnd, uint8_t *buff, uint16_t Length);
 void              HAL_ETH_TxFreeCallback(uint32_t *buff);
+void              HAL_ETH_TxFreeBurstCallback(uint32_t **buff, uint32_t Count);
 void              HAL_ETH_TxPtpCallback(uint32_t *buff, ETH_TimeStampTypeDef *timestamp);
 /**
   * @}
@@ -167,11 +167,18 @@
 #define  VDD_VALUE                    (3300UL) /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            (0x0FUL) /*!< tick interrupt priority */
 #define  USE_RTOS                     0
+#define  USE_HAL_ATOMIC_LOCK          0U       /*!< use atomic handle locks */
 #define  USE_SD_TRANSCEIVER           0U       /*!< use uSD Transceiver */
 #define  USE_SPI_CRC                  1U       /*!< use CRC in SPI */
 #define  USE_FLASH_ECC                0U       /*!< use ECC error management in FLASH */
 #define  USE_SDIO_TRANSCEIVER         0U       /*!< use SDIO Transceiver */
 #define  SDIO_MAX_IO_NUMBER           7U       /*!< SDIO device support maximum IO number */
+#define  USE_HAL_DMA_DCACHE_MAINTENANCE 0U     /*!< use D-cache maintenance in the DMA based APIs */
+#define  HAL_DMA_BOUNCE_BUFFER_NBR    2U       /*!< number of bounce buffers for unaligned DMA receptions */
+#define  HAL_DMA_BOUNCE_BUFFER_SIZE   256U     /*!< size in bytes of a bounce buffer, multiple of 32 */
+#define  HAL_DMA_BOUNCE_BUFFER_SECTION ".dma_buffer" /*!< linker section of the bounce buffers, in AXI or D2 SRAM */
+#define  HAL_PCD_DMA_BOUNCE_BUFFER_NBR  2U     /*!< number of bounce buffers for unaligned USB OTG DMA transfers */
+#define  HAL_PCD_DMA_BOUNCE_BUFFER_SIZE 512U   /*!< size in bytes of a USB OTG bounce buffer, multiple of 32 */
 
 #define  USE_HAL_ADC_REGISTER_CALLBACKS     0U /* ADC register callback disabled     */
 #define  USE_HAL_CEC_REGISTER_CALLBACKS     0U /* CEC register callback disabled     */
@@ -226,6 +233,8 @@
 /* ########################### Ethernet Configuration ######################### */
 #define ETH_TX_DESC_CNT         4U  /* number of Ethernet Tx DMA descriptors */
 #define ETH_RX_DESC_CNT         4U  /* number of Ethernet Rx DMA descriptors */
+#define USE_HAL_ETH_SPLIT_DESCRIPTORS  0U /* Rx buffer addresses kept outside the DMA descriptors */
+#define ETH_DESC_SKIP_LENGTH    0U  /* 64-bit words of padding after each descriptor (split layout) */
 
 #define ETH_MAC_ADDR0    (0x02UL)
 #define ETH_MAC_ADDR1    (0x00UL)
@@ -27,6 +27,23 @@
 /* Includes ------------------------------------------------------------------*/
 #include "stm32h7xx_hal_def.h"
 
+#ifndef USE_HAL_DMA_DCACHE_MAINTENANCE
+/* For backward compatibility, if USE_HAL_DMA_DCACHE_MAINTENANCE not defined, define it to 0 */
+#define USE_HAL_DMA_DCACHE_MAINTENANCE 0U
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+#ifndef HAL_DMA_BOUNCE_BUFFER_NBR
+#define HAL_DMA_BOUNCE_BUFFER_NBR  2U
+#endif /* HAL_DMA_BOUNCE_BUFFER_NBR */
+#ifndef HAL_DMA_BOUNCE_BUFFER_SIZE
+#define HAL_DMA_BOUNCE_BUFFER_SIZE 256U
+#endif /* HAL_DMA_BOUNCE_BUFFER_SIZE */
+#ifndef HAL_DMA_BOUNCE_BUFFER_SECTION
+#define HAL_DMA_BOUNCE_BUFFER_SECTION ".dma_buffer"
+#endif /* HAL_DMA_BOUNCE_BUFFER_SECTION */
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 /** @addtogroup STM32H7xx_HAL_Driver
   * @{
   */
@@ -327,6 +344,23 @@ uint32_t HAL_GetCurrentCPUID(void);
   * @}
   */
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+/** @addtogroup CORTEX_Exported_Functions_Group3
+  * @{
+  */
+/* DMA data cache maintenance functions ***************************************/
+/* Called by the UART and SPI DMA based APIs only: the SDMMC and ETH drivers are not wired,
+   their buffers must be kept coherent by the application */
+void HAL_DCACHE_CleanForDMA(const void *pBuffer, uint32_t Size);
+HAL_StatusTypeDef HAL_DCACHE_PrepareRxDMA(const void *pOwner, uint8_t *pBuffer, uint32_t Size,
+                                          uint8_t **ppDmaBuffer);
+void HAL_DCACHE_SyncRxDMA(const void *pOwner, uint8_t *pBuffer, uint32_t Size);
+void HAL_DCACHE_ReleaseRxDMA(const void *pOwner);
+/**
+  * @}
+  */
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 /**
   * @}
   */
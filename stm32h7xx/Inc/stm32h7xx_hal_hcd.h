@@ -78,6 +78,7 @@ typedef struct
   __IO HCD_StateTypeDef     State;      /*!< HCD communication state  */
   __IO  uint32_t            ErrorCode;  /*!< HCD Error code           */
   void                      *pData;     /*!< Pointer Stack Handler    */
+  struct __HCD_URBTypeDef   *pURBQueue[16]; /*!< Host channels URB queues */
 #if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
   void (* SOFCallback)(struct __HCD_HandleTypeDef *hhcd);                               /*!< USB OTG HCD SOF callback                */
   void (* ConnectCallback)(struct __HCD_HandleTypeDef *hhcd);                           /*!< USB OTG HCD Connect callback            */
@@ -91,6 +92,29 @@ typedef struct
   void (* MspDeInitCallback)(struct __HCD_HandleTypeDef *hhcd);                         /*!< USB OTG HCD Msp DeInit callback         */
 #endif /* USE_HAL_HCD_REGISTER_CALLBACKS */
 } HCD_HandleTypeDef;
+
+/**
+  * @brief  HCD queued URB structure definition
+  */
+typedef struct __HCD_URBTypeDef
+{
+  uint8_t   direction;    /*!< 0: OUT, 1: IN                                                            */
+  uint8_t   ep_type;      /*!< Endpoint type, see HAL_HCD_HC_SubmitRequest()                            */
+  uint8_t   token;        /*!< 0: HC_PID_SETUP, 1: HC_PID_DATA1                                         */
+  uint8_t   do_ping;      /*!< Activate the do ping protocol (high speed only)                          */
+  uint8_t   *pbuff;       /*!< URB data                                                                 */
+  uint16_t  length;       /*!< URB data length                                                          */
+  uint16_t  interval;     /*!< Interrupt endpoints: resubmission period in SOF, 0 for a single transfer */
+  uint32_t  nak_budget;   /*!< NAKs retried by the driver before completing with URB_NOTREADY,
+                               0 for no limit                                                           */
+  void (* XferCpltCallback)(HCD_HandleTypeDef *hhcd,
+                            struct __HCD_URBTypeDef *pURB); /*!< Completion callback, NULL when not used */
+  HCD_URBStateTypeDef urb_state; /*!< URB final state                                                   */
+  uint32_t  xfer_count;   /*!< Number of bytes transferred                                              */
+  uint32_t  nak_count;    /*!< NAKs retried by the driver                                               */
+  uint32_t  sof_count;    /*!< SOF left before the next interrupt poll, 0 when not waiting              */
+  struct __HCD_URBTypeDef *next; /*!< Next URB queued on the channel                                    */
+} HCD_URBTypeDef;
 /**
   * @}
   */
@@ -258,6 +282,8 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd, uint8_t ch_n
                                            uint8_t direction, uint8_t ep_type,
                                            uint8_t token, uint8_t *pbuff,
                                            uint16_t length, uint8_t do_ping);
+HAL_StatusTypeDef HAL_HCD_HC_EnqueueURB(HCD_HandleTypeDef *hhcd, uint8_t ch_num, HCD_URBTypeDef *pURB);
+HAL_StatusTypeDef HAL_HCD_HC_FlushURBQueue(HCD_HandleTypeDef *hhcd, uint8_t ch_num);
 
 HAL_StatusTypeDef HAL_HCD_HC_SetHubInfo(HCD_HandleTypeDef *hhcd, uint8_t ch_num,
                                         uint8_t addr, uint8_t PortNbr);
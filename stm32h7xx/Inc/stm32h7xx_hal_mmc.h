@@ -107,6 +107,31 @@ typedef struct
 
 } HAL_MMC_CardInfoTypeDef;
 
+/**
+  * @brief  MMC queued request structure definition
+  */
+typedef struct __MMC_RequestTypeDef
+{
+  uint32_t                     Direction;        /*!< Transfer direction, see @ref MMC_Exported_Constansts_Group8 */
+
+  uint32_t                     Flags;            /*!< Transfer options, see @ref MMC_Exported_Constansts_Group8   */
+
+  uint8_t                      *pData;           /*!< Pointer to the data buffer, accessible by the SDMMC IDMA    */
+
+  uint32_t                     BlockAdd;         /*!< Address of the first block                                  */
+
+  uint32_t                     NumberOfBlocks;   /*!< Number of blocks to transfer                                */
+
+  __IO uint32_t                Status;           /*!< Request status, see @ref MMC_Exported_Constansts_Group8     */
+
+  uint32_t                     ErrorCode;        /*!< MMC error code of the transaction the request was part of   */
+
+  void (* XferCpltCallback)(struct __MMC_RequestTypeDef *pRequest); /*!< Called when the request retires, can be NULL */
+
+  struct __MMC_RequestTypeDef  *pNext;           /*!< Next queued request, managed by the driver                  */
+
+} MMC_RequestTypeDef;
+
 /**
   * @brief  MMC handle Structure definition
   */
@@ -146,6 +171,8 @@ typedef struct
 
   uint32_t                     Ext_CSD[128];
 
+  MMC_RequestTypeDef           *pRequestQueue;   /*!< Queued requests, the active ones first */
+
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
   void (* TxCpltCallback)(struct __MMC_HandleTypeDef *hmmc);
   void (* RxCpltCallback)(struct __MMC_HandleTypeDef *hmmc);
@@ -343,6 +370,7 @@ typedef void (*pMMC_CallbackTypeDef)(MMC_HandleTypeDef *hmmc);
 #define   MMC_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
 #define   MMC_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   MMC_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */
+#define   MMC_CONTEXT_QUEUE                ((uint32_t)0x00000100U)  /*!< Transfer of the request queue    */
 
 /**
   * @}
@@ -425,6 +453,27 @@ typedef uint32_t HAL_MMC_PartitionTypeDef;
   * @}
   */
 
+/** @defgroup MMC_Exported_Constansts_Group8 MMC Request definitions
+  * @{
+  */
+#define MMC_REQUEST_READ                 0x00000000U  /*!< Read blocks from the card                    */
+#define MMC_REQUEST_WRITE                0x00000001U  /*!< Write blocks to the card                     */
+
+#define MMC_REQUEST_FLAG_NONE            0x00000000U  /*!< Normal transfer                              */
+#define MMC_REQUEST_FLAG_RELIABLE_WRITE  0x00000001U  /*!< Reliable write, never merged with others     */
+
+#define MMC_REQUEST_IDLE                 0x00000000U  /*!< Request not queued                           */
+#define MMC_REQUEST_PENDING              0x00000001U  /*!< Request queued, waiting for the bus          */
+#define MMC_REQUEST_ACTIVE               0x00000002U  /*!< Request being transferred                    */
+#define MMC_REQUEST_DONE                 0x00000003U  /*!< Request completed successfully               */
+#define MMC_REQUEST_ERROR                0x00000004U  /*!< Request failed, see its ErrorCode            */
+#define MMC_REQUEST_ABORTED              0x00000005U  /*!< Request removed from the queue before start  */
+
+#define MMC_REQUEST_MAX_BLOCKS           0x0000FFFFU  /*!< Maximum number of blocks of one transaction  */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -703,6 +752,10 @@ HAL_StatusTypeDef HAL_MMC_RegisterCallback(MMC_HandleTypeDef *hmmc, HAL_MMC_Call
                                            pMMC_CallbackTypeDef pCallback);
 HAL_StatusTypeDef HAL_MMC_UnRegisterCallback(MMC_HandleTypeDef *hmmc, HAL_MMC_CallbackIDTypeDef CallbackId);
 #endif /* USE_HAL_MMC_REGISTER_CALLBACKS */
+
+/* Request queue (DMA) */
+HAL_StatusTypeDef HAL_MMC_QueueRequest(MMC_HandleTypeDef *hmmc, MMC_RequestTypeDef *pRequest);
+HAL_StatusTypeDef HAL_MMC_QueueFlush(MMC_HandleTypeDef *hmmc);
 /**
   * @}
   */
@@ -127,6 +127,13 @@ typedef struct
 
   NAND_DeviceConfigTypeDef       Config;     /*!< NAND physical characteristic information structure    */
 
+  MDMA_HandleTypeDef             *hmdma;     /*!< Pointer to MDMA handler used by the _MDMA page APIs    */
+
+  uint32_t                       *pBBT;      /*!< Bad block table cache, NULL when not used             */
+
+  FunctionalState                CacheReadEnable; /*!< Cache read commands used by HAL_NAND_Read_Page_8b_MDMA(),
+                                                       set by HAL_NAND_ConfigCacheRead()                      */
+
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
   void (* MspInitCallback)(struct __NAND_HandleTypeDef *hnand);               /*!< NAND Msp Init callback              */
   void (* MspDeInitCallback)(struct __NAND_HandleTypeDef *hnand);             /*!< NAND Msp DeInit callback            */
@@ -175,6 +182,12 @@ typedef void (*pNAND_CallbackTypeDef)(NAND_HandleTypeDef *hnand);
 #define __HAL_NAND_RESET_HANDLE_STATE(__HANDLE__) ((__HANDLE__)->State = HAL_NAND_STATE_RESET)
 #endif /* USE_HAL_NAND_REGISTER_CALLBACKS */
 
+/** @brief Size of a bad block table cache
+  * @param  __BLOCKNBR__ total number of blocks of the NAND memory.
+  * @retval Size of the table in 32-bit words
+  */
+#define NAND_BBT_SIZE(__BLOCKNBR__) (((((uint32_t)(__BLOCKNBR__)) + 31U) / 32U) * 2U)
+
 /**
   * @}
   */
@@ -194,6 +207,7 @@ HAL_StatusTypeDef  HAL_NAND_Init(NAND_HandleTypeDef *hnand, FMC_NAND_PCC_TimingT
 HAL_StatusTypeDef  HAL_NAND_DeInit(NAND_HandleTypeDef *hnand);
 
 HAL_StatusTypeDef  HAL_NAND_ConfigDevice(NAND_HandleTypeDef *hnand, const NAND_DeviceConfigTypeDef *pDeviceConfig);
+HAL_StatusTypeDef  HAL_NAND_ConfigCacheRead(NAND_HandleTypeDef *hnand, FunctionalState CacheReadEnable);
 
 HAL_StatusTypeDef  HAL_NAND_Read_ID(NAND_HandleTypeDef *hnand, NAND_IDTypeDef *pNAND_ID);
 
@@ -235,6 +249,18 @@ HAL_StatusTypeDef  HAL_NAND_Erase_Block(NAND_HandleTypeDef *hnand, const NAND_Ad
 
 uint32_t           HAL_NAND_Address_Inc(const NAND_HandleTypeDef *hnand, NAND_AddressTypeDef *pAddress);
 
+HAL_StatusTypeDef  HAL_NAND_Read_Page_8b_MDMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                              uint8_t *pBuffer, uint32_t NumPageToRead, uint32_t *pECC,
+                                              uint32_t Timeout);
+HAL_StatusTypeDef  HAL_NAND_Write_Page_8b_MDMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                               const uint8_t *pBuffer, uint32_t NumPageToWrite, uint32_t *pECC,
+                                               uint32_t Timeout);
+
+HAL_StatusTypeDef  HAL_NAND_BBT_Init(NAND_HandleTypeDef *hnand, uint32_t *pTable);
+HAL_StatusTypeDef  HAL_NAND_BBT_IsBadBlock(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                           uint32_t *pIsBad);
+HAL_StatusTypeDef  HAL_NAND_BBT_MarkBadBlock(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress);
+
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
 /* NAND callback registering/unregistering */
 HAL_StatusTypeDef  HAL_NAND_RegisterCallback(NAND_HandleTypeDef *hnand, HAL_NAND_CallbackIDTypeDef CallbackId,
@@ -289,6 +315,8 @@ uint32_t              HAL_NAND_Read_Status(const NAND_HandleTypeDef *hnand);
 #define NAND_CMD_AREA_B            ((uint8_t)0x01)
 #define NAND_CMD_AREA_C            ((uint8_t)0x50)
 #define NAND_CMD_AREA_TRUE1        ((uint8_t)0x30)
+#define NAND_CMD_CACHE_READ        ((uint8_t)0x31)
+#define NAND_CMD_CACHE_READ_END    ((uint8_t)0x3F)
 
 #define NAND_CMD_WRITE0            ((uint8_t)0x80)
 #define NAND_CMD_WRITE_TRUE1       ((uint8_t)0x10)
@@ -260,6 +260,41 @@ typedef struct
                                         This parameter can be a value between 1 and 256 */
 } OSPIM_CfgTypeDef;
 
+/**
+  * @brief HAL OSPI SFDP read command settings structure definition
+  */
+typedef struct
+{
+  uint32_t Instruction;            /*!< Read instruction, on 16 bits for the 8D-8D-8D mode                */
+  uint32_t DummyCycles;            /*!< Number of wait states before the data phase                       */
+  uint32_t ModeClocks;             /*!< Number of mode bit clocks between the address and the wait states */
+} OSPI_SFDPReadTypeDef;
+
+/**
+  * @brief HAL OSPI SFDP flash parameters structure definition
+  */
+typedef struct
+{
+  uint32_t Revision;               /*!< Revision of the Basic Flash Parameter Table, major revision in bits 15:8
+                                        and minor revision in bits 7:0 */
+  uint32_t DeviceSize;             /*!< Number of address bits required to access the whole device, to be used
+                                        as OSPI_InitTypeDef.DeviceSize */
+  uint32_t AddressSize;            /*!< Address size of the read and program commands.
+                                        This parameter is a value of @ref OSPI_AddressSize */
+  uint32_t PageSize;               /*!< Program page size in bytes */
+  uint32_t QuadEnable;             /*!< Quad Enable Requirements field of the Basic Flash Parameter Table
+                                        (JESD216 15th DWORD, bits 22:20), HAL_OSPI_SFDP_QER_UNKNOWN when
+                                        the table does not describe it */
+  uint32_t ProgramInstruction;     /*!< Page program instruction for the 1S-1S-1S, 2S-2S-2S and 4S-4S-4S
+                                        modes, 0 when no program instruction matches AddressSize */
+  uint32_t ReadModes;              /*!< Read modes supported by the device.
+                                        This parameter is a combination of @ref OSPI_SFDP_ReadMode */
+  OSPI_SFDPReadTypeDef Read[8];    /*!< Read command settings, indexed by the bit position of the mode
+                                        in ReadModes */
+  uint32_t OctalDtrDummyCycles[4]; /*!< 8D-8D-8D wait states at 100, 133, 166 and 200 MHz, 0 when the
+                                        frequency is not supported or not described */
+} OSPI_SFDPTypeDef;
+
 #if defined (USE_HAL_OSPI_REGISTER_CALLBACKS) && (USE_HAL_OSPI_REGISTER_CALLBACKS == 1U)
 /**
   * @brief  HAL OSPI Callback ID enumeration definition
@@ -671,6 +706,31 @@ typedef void (*pOSPI_CallbackTypeDef)(OSPI_HandleTypeDef *hospi);
 #define HAL_OSPIM_IOPORT_7_HIGH            ((uint32_t)(OCTOSPIM_PCR_IOHEN | 0x7U))                          /*!< Port 7 - IO[7:4] */
 #define HAL_OSPIM_IOPORT_8_LOW             ((uint32_t)(OCTOSPIM_PCR_IOLEN | 0x8U))                          /*!< Port 8 - IO[3:0] */
 #define HAL_OSPIM_IOPORT_8_HIGH            ((uint32_t)(OCTOSPIM_PCR_IOHEN | 0x8U))                          /*!< Port 8 - IO[7:4] */
+/**
+  * @}
+  */
+
+/** @defgroup OSPI_SFDP_ReadMode OSPI SFDP Read Mode
+  * @{
+  */
+#define HAL_OSPI_SFDP_READ_1S_1S_1S          ((uint32_t)0x00000001U)                                         /*!< Fast read on a single line                    */
+#define HAL_OSPI_SFDP_READ_1S_1S_2S          ((uint32_t)0x00000002U)                                         /*!< Fast read with data on two lines              */
+#define HAL_OSPI_SFDP_READ_1S_2S_2S          ((uint32_t)0x00000004U)                                         /*!< Fast read with address and data on two lines  */
+#define HAL_OSPI_SFDP_READ_2S_2S_2S          ((uint32_t)0x00000008U)                                         /*!< Fast read with all phases on two lines        */
+#define HAL_OSPI_SFDP_READ_1S_1S_4S          ((uint32_t)0x00000010U)                                         /*!< Fast read with data on four lines             */
+#define HAL_OSPI_SFDP_READ_1S_4S_4S          ((uint32_t)0x00000020U)                                         /*!< Fast read with address and data on four lines */
+#define HAL_OSPI_SFDP_READ_4S_4S_4S          ((uint32_t)0x00000040U)                                         /*!< Fast read with all phases on four lines       */
+#define HAL_OSPI_SFDP_READ_8D_8D_8D          ((uint32_t)0x00000080U)                                         /*!< DTR fast read with all phases on eight lines  */
+#define HAL_OSPI_SFDP_READ_ALL               ((uint32_t)0x000000FFU)                                         /*!< All the read modes                            */
+/**
+  * @}
+  */
+
+/** @defgroup OSPI_SFDP_Constants OSPI SFDP Constants
+  * @{
+  */
+#define HAL_OSPI_SFDP_SIGNATURE              ((uint32_t)0x50444653U)                                         /*!< "SFDP" signature of the SFDP header    */
+#define HAL_OSPI_SFDP_QER_UNKNOWN            ((uint32_t)0x000000FFU)                                         /*!< Quad enable requirements not described */
 /**
   * @}
   */
@@ -878,6 +938,22 @@ uint32_t              HAL_OSPI_GetState(const OSPI_HandleTypeDef *hospi);
   */
 HAL_StatusTypeDef     HAL_OSPIM_Config(OSPI_HandleTypeDef *hospi, OSPIM_CfgTypeDef *cfg, uint32_t Timeout);
 
+/**
+  * @}
+  */
+
+/* OSPI SFDP discovery functions  *********************************************/
+/** @addtogroup OSPI_Exported_Functions_Group5
+  * @{
+  */
+HAL_StatusTypeDef     HAL_OSPI_SFDP_Read(OSPI_HandleTypeDef *hospi, uint32_t Address, uint8_t *pData, uint32_t Size,
+                                         uint32_t Timeout);
+HAL_StatusTypeDef     HAL_OSPI_SFDP_Parse(const uint8_t *pSfdp, uint32_t Size, OSPI_SFDPTypeDef *pInfo);
+HAL_StatusTypeDef     HAL_OSPI_SFDP_GetReadCmd(const OSPI_SFDPTypeDef *pInfo, uint32_t Modes, uint32_t ClockFreq,
+                                               OSPI_RegularCmdTypeDef *cmd);
+HAL_StatusTypeDef     HAL_OSPI_SFDP_MemoryMapped(OSPI_HandleTypeDef *hospi, const OSPI_SFDPTypeDef *pInfo,
+                                                 uint32_t Modes, uint32_t ClockFreq, OSPI_MemoryMappedTypeDef *cfg);
+
 /**
   * @}
   */
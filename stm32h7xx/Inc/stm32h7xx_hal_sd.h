@@ -147,6 +147,15 @@ typedef struct
 
   uint32_t                     CID[4];           /*!< SD card identification number table */
 
+  struct __SD_StreamTypeDef    *pStream;         /*!< Streaming write attached to the handle */
+
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+  uint32_t                     TuningPhase;      /*!< Delay block phase selected by the last tuning */
+
+  __IO uint32_t                TuningCrcErrors;  /*!< Data CRC errors since the last tuning       */
+
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
 #if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
   void (* TxCpltCallback)(struct __SD_HandleTypeDef *hsd);
   void (* RxCpltCallback)(struct __SD_HandleTypeDef *hsd);
@@ -293,6 +302,41 @@ typedef void (*pSD_TransceiverCallbackTypeDef)(FlagStatus status);
   * @}
   */
 #endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+
+/** @defgroup SD_Exported_Types_Group9 SD streaming write structure definition
+  * @{
+  */
+typedef struct __SD_StreamTypeDef
+{
+  SD_HandleTypeDef             *hsd;             /*!< SD handle the stream writes to                             */
+
+  const uint8_t                **pQueue;         /*!< Ring of NbSlots buffer pointers, provided by the user      */
+
+  uint32_t                     NbSlots;          /*!< Number of buffers the ring can hold                        */
+
+  uint32_t                     BufferBlocks;     /*!< Size of every queued buffer in blocks                      */
+
+  uint32_t                     BlockAdd;         /*!< Card block receiving the first buffer of the stream        */
+
+  __IO uint32_t                State;            /*!< Stream state, value of @ref SD_Exported_Constansts_Group6  */
+
+  __IO uint32_t                Head;             /*!< Ring index of the oldest buffer not yet released           */
+
+  __IO uint32_t                Count;            /*!< Buffers queued and not yet released                        */
+
+  uint32_t                     SegmentCount;     /*!< Buffers of the running data segment not yet released       */
+
+  uint32_t                     SegmentPending;   /*!< Buffers of the running data segment not yet given to IDMA  */
+
+  __IO uint32_t                BufferCount;      /*!< Buffers written since the stream was opened                */
+
+  __IO uint32_t                Stalls;           /*!< Times the card had to wait for the producer                */
+
+  void (* BufferCpltCallback)(struct __SD_StreamTypeDef *hstream, const uint8_t *pData); /*!< Can be NULL */
+} SD_StreamTypeDef;
+/**
+  * @}
+  */
 /**
   * @}
   */
@@ -361,6 +405,7 @@ typedef void (*pSD_TransceiverCallbackTypeDef)(FlagStatus status);
 #define   SD_CONTEXT_WRITE_MULTIPLE_BLOCK ((uint32_t)0x00000020U)  /*!< Write multiple blocks operation  */
 #define   SD_CONTEXT_IT                   ((uint32_t)0x00000008U)  /*!< Process in Interrupt mode        */
 #define   SD_CONTEXT_DMA                  ((uint32_t)0x00000080U)  /*!< Process in DMA mode              */
+#define   SD_CONTEXT_STREAM               ((uint32_t)0x00000100U)  /*!< Streaming write in DMA mode      */
 
 /**
   * @}
@@ -391,6 +436,30 @@ typedef void (*pSD_TransceiverCallbackTypeDef)(FlagStatus status);
   * @}
   */
 
+/** @defgroup SD_Exported_Constansts_Group5 SD sampling point tuning
+  * @{
+  */
+#ifndef SD_RETUNE_CRC_ERRORS
+#define SD_RETUNE_CRC_ERRORS     3U   /*!< Data CRC errors after which the sampling point is tuned again
+                                           before the next transfer, 0 disables the automatic re-tuning */
+#endif /* SD_RETUNE_CRC_ERRORS */
+/**
+  * @}
+  */
+
+/** @defgroup SD_Exported_Constansts_Group6 SD streaming write states
+  * @{
+  */
+#define SD_STREAM_STATE_IDLE       0x00000000U  /*!< Stream closed                                          */
+#define SD_STREAM_STATE_OPEN       0x00000001U  /*!< Stream opened, no buffer written yet                   */
+#define SD_STREAM_STATE_RUNNING    0x00000002U  /*!< Queued buffers are being written                       */
+#define SD_STREAM_STATE_STARVED    0x00000003U  /*!< All queued buffers written, the card waits for more    */
+#define SD_STREAM_STATE_CLOSING    0x00000004U  /*!< Close requested, the last queued buffers are written   */
+#define SD_STREAM_STATE_ERROR      0x00000005U  /*!< Stream ended by a transfer error or an abort           */
+/**
+  * @}
+  */
+
 /**
   * @}
   */
@@ -648,6 +717,11 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
                                         uint32_t NumberOfBlocks);
 HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *pData, uint32_t BlockAdd,
                                          uint32_t NumberOfBlocks);
+/* Non-Blocking mode: streaming write */
+HAL_StatusTypeDef HAL_SD_StreamOpen(SD_HandleTypeDef *hsd, SD_StreamTypeDef *hstream, uint32_t BlockAdd);
+HAL_StatusTypeDef HAL_SD_StreamWrite(SD_StreamTypeDef *hstream, const uint8_t *pData);
+HAL_StatusTypeDef HAL_SD_StreamClose(SD_StreamTypeDef *hstream);
+uint32_t          HAL_SD_StreamGetFreeSlots(const SD_StreamTypeDef *hstream);
 
 void              HAL_SD_IRQHandler(SD_HandleTypeDef *hsd);
 
@@ -683,6 +757,9 @@ HAL_StatusTypeDef HAL_SD_UnRegisterTransceiverCallback(SD_HandleTypeDef *hsd);
   */
 HAL_StatusTypeDef HAL_SD_ConfigWideBusOperation(SD_HandleTypeDef *hsd, uint32_t WideMode);
 HAL_StatusTypeDef HAL_SD_ConfigSpeedBusOperation(SD_HandleTypeDef *hsd, uint32_t SpeedMode);
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+HAL_StatusTypeDef HAL_SD_ExecuteTuning(SD_HandleTypeDef *hsd);
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
 /**
   * @}
   */
@@ -58,11 +58,22 @@
 
       (#) When data is received user can call the following API to get received data:
           (##) HAL_ETH_ReadData(): Read a received packet
+          (##) HAL_ETH_ReadDataBurst(): Read several received packets in one pass,
+               the consumed Rx descriptors are refilled once at the end
 
-      (#) For transmission path, two APIs are available:
+      (#) For transmission path, four APIs are available:
          (##) HAL_ETH_Transmit(): Transmit an ETH frame in blocking mode
          (##) HAL_ETH_Transmit_IT(): Transmit an ETH frame in interrupt mode,
               HAL_ETH_TxCpltCallback() will be executed when end of transfer occur
+         (##) HAL_ETH_TransmitBurst_IT(): Transmit several ETH frames in interrupt mode
+              with a single start of the Tx DMA
+         (##) HAL_ETH_TransmitTSO_IT(): Transmit a large TCP payload in interrupt mode,
+              the MAC splits it into MSS sized segments, each one carrying a copy of
+              the template header. TCPSegmentation must be enabled in the DMA
+              configuration, see HAL_ETH_SetDMAConfig()
+      (#) The transmitted buffers are given back with HAL_ETH_ReleaseTxPacket(), one
+          HAL_ETH_TxFreeCallback() per packet, or with HAL_ETH_ReleaseTxPacketBurst(),
+          a single HAL_ETH_TxFreeBurstCallback() for all the completed packets
 
       (#) Communication with an external PHY device:
          (##) HAL_ETH_ReadPHYRegister(): Read a register from an external PHY
@@ -75,6 +86,11 @@
       (#) Configure the Ethernet DMA after ETH peripheral initialization
           (##) HAL_ETH_GetDMAConfig(): Get DMA actual configuration into ETH_DMAConfigTypeDef
           (##) HAL_ETH_SetDMAConfig(): Set DMA configuration based on ETH_DMAConfigTypeDef
+          (##) HAL_ETH_GetItCoalescingConfig(): Get the interrupt coalescing configuration
+               into ETH_ItCoalescingConfigTypeDef
+          (##) HAL_ETH_SetItCoalescingConfig(): Set the interrupt coalescing configuration
+               based on ETH_ItCoalescingConfigTypeDef, one Rx/Tx complete interrupt per
+               descriptor or packet is used by default
 
       (#) Configure the Ethernet PTP after ETH peripheral initialization
           (##) Define HAL_ETH_USE_PTP to use PTP APIs.
@@ -87,6 +103,10 @@
           (##) HAL_ETH_PTP_InsertTxTimestamp(): Insert Timestamp in transmission
           (##) HAL_ETH_PTP_GetTxTimestamp(): Get transmission timestamp
           (##) HAL_ETH_PTP_GetRxTimestamp(): Get reception timestamp
+          (##) HAL_ETH_PTP_ServoInit(): Initialize a fixed-point PI clock servo
+          (##) HAL_ETH_PTP_ServoUpdate(): Feed the servo with a measured offset from the master,
+               the PTP time is stepped or its frequency slewed through the Addend register
+          (##) HAL_ETH_PTP_ServoCompute(): Servo math only, without any register access
 
       -@- The ARP offload feature is not supported in this driver.
 
@@ -121,6 +141,9 @@
   For specific callbacks TxFreeCallback use dedicated register callbacks:
   respectively HAL_ETH_RegisterTxFreeCallback().
 
+  For specific callbacks TxFreeBurstCallback use dedicated register callbacks:
+  respectively HAL_ETH_RegisterTxFreeBurstCallback().
+
   For specific callbacks TxPtpCallback use dedicated register callbacks:
   respectively HAL_ETH_RegisterTxPtpCallback().
 
@@ -147,6 +170,9 @@
   For specific callbacks TxFreeCallback use dedicated unregister callbacks:
   respectively HAL_ETH_UnRegisterTxFreeCallback().
 
+  For specific callbacks TxFreeBurstCallback use dedicated unregister callbacks:
+  respectively HAL_ETH_UnRegisterTxFreeBurstCallback().
+
   For specific callbacks TxPtpCallback use dedicated unregister callbacks:
   respectively HAL_ETH_UnRegisterTxPtpCallback().
 
@@ -223,6 +249,12 @@
 #define ETH_MACSTSUR_VALUE            0xFFFFFFFFU
 #define ETH_MACSTNUR_VALUE            0xBB9ACA00U
 #define ETH_SEGMENT_SIZE_DEFAULT      0x218U
+
+#if (USE_HAL_ETH_SPLIT_DESCRIPTORS == 1U)
+#define ETH_DMACCR_DSL_VALUE          ((uint32_t)ETH_DESC_SKIP_LENGTH << ETH_DMACCR_DSL_Pos)
+#else
+#define ETH_DMACCR_DSL_VALUE          ETH_DMACCR_DSL_64BIT
+#endif /* USE_HAL_ETH_SPLIT_DESCRIPTORS */
 /**
   * @}
   */
@@ -244,6 +276,13 @@
                                              if ((inx) >= (uint32_t)ETH_RX_DESC_CNT){\
                                              (inx) = ((inx) - (uint32_t)ETH_RX_DESC_CNT);}\
                                            } while (0)
+
+/* Rx buffer address attached to a descriptor, kept in the handle with the split descriptor layout */
+#if (USE_HAL_ETH_SPLIT_DESCRIPTORS == 1U)
+#define ETH_RX_BACKUP_ADDR(heth, inx)   ((heth)->RxDescList.RxBackupAddr[(inx)])
+#else
+#define ETH_RX_BACKUP_ADDR(heth, inx)   (((ETH_DMADescTypeDef *)(heth)->RxDescList.RxDesc[(inx)])->BackupAddr0)
+#endif /* USE_HAL_ETH_SPLIT_DESCRIPTORS */
 /**
   * @}
   */
@@ -258,6 +297,9 @@ static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth);
 static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth);
 static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_TxPacketConfigTypeDef *pTxConfig,
                                            uint32_t ItMode);
+static void ETH_RequestTxCompleteIT(ETH_TxDescListTypeDef *dmatxdesclist);
+static uint32_t ETH_ReleaseTxDescriptors(ETH_HandleTypeDef *heth, uint32_t **pBuff);
+static uint8_t ETH_GetRxPacket(ETH_HandleTypeDef *heth);
 static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth);
 
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
@@ -298,6 +340,14 @@ static HAL_StatusTypeDef HAL_ETH_PTP_AddendUpdate(ETH_HandleTypeDef *heth, int32
         (++) Tx DMA Descriptors Tab
         (++) Length of Rx Buffers
 
+      (+) By default the Rx buffer addresses are stored in the DMA descriptors themselves.
+          Set USE_HAL_ETH_SPLIT_DESCRIPTORS to 1U in the hal_conf file to keep them in the
+          handle instead: the descriptor tabs then only hold the hardware words and can be
+          packed in a DMA-visible (non-cacheable) region, while the bookkeeping read by
+          HAL_ETH_ReadData() stays in cacheable RAM. ETH_DESC_SKIP_LENGTH sets the number
+          of 64-bit padding words the DMA skips after each descriptor (e.g. 2U for a
+          32-byte stride matching the Cortex-M7 cache line).
+
       (+) Call the function HAL_ETH_DeInit() to restore the default configuration
           of the selected ETH peripheral.
 
@@ -386,8 +436,8 @@ HAL_StatusTypeDef HAL_ETH_Init(ETH_HandleTypeDef *heth)
   /*------------------ MAC, MTL and DMA default Configuration ----------------*/
   ETH_MACDMAConfig(heth);
 
-  /* SET DSL to 64 bit */
-  MODIFY_REG(heth->Instance->DMACCR, ETH_DMACCR_DSL, ETH_DMACCR_DSL_64BIT);
+  /* Set DSL to the descriptor skip length of the selected layout */
+  MODIFY_REG(heth->Instance->DMACCR, ETH_DMACCR_DSL, ETH_DMACCR_DSL_VALUE);
 
   /* Set Receive Buffers Length (must be a multiple of 4) */
   if ((heth->Init.RxBuffLen % 0x4U) != 0x0U)
@@ -1017,12 +1067,15 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
       return HAL_ERROR;
     }
 
-    /* Ensure completion of descriptor preparation before transmission start */
-    __DSB();
-
     /* Incr current tx desc index */
     INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U);
 
+    /* The packet ends the transmission: it raises the Tx complete interrupt */
+    ETH_RequestTxCompleteIT(&heth->TxDescList);
+
+    /* Ensure completion of descriptor preparation before transmission start */
+    __DSB();
+
     /* Start transmission */
     /* issue a poll command to Tx DMA by writing address of next immediate free descriptor */
     WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(heth->TxDescList.TxDesc[heth->TxDescList.CurTxDesc]));
@@ -1036,6 +1089,136 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
   }
 }
 
+/**
+  * @brief  Sends up to Count Ethernet packets in interrupt mode in one pass.
+  * @note   The packets are queued back to back in the Tx descriptor ring and the
+  *         Tx DMA is started once for the whole burst.
+  * @note   Queuing stops at the first packet that does not fit in the Tx descriptor
+  *         ring, pTxCount then holds the number of packets actually queued.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTxConfig: Pointer to an array of Count packet configurations.
+  * @param  Count: Number of packets to transmit.
+  * @param  pTxCount: Pointer to the number of packets actually queued.
+  * @retval HAL status, HAL_ERROR if not all the packets could be queued
+  */
+HAL_StatusTypeDef HAL_ETH_TransmitBurst_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig,
+                                           uint32_t Count, uint32_t *pTxCount)
+{
+  uint32_t txcount = 0U;
+  uint32_t txstatus = HAL_ETH_ERROR_NONE;
+
+  if ((pTxConfig == NULL) || (pTxCount == NULL) || (Count == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  while ((txcount < Count) && (txstatus == HAL_ETH_ERROR_NONE))
+  {
+    /* Save the packet pointer to release.  */
+    heth->TxDescList.CurrentPacketAddress = (uint32_t *)pTxConfig[txcount].pData;
+
+    /* Config DMA Tx descriptor by Tx Packet info */
+    txstatus = ETH_Prepare_Tx_Descriptors(heth, &pTxConfig[txcount], 1U);
+
+    if (txstatus == HAL_ETH_ERROR_NONE)
+    {
+      /* Incr current tx desc index */
+      INCR_TX_DESC_INDEX(heth->TxDescList.CurTxDesc, 1U);
+      txcount++;
+    }
+  }
+
+  if (txcount != 0U)
+  {
+    /* The last queued packet ends the burst: it raises the Tx complete interrupt */
+    ETH_RequestTxCompleteIT(&heth->TxDescList);
+
+    /* Ensure completion of descriptor preparation before transmission start */
+    __DSB();
+
+    /* Start transmission */
+    /* issue a poll command to Tx DMA by writing address of next immediate free descriptor */
+    WRITE_REG(heth->Instance->DMACTDTPR, (uint32_t)(heth->TxDescList.TxDesc[heth->TxDescList.CurTxDesc]));
+  }
+
+  *pTxCount = txcount;
+
+  if (txstatus != HAL_ETH_ERROR_NONE)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Sends a TCP payload in interrupt mode with TCP segmentation offload.
+  * @note   A context descriptor carries the MSS, followed by the header descriptor
+  *         and the payload descriptors. The MAC then builds each segment from the
+  *         template header, updating the IP length and identification, the TCP
+  *         sequence number, flags and checksums.
+  * @note   The template header must not contain IP or TCP options beyond
+  *         TCPHeaderLen, and the IP and TCP checksum fields are recomputed by the MAC.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTSOConfig: Hold the configuration of the TCP payload to be segmented
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_TransmitTSO_IT(ETH_HandleTypeDef *heth, const ETH_TSOPacketConfigTypeDef *pTSOConfig)
+{
+  ETH_TxPacketConfigTypeDef txconfig = {0};
+  const ETH_BufferTypeDef *txbuffer;
+  uint32_t payloadlen = 0U;
+
+  if ((pTSOConfig == NULL) || (pTSOConfig->Header == NULL) || (pTSOConfig->Header->next == NULL))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* Sum up the payload buffers following the header buffer */
+  txbuffer = pTSOConfig->Header->next;
+  while (txbuffer != NULL)
+  {
+    payloadlen += txbuffer->len;
+    txbuffer = txbuffer->next;
+  }
+
+  if ((pTSOConfig->TCPHeaderLen < 0x5U) || (pTSOConfig->TCPHeaderLen > 0xFU) ||
+      (pTSOConfig->MaxSegmentSize < 0x40U) || (pTSOConfig->MaxSegmentSize > ETH_DMATXCDESC_MSS) ||
+      (pTSOConfig->PayloadLen == 0U) || (pTSOConfig->PayloadLen > ETH_DMATXNDESCRF_TPL) ||
+      (payloadlen != pTSOConfig->PayloadLen))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  /* The TCP segmentation must be enabled on the Tx DMA channel */
+  if (READ_BIT(heth->Instance->DMACTCR, ETH_DMACTCR_TSE) == 0U)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  txconfig.Attributes = ETH_TX_PACKETS_FEATURES_TSO;
+  txconfig.Length = pTSOConfig->Header->len + pTSOConfig->PayloadLen;
+  txconfig.TxBuffer = pTSOConfig->Header;
+  txconfig.MaxSegmentSize = pTSOConfig->MaxSegmentSize;
+  txconfig.PayloadLen = pTSOConfig->PayloadLen;
+  txconfig.TCPHeaderLen = pTSOConfig->TCPHeaderLen;
+  txconfig.pData = pTSOConfig->pData;
+
+  return HAL_ETH_Transmit_IT(heth, &txconfig);
+}
+
 /**
   * @brief  Read a received packet.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1045,14 +1228,7 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
   */
 HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
 {
-  uint32_t descidx;
-  uint32_t descidx_next;
-  ETH_DMADescTypeDef *dmarxdesc_next;
-  ETH_DMADescTypeDef *dmarxdesc;
-  uint32_t desccnt = 0U;
-  uint32_t desccntmax;
-  uint32_t bufflength;
-  uint8_t rxdataready = 0U;
+  uint8_t rxdataready;
 
   if (pAppBuff == NULL)
   {
@@ -1065,6 +1241,121 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
     return HAL_ERROR;
   }
 
+  /* Get the next received packet */
+  rxdataready = ETH_GetRxPacket(heth);
+
+  if ((heth->RxDescList.RxBuildDescCnt) != 0U)
+  {
+    /* Update Descriptors */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  if (rxdataready == 1U)
+  {
+    /* Return received packet */
+    *pAppBuff = heth->RxDescList.pRxStart;
+    /* Reset first element */
+    heth->RxDescList.pRxStart = NULL;
+
+    return HAL_OK;
+  }
+
+  /* Packet not ready */
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Read up to Count received packets in one pass.
+  * @note   The Rx descriptors consumed by the whole burst are given back to
+  *         the DMA at the end, with a single update of the Rx tail pointer.
+  * @note   HAL_ETH_GetRxDataErrorCode() returns the error state of the last
+  *         packet of the burst.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pAppBuff: Pointer to an array of Count application buffer pointers
+  *         to receive the packets.
+  * @param  Count: Maximum number of packets to read.
+  * @param  pRxCount: Pointer to the number of packets actually read.
+  * @param  pTimeStamps: Pointer to an array of Count timestamps receiving the Rx timestamp of
+  *         each packet, as HAL_ETH_PTP_GetRxTimestamp() would return it after HAL_ETH_ReadData().
+  *         Can be NULL when the timestamps are not needed.
+  * @retval HAL status, HAL_ERROR if no packet is ready
+  */
+HAL_StatusTypeDef HAL_ETH_ReadDataBurst(ETH_HandleTypeDef *heth, void **pAppBuff, uint32_t Count,
+                                        uint32_t *pRxCount, ETH_TimeStampTypeDef *pTimeStamps)
+{
+  uint32_t rxcount = 0U;
+  uint8_t rxdataready = 1U;
+
+  if ((pAppBuff == NULL) || (pRxCount == NULL) || (Count == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  while ((rxcount < Count) && (rxdataready != 0U))
+  {
+    rxdataready = ETH_GetRxPacket(heth);
+
+    if (rxdataready != 0U)
+    {
+      /* Return received packet */
+      pAppBuff[rxcount] = heth->RxDescList.pRxStart;
+      /* Reset first element */
+      heth->RxDescList.pRxStart = NULL;
+
+      if (pTimeStamps != NULL)
+      {
+        /* Return the timestamp before the next packet overwrites it */
+        pTimeStamps[rxcount].TimeStampLow = heth->RxDescList.TimeStamp.TimeStampLow;
+        pTimeStamps[rxcount].TimeStampHigh = heth->RxDescList.TimeStamp.TimeStampHigh;
+      }
+      rxcount++;
+    }
+  }
+
+  if ((heth->RxDescList.RxBuildDescCnt) != 0U)
+  {
+    /* Update Descriptors */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  *pRxCount = rxcount;
+
+  if (rxcount == 0U)
+  {
+    /* Packet not ready */
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Walk the Rx descriptors owned by the application and link the
+  *         buffers of the next received packet.
+  * @note   The consumed descriptors are only accounted in RxBuildDescCnt,
+  *         they are given back to the DMA by ETH_UpdateDescriptor().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval 1 if a complete packet is linked in pRxStart, 0 otherwise
+  */
+static uint8_t ETH_GetRxPacket(ETH_HandleTypeDef *heth)
+{
+  uint32_t descidx;
+  uint32_t descidx_next;
+  ETH_DMADescTypeDef *dmarxdesc_next;
+  ETH_DMADescTypeDef *dmarxdesc;
+  uint32_t desccnt = 0U;
+  uint32_t desccntmax;
+  uint32_t bufflength;
+  uint8_t rxdataready = 0U;
+
   descidx = heth->RxDescList.RxDescIdx;
   dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList.RxDesc[descidx];
   desccntmax = ETH_RX_DESC_CNT - heth->RxDescList.RxBuildDescCnt;
@@ -1116,17 +1407,17 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
       /*Call registered Link callback*/
       heth->rxLinkCallback(&heth->RxDescList.pRxStart, &heth->RxDescList.pRxEnd,
-                           (uint8_t *)dmarxdesc->BackupAddr0, bufflength);
+                           (uint8_t *)ETH_RX_BACKUP_ADDR(heth, descidx), bufflength);
 #else
       /* Link callback */
       HAL_ETH_RxLinkCallback(&heth->RxDescList.pRxStart, &heth->RxDescList.pRxEnd,
-                             (uint8_t *)dmarxdesc->BackupAddr0, (uint16_t) bufflength);
+                             (uint8_t *)ETH_RX_BACKUP_ADDR(heth, descidx), (uint16_t) bufflength);
 #endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
       heth->RxDescList.RxDescCnt++;
       heth->RxDescList.RxDataLength += bufflength;
 
       /* Clear buffer pointer */
-      dmarxdesc->BackupAddr0 = 0;
+      ETH_RX_BACKUP_ADDR(heth, descidx) = 0U;
     }
 
     /* Increment current rx descriptor index */
@@ -1137,26 +1428,9 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
   }
 
   heth->RxDescList.RxBuildDescCnt += desccnt;
-  if ((heth->RxDescList.RxBuildDescCnt) != 0U)
-  {
-    /* Update Descriptors */
-    ETH_UpdateDescriptor(heth);
-  }
-
   heth->RxDescList.RxDescIdx = descidx;
 
-  if (rxdataready == 1U)
-  {
-    /* Return received packet */
-    *pAppBuff = heth->RxDescList.pRxStart;
-    /* Reset first element */
-    heth->RxDescList.pRxStart = NULL;
-
-    return HAL_OK;
-  }
-
-  /* Packet not ready */
-  return HAL_ERROR;
+  return rxdataready;
 }
 
 /**
@@ -1183,7 +1457,7 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
   while ((desccount > 0U) && (allocStatus != 0U))
   {
     /* Check if a buffer's attached the descriptor */
-    if (READ_REG(dmarxdesc->BackupAddr0) == 0U)
+    if (READ_REG(ETH_RX_BACKUP_ADDR(heth, descidx)) == 0U)
     {
       /* Get a new buffer. */
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
@@ -1199,20 +1473,22 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
       }
       else
       {
-        WRITE_REG(dmarxdesc->BackupAddr0, (uint32_t)buff);
+        WRITE_REG(ETH_RX_BACKUP_ADDR(heth, descidx), (uint32_t)buff);
         WRITE_REG(dmarxdesc->DESC0, (uint32_t)buff);
       }
     }
     else
     {
       /* Descriptor was used as a context descriptor, buffer still unused */
-      WRITE_REG(dmarxdesc->DESC0, (uint32_t)dmarxdesc->BackupAddr0);
+      WRITE_REG(dmarxdesc->DESC0, ETH_RX_BACKUP_ADDR(heth, descidx));
     }
 
     if (allocStatus != 0U)
     {
-
-      if (heth->RxDescList.ItMode != 0U)
+      /* Only request the Rx complete interrupt on every Nth descriptor when coalescing is enabled,
+         the Rx interrupt watchdog raises it for the descriptors in between */
+      if ((heth->RxDescList.ItMode != 0U) &&
+          ((heth->RxDescList.ItCoalescing <= 1U) || (((descidx + 1U) % heth->RxDescList.ItCoalescing) == 0U)))
       {
         WRITE_REG(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN | ETH_DMARXNDESCRF_BUF1V | ETH_DMARXNDESCRF_IOC);
       }
@@ -1415,98 +1691,96 @@ __weak void HAL_ETH_TxFreeCallback(uint32_t *buff)
 }
 
 /**
-  * @brief  Release transmitted Tx packets.
+  * @brief  Set the Tx free burst function.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
   *         the configuration information for ETHERNET module
+  * @param  txFreeBurstCallback: pointer to function to release a burst of packets
   * @retval HAL status
   */
-HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth)
+HAL_StatusTypeDef HAL_ETH_RegisterTxFreeBurstCallback(ETH_HandleTypeDef *heth,
+                                                     pETH_txFreeBurstCallbackTypeDef txFreeBurstCallback)
 {
-  ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList;
-  uint32_t numOfBuf =  dmatxdesclist->BuffersInUse;
-  uint32_t idx =       dmatxdesclist->releaseIndex;
-  uint8_t pktTxStatus = 1U;
-  uint8_t pktInUse;
-#ifdef HAL_ETH_USE_PTP
-  ETH_TimeStampTypeDef *timestamp = &heth->TxTimestamp;
-#endif /* HAL_ETH_USE_PTP */
-
-  /* Loop through buffers in use.  */
-  while ((numOfBuf != 0U) && (pktTxStatus != 0U))
+  if (txFreeBurstCallback == NULL)
   {
-    pktInUse = 1U;
-    numOfBuf--;
-    /* If no packet, just examine the next packet.  */
-    if (dmatxdesclist->PacketAddress[idx] == NULL)
-    {
-      /* No packet in use, skip to next.  */
-      INCR_TX_DESC_INDEX(idx, 1U);
-      pktInUse = 0U;
-    }
+    /* No callback to save */
+    return HAL_ERROR;
+  }
 
-    if (pktInUse != 0U)
-    {
-      /* Determine if the packet has been transmitted.  */
-      if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCRF_OWN) == 0U)
-      {
-#ifdef HAL_ETH_USE_PTP
+  /* Set function to free a burst of transmitted packets */
+  heth->txFreeBurstCallback = txFreeBurstCallback;
 
-        /* Disable Ptp transmission */
-        CLEAR_BIT(heth->Init.TxDesc[idx].DESC2, ETH_DMATXNDESCRF_TTSE);
+  return HAL_OK;
+}
 
-        if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_LD)
-            && (heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_TTSS))
-        {
-          /* Get timestamp low */
-          timestamp->TimeStampLow = heth->Init.TxDesc[idx].DESC0;
-          /* Get timestamp high */
-          timestamp->TimeStampHigh = heth->Init.TxDesc[idx].DESC1;
-        }
-        else
-        {
-          timestamp->TimeStampHigh = timestamp->TimeStampLow = UINT32_MAX;
-        }
-#endif /* HAL_ETH_USE_PTP */
+/**
+  * @brief  Unregister the Tx free burst callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_UnRegisterTxFreeBurstCallback(ETH_HandleTypeDef *heth)
+{
+  /* Set function to free a burst of transmitted packets */
+  heth->txFreeBurstCallback = HAL_ETH_TxFreeBurstCallback;
 
-#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
-        /*Call registered callbacks*/
-#ifdef HAL_ETH_USE_PTP
-        /* Handle Ptp  */
-        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
-        {
-          heth->txPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
-        }
-#endif  /* HAL_ETH_USE_PTP */
-        /* Release the packet.  */
-        heth->txFreeCallback(dmatxdesclist->PacketAddress[idx]);
-#else
-        /* Call callbacks */
-#ifdef HAL_ETH_USE_PTP
-        /* Handle Ptp  */
-        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
-        {
-          HAL_ETH_TxPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
-        }
-#endif  /* HAL_ETH_USE_PTP */
-        /* Release the packet.  */
-        HAL_ETH_TxFreeCallback(dmatxdesclist->PacketAddress[idx]);
-#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tx Free Burst callback.
+  * @param  buff: pointer to an array of Count buffers to free, in transmission order
+  * @param  Count: number of buffers to free
+  * @retval None
+  */
+__weak void HAL_ETH_TxFreeBurstCallback(uint32_t **buff, uint32_t Count)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(buff);
+  UNUSED(Count);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_TxFreeBurstCallback could be implemented in the user file
+  */
+}
+
+/**
+  * @brief  Release transmitted Tx packets.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth)
+{
+  (void)ETH_ReleaseTxDescriptors(heth, NULL);
 
-        /* Clear the entry in the in-use array.  */
-        dmatxdesclist->PacketAddress[idx] = NULL;
+  return HAL_OK;
+}
 
-        /* Update the transmit relesae index and number of buffers in use.  */
-        INCR_TX_DESC_INDEX(idx, 1U);
-        dmatxdesclist->BuffersInUse = numOfBuf;
-        dmatxdesclist->releaseIndex = idx;
-      }
-      else
-      {
-        /* Get out of the loop!  */
-        pktTxStatus = 0U;
-      }
-    }
+/**
+  * @brief  Release transmitted Tx packets with a single callback.
+  * @note   All the completed packets are handed in one call to
+  *         HAL_ETH_TxFreeBurstCallback(), in transmission order.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ReleaseTxPacketBurst(ETH_HandleTypeDef *heth)
+{
+  uint32_t *txbuff[ETH_TX_DESC_CNT];
+  uint32_t txcount;
+
+  txcount = ETH_ReleaseTxDescriptors(heth, txbuff);
+
+  if (txcount != 0U)
+  {
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+    /*Call registered Tx free burst callback*/
+    heth->txFreeBurstCallback(txbuff, txcount);
+#else
+    /* Tx free burst callback */
+    HAL_ETH_TxFreeBurstCallback(txbuff, txcount);
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
   }
+
   return HAL_OK;
 }
 
@@ -1874,6 +2148,153 @@ HAL_StatusTypeDef HAL_ETH_PTP_GetRxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeSt
   }
 }
 
+/**
+  * @brief  Initialize a PTP clock servo.
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure holding the servo state
+  * @param  pConfig: pointer to a ETH_PTP_ServoConfigTypeDef structure that contains
+  *         the servo gains and thresholds
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ServoInit(ETH_PTP_ServoTypeDef *pServo, const ETH_PTP_ServoConfigTypeDef *pConfig)
+{
+  uint64_t maxaddend;
+
+  if ((pServo == NULL) || (pConfig == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The fastest corrected frequency must still fit in the Addend register */
+  maxaddend = (uint64_t)pConfig->BaseAddend +
+              (((uint64_t)pConfig->BaseAddend * pConfig->MaxFreqAdj) / 1000000000U);
+
+  if ((pConfig->BaseAddend == 0U) || (pConfig->MaxFreqAdj >= 1000000000U) || (maxaddend > 0xFFFFFFFFU) ||
+      (pConfig->StepThreshold == 0U) || (pConfig->StepThreshold > 1000000000U))
+  {
+    return HAL_ERROR;
+  }
+
+  pServo->Init = *pConfig;
+  pServo->Integral = 0;
+  pServo->FreqAdj = 0;
+  pServo->Addend = pConfig->BaseAddend;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run one iteration of the PTP clock servo.
+  * @note   This function only updates the servo state, it has no register access.
+  *         The PI output, in ppb, is Kp * Offset plus the integral of Ki * Offset,
+  *         both gains in Q16 fixed point, clamped to MaxFreqAdj.
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure holding the servo state
+  * @param  Offset: offset of the local clock from the master in ns, once the mean
+  *         path delay has been removed. Positive when the local clock is ahead.
+  * @retval Action to apply, a value of @ref ETH_PTP_Servo_Action
+  */
+uint32_t HAL_ETH_PTP_ServoCompute(ETH_PTP_ServoTypeDef *pServo, int64_t Offset)
+{
+  int64_t maxadj = (int64_t)pServo->Init.MaxFreqAdj;
+  int64_t ppb;
+
+  if ((Offset > (int64_t)pServo->Init.StepThreshold) || (Offset < -(int64_t)pServo->Init.StepThreshold))
+  {
+    /* Too far from the master: step the time and keep the current frequency correction */
+    return HAL_ETH_PTP_SERVO_STEP;
+  }
+
+  /* Integral term, clamped to the correction range to avoid windup */
+  pServo->Integral += (int64_t)pServo->Init.Ki * Offset;
+  if (pServo->Integral > (maxadj * 65536))
+  {
+    pServo->Integral = maxadj * 65536;
+  }
+  else if (pServo->Integral < -(maxadj * 65536))
+  {
+    pServo->Integral = -(maxadj * 65536);
+  }
+  else
+  {
+    /* Integral term within range */
+  }
+
+  ppb = (((int64_t)pServo->Init.Kp * Offset) + pServo->Integral) / 65536;
+  if (ppb > maxadj)
+  {
+    ppb = maxadj;
+  }
+  else if (ppb < -maxadj)
+  {
+    ppb = -maxadj;
+  }
+  else
+  {
+    /* Correction within range */
+  }
+
+  /* A local clock ahead of the master is slowed down */
+  pServo->FreqAdj = (int32_t)(-ppb);
+  pServo->Addend = (uint32_t)((int64_t)pServo->Init.BaseAddend +
+                              (((int64_t)pServo->Init.BaseAddend * pServo->FreqAdj) / 1000000000));
+
+  return HAL_ETH_PTP_SERVO_SLEW;
+}
+
+/**
+  * @brief  Discipline the PTP clock with a measured offset from the master.
+  * @note   Offsets above StepThreshold are removed with HAL_ETH_PTP_AddTimeOffset(),
+  *         smaller ones are slewed by writing the servo addend.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure holding the servo state
+  * @param  Offset: offset of the local clock from the master in ns, once the mean
+  *         path delay has been removed. Positive when the local clock is ahead.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ServoUpdate(ETH_HandleTypeDef *heth, ETH_PTP_ServoTypeDef *pServo, int64_t Offset)
+{
+  ETH_TimeTypeDef timeoffset;
+  uint64_t absoffset;
+
+  if (pServo == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (heth->IsPtpConfigured != HAL_ETH_PTP_CONFIGURED)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_ETH_PTP_ServoCompute(pServo, Offset) == HAL_ETH_PTP_SERVO_STEP)
+  {
+    absoffset = (Offset < 0) ? (uint64_t)(-Offset) : (uint64_t)Offset;
+    timeoffset.Seconds = (uint32_t)(absoffset / 1000000000U);
+    timeoffset.NanoSeconds = (uint32_t)(absoffset % 1000000000U);
+
+    /* Move the local time back when it is ahead of the master */
+    (void)HAL_ETH_PTP_AddTimeOffset(heth, (Offset > 0) ? HAL_ETH_PTP_NEGATIVE_UPDATE : HAL_ETH_PTP_POSITIVE_UPDATE,
+                                    &timeoffset);
+
+    /* Wait for the time update to complete */
+    while ((heth->Instance->MACTSCR & ETH_MACTSCR_TSUPDT) != 0U)
+    {
+
+    }
+  }
+
+  /* Write the servo addend, the time offset update also altered the register */
+  WRITE_REG(heth->Instance->MACTSAR, pServo->Addend);
+
+  SET_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSADDREG);
+  while ((heth->Instance->MACTSCR & ETH_MACTSCR_TSADDREG) != 0U)
+  {
+
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Register the Tx Ptp callback.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -2489,6 +2910,74 @@ HAL_StatusTypeDef HAL_ETH_SetDMAConfig(ETH_HandleTypeDef *heth,  ETH_DMAConfigTy
   }
 }
 
+/**
+  * @brief  Get the interrupt coalescing configuration.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pItConfig: pointer to a ETH_ItCoalescingConfigTypeDef structure that will hold
+  *         the interrupt coalescing configuration.
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_ETH_GetItCoalescingConfig(const ETH_HandleTypeDef *heth,
+                                                ETH_ItCoalescingConfigTypeDef *pItConfig)
+{
+  if (pItConfig == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  pItConfig->RxInterruptWatchdog = READ_BIT(heth->Instance->DMACRIWTR, ETH_DMACRIWTR_RWT);
+  pItConfig->RxInterruptCoalescing = heth->RxDescList.ItCoalescing;
+  pItConfig->TxInterruptCoalescing = heth->TxDescList.ItCoalescing;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the interrupt coalescing configuration.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pItConfig: pointer to a ETH_ItCoalescingConfigTypeDef structure that contains
+  *         the interrupt coalescing configuration.
+  * @note   The Rx threshold applies to the descriptors given back to the DMA after this call.
+  * @note   The Tx threshold applies within a call to HAL_ETH_TransmitBurst_IT(): the last packet
+  *         queued by HAL_ETH_Transmit_IT() or HAL_ETH_TransmitBurst_IT() always raises the
+  *         Tx complete interrupt, so that its buffers are reclaimed without waiting for more traffic.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_SetItCoalescingConfig(ETH_HandleTypeDef *heth,
+                                                const ETH_ItCoalescingConfigTypeDef *pItConfig)
+{
+  if (pItConfig == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Rx interrupt coalescing needs the Rx interrupt watchdog to bound the reception latency */
+  if ((pItConfig->RxInterruptCoalescing == 0U) || (pItConfig->RxInterruptCoalescing > ETH_RX_DESC_CNT) ||
+      (pItConfig->TxInterruptCoalescing == 0U) || (pItConfig->TxInterruptCoalescing > ETH_TX_DESC_CNT) ||
+      (pItConfig->RxInterruptWatchdog > 0xFFU) ||
+      ((pItConfig->RxInterruptCoalescing > 1U) && (pItConfig->RxInterruptWatchdog == 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((heth->gState == HAL_ETH_STATE_READY) || (heth->gState == HAL_ETH_STATE_STARTED))
+  {
+    MODIFY_REG(heth->Instance->DMACRIWTR, ETH_DMACRIWTR_RWT, pItConfig->RxInterruptWatchdog);
+
+    /* Thresholds used when (re)building the descriptors */
+    heth->RxDescList.ItCoalescing = pItConfig->RxInterruptCoalescing;
+    heth->TxDescList.ItCoalescing = pItConfig->TxInterruptCoalescing;
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+}
+
 /**
   * @brief  Configures the Clock range of ETH MDIO interface.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -3052,6 +3541,11 @@ static void ETH_MACDMAConfig(ETH_HandleTypeDef *heth)
 
   /* DMA default configuration */
   ETH_SetDMAConfig(heth, &dmaDefaultConf);
+
+  /* No interrupt coalescing: one Rx/Tx complete interrupt per descriptor or packet */
+  CLEAR_BIT(heth->Instance->DMACRIWTR, ETH_DMACRIWTR_RWT);
+  heth->RxDescList.ItCoalescing = 1U;
+  heth->TxDescList.ItCoalescing = 1U;
 }
 
 /**
@@ -3081,6 +3575,7 @@ static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth)
   }
 
   heth->TxDescList.CurTxDesc = 0;
+  heth->TxDescList.ItPacketCnt = 0U;
 
   /* Set Transmit Descriptor Ring Length */
   WRITE_REG(heth->Instance->DMACTDRLR, (ETH_TX_DESC_CNT - 1U));
@@ -3112,11 +3607,13 @@ static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth)
     WRITE_REG(dmarxdesc->DESC1, 0x0U);
     WRITE_REG(dmarxdesc->DESC2, 0x0U);
     WRITE_REG(dmarxdesc->DESC3, 0x0U);
-    WRITE_REG(dmarxdesc->BackupAddr0, 0x0U);
+#if (USE_HAL_ETH_SPLIT_DESCRIPTORS == 0U)
     WRITE_REG(dmarxdesc->BackupAddr1, 0x0U);
+#endif /* USE_HAL_ETH_SPLIT_DESCRIPTORS */
 
     /* Set Rx descritors addresses */
     WRITE_REG(heth->RxDescList.RxDesc[i], (uint32_t)dmarxdesc);
+    WRITE_REG(ETH_RX_BACKUP_ADDR(heth, i), 0x0U);
 
   }
 
@@ -3400,6 +3897,13 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
 
   if (ItMode != ((uint32_t)RESET))
   {
+    /* Count the packet towards the Tx interrupt coalescing threshold */
+    dmatxdesclist->ItPacketCnt++;
+  }
+
+  if ((ItMode != ((uint32_t)RESET)) && (dmatxdesclist->ItPacketCnt >= dmatxdesclist->ItCoalescing))
+  {
+    dmatxdesclist->ItPacketCnt = 0U;
     /* Set Interrupt on completion bit */
     SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_IOC);
   }
@@ -3429,6 +3933,140 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
   return HAL_ETH_ERROR_NONE;
 }
 
+/**
+  * @brief  Request the Tx complete interrupt on the last packet queued in the Tx descriptor list.
+  * @note   Called before the Tx DMA tail pointer is moved past the packet, so that the last packet
+  *         of each transmission always raises the interrupt: Tx interrupt coalescing then only
+  *         groups the packets of a burst and never delays the reclaim of the last ones.
+  * @param  dmatxdesclist: pointer to the Tx descriptor list
+  * @retval None
+  */
+static void ETH_RequestTxCompleteIT(ETH_TxDescListTypeDef *dmatxdesclist)
+{
+  uint32_t descidx = ((dmatxdesclist->CurTxDesc + ETH_TX_DESC_CNT - 1U) % ETH_TX_DESC_CNT);
+  ETH_DMADescTypeDef *dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+
+  /* The interrupt is already requested when the packet reached the coalescing threshold */
+  if (dmatxdesclist->ItPacketCnt != 0U)
+  {
+    dmatxdesclist->ItPacketCnt = 0U;
+    /* Set Interrupt on completion bit */
+    SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_IOC);
+  }
+}
+
+/**
+  * @brief  Walk the Tx descriptors in use and release the transmitted packets.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pBuff: NULL to release each packet through the Tx free callback, otherwise
+  *         array of ETH_TX_DESC_CNT entries collecting the released packets
+  * @retval Number of released packets
+  */
+static uint32_t ETH_ReleaseTxDescriptors(ETH_HandleTypeDef *heth, uint32_t **pBuff)
+{
+  ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList;
+  uint32_t numOfBuf =  dmatxdesclist->BuffersInUse;
+  uint32_t idx =       dmatxdesclist->releaseIndex;
+  uint8_t pktTxStatus = 1U;
+  uint8_t pktInUse;
+  uint32_t pktcount = 0U;
+#ifdef HAL_ETH_USE_PTP
+  ETH_TimeStampTypeDef *timestamp = &heth->TxTimestamp;
+#endif /* HAL_ETH_USE_PTP */
+
+  /* Loop through buffers in use.  */
+  while ((numOfBuf != 0U) && (pktTxStatus != 0U))
+  {
+    pktInUse = 1U;
+    numOfBuf--;
+    /* If no packet, just examine the next packet.  */
+    if (dmatxdesclist->PacketAddress[idx] == NULL)
+    {
+      /* No packet in use, skip to next.  */
+      INCR_TX_DESC_INDEX(idx, 1U);
+      pktInUse = 0U;
+    }
+
+    if (pktInUse != 0U)
+    {
+      /* Determine if the packet has been transmitted.  */
+      if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCRF_OWN) == 0U)
+      {
+#ifdef HAL_ETH_USE_PTP
+
+        /* Disable Ptp transmission */
+        CLEAR_BIT(heth->Init.TxDesc[idx].DESC2, ETH_DMATXNDESCRF_TTSE);
+
+        if ((heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_LD)
+            && (heth->Init.TxDesc[idx].DESC3 & ETH_DMATXNDESCWBF_TTSS))
+        {
+          /* Get timestamp low */
+          timestamp->TimeStampLow = heth->Init.TxDesc[idx].DESC0;
+          /* Get timestamp high */
+          timestamp->TimeStampHigh = heth->Init.TxDesc[idx].DESC1;
+        }
+        else
+        {
+          timestamp->TimeStampHigh = timestamp->TimeStampLow = UINT32_MAX;
+        }
+#endif /* HAL_ETH_USE_PTP */
+
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+        /*Call registered callbacks*/
+#ifdef HAL_ETH_USE_PTP
+        /* Handle Ptp  */
+        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
+        {
+          heth->txPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
+        }
+#endif  /* HAL_ETH_USE_PTP */
+        if (pBuff == NULL)
+        {
+          /* Release the packet.  */
+          heth->txFreeCallback(dmatxdesclist->PacketAddress[idx]);
+        }
+#else
+        /* Call callbacks */
+#ifdef HAL_ETH_USE_PTP
+        /* Handle Ptp  */
+        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
+        {
+          HAL_ETH_TxPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
+        }
+#endif  /* HAL_ETH_USE_PTP */
+        if (pBuff == NULL)
+        {
+          /* Release the packet.  */
+          HAL_ETH_TxFreeCallback(dmatxdesclist->PacketAddress[idx]);
+        }
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+
+        if (pBuff != NULL)
+        {
+          /* Collect the packet, the whole burst is released at once */
+          pBuff[pktcount] = dmatxdesclist->PacketAddress[idx];
+        }
+        pktcount++;
+
+        /* Clear the entry in the in-use array.  */
+        dmatxdesclist->PacketAddress[idx] = NULL;
+
+        /* Update the transmit relesae index and number of buffers in use.  */
+        INCR_TX_DESC_INDEX(idx, 1U);
+        dmatxdesclist->BuffersInUse = numOfBuf;
+        dmatxdesclist->releaseIndex = idx;
+      }
+      else
+      {
+        /* Get out of the loop!  */
+        pktTxStatus = 0U;
+      }
+    }
+  }
+  return pktcount;
+}
+
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth)
 {
@@ -3441,6 +4079,7 @@ static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth)
   heth->WakeUpCallback   = HAL_ETH_WakeUpCallback;    /* Legacy weak WakeUpCallback   */
   heth->rxLinkCallback   = HAL_ETH_RxLinkCallback;    /* Legacy weak RxLinkCallback   */
   heth->txFreeCallback   = HAL_ETH_TxFreeCallback;    /* Legacy weak TxFreeCallback   */
+  heth->txFreeBurstCallback = HAL_ETH_TxFreeBurstCallback; /* Legacy weak TxFreeBurstCallback */
 #ifdef HAL_ETH_USE_PTP
   heth->txPtpCallback    = HAL_ETH_TxPtpCallback;     /* Legacy weak TxPtpCallback   */
 #endif /* HAL_ETH_USE_PTP */
@@ -49,6 +49,15 @@
     (#)Enable HCD transmission and reception:
         (##) HAL_HCD_Start();
 
+    (#)Optionally let the driver schedule the transfers of a channel:
+        (##) Queue HCD_URBTypeDef with HAL_HCD_HC_EnqueueURB(), they are submitted in
+             order and completed through their XferCpltCallback.
+        (##) Interrupt URBs with a non zero interval are polled again every interval SOF
+             until they fail or the queue is flushed with HAL_HCD_HC_FlushURBQueue().
+        (##) NAKs answered to a bulk/control URB are retried up to nak_budget times.
+        (##) While a channel queue is not empty, HAL_HCD_HC_NotifyURBChange_Callback()
+             is not called for this channel.
+
   @endverbatim
   ******************************************************************************
   */
@@ -80,6 +89,10 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum);
 static void HCD_RXQLVL_IRQHandler(HCD_HandleTypeDef *hhcd);
 static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd);
+static void HCD_HC_NotifyURBChange(HCD_HandleTypeDef *hhcd, uint8_t chnum);
+static void HCD_URBQueue_Submit(HCD_HandleTypeDef *hhcd, uint8_t chnum);
+static void HCD_URBQueue_Notify(HCD_HandleTypeDef *hhcd, uint8_t chnum);
+static void HCD_URBQueue_SOF(HCD_HandleTypeDef *hhcd);
 /**
   * @}
   */
@@ -109,6 +122,8 @@ static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd);
   */
 HAL_StatusTypeDef HAL_HCD_Init(HCD_HandleTypeDef *hhcd)
 {
+  uint32_t i;
+
   /* Check the HCD handle allocation */
   if (hhcd == NULL)
   {
@@ -149,6 +164,12 @@ HAL_StatusTypeDef HAL_HCD_Init(HCD_HandleTypeDef *hhcd)
   /* Disable the Interrupts */
   __HAL_HCD_DISABLE(hhcd);
 
+  /* No URB queued */
+  for (i = 0U; i < 16U; i++)
+  {
+    hhcd->pURBQueue[i] = NULL;
+  }
+
   /* Init the Core (common init.) */
   if (USB_CoreInit(hhcd->Instance, hhcd->Init) != HAL_OK)
   {
@@ -514,6 +535,84 @@ HAL_StatusTypeDef HAL_HCD_HC_SubmitRequest(HCD_HandleTypeDef *hhcd,
   return USB_HC_StartXfer(hhcd->Instance, &hhcd->hc[ch_num], (uint8_t)hhcd->Init.dma_enable);
 }
 
+/**
+  * @brief  Queue an URB on a host channel.
+  * @note   The URB is submitted as soon as the previous URBs of the channel are
+  *         completed. The channel must have been initialized with HAL_HCD_HC_Init().
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 0 to 15
+  * @param  pURB URB to queue, it must stay valid until its completion callback
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_EnqueueURB(HCD_HandleTypeDef *hhcd, uint8_t ch_num, HCD_URBTypeDef *pURB)
+{
+  HCD_URBTypeDef **pLink;
+  uint32_t primask_bit;
+
+  if ((pURB == NULL) || ((uint32_t)ch_num >= hhcd->Init.Host_channels))
+  {
+    return HAL_ERROR;
+  }
+
+  pURB->urb_state = URB_IDLE;
+  pURB->xfer_count = 0U;
+  pURB->nak_count = 0U;
+  pURB->sof_count = 0U;
+  pURB->next = NULL;
+
+  /* Enter critical section: the queue is also walked from the HCD interrupt */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  pLink = &hhcd->pURBQueue[ch_num];
+
+  while (*pLink != NULL)
+  {
+    pLink = &(*pLink)->next;
+  }
+
+  *pLink = pURB;
+
+  /* Start the channel when the queue was empty */
+  if (hhcd->pURBQueue[ch_num] == pURB)
+  {
+    HCD_URBQueue_Submit(hhcd, ch_num);
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Drop all the URBs queued on a host channel and halt it.
+  * @note   The completion callbacks of the dropped URBs are not called.
+  * @param  hhcd HCD handle
+  * @param  ch_num Channel number.
+  *         This parameter can be a value from 0 to 15
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_HCD_HC_FlushURBQueue(HCD_HandleTypeDef *hhcd, uint8_t ch_num)
+{
+  uint32_t primask_bit;
+
+  if ((uint32_t)ch_num >= hhcd->Init.Host_channels)
+  {
+    return HAL_ERROR;
+  }
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  hhcd->pURBQueue[ch_num] = NULL;
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_HCD_HC_Halt(hhcd, ch_num);
+}
+
 /**
   * @brief  Handle HCD interrupt request.
   * @param  hhcd HCD handle
@@ -594,6 +693,8 @@ void HAL_HCD_IRQHandler(HCD_HandleTypeDef *hhcd)
     /* Handle Host SOF Interrupt */
     if (__HAL_HCD_GET_FLAG(hhcd, USB_OTG_GINTSTS_SOF))
     {
+      HCD_URBQueue_SOF(hhcd);
+
 #if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
       hhcd->SOFCallback(hhcd);
 #else
@@ -1346,11 +1447,7 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
       USBx_HC(chnum)->HCCHAR |= USB_OTG_HCCHAR_ODDFRM;
       hhcd->hc[chnum].urb_state = URB_DONE;
 
-#if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
-      hhcd->HC_NotifyURBChangeCallback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#else
-      HAL_HCD_HC_NotifyURBChange_Callback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#endif /* USE_HAL_HCD_REGISTER_CALLBACKS */
+      HCD_HC_NotifyURBChange(hhcd, chnum);
     }
     else
     {
@@ -1565,11 +1662,7 @@ static void HCD_HC_IN_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
       }
     }
 
-#if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
-    hhcd->HC_NotifyURBChangeCallback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#else
-    HAL_HCD_HC_NotifyURBChange_Callback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#endif /* USE_HAL_HCD_REGISTER_CALLBACKS */
+    HCD_HC_NotifyURBChange(hhcd, chnum);
   }
   else if (__HAL_HCD_GET_CH_FLAG(hhcd, chnum, USB_OTG_HCINT_NYET))
   {
@@ -1744,11 +1837,7 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
         hhcd->hc[chnum].ErrCnt = 0U;
         hhcd->hc[chnum].urb_state = URB_ERROR;
 
-#if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
-        hhcd->HC_NotifyURBChangeCallback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#else
-        HAL_HCD_HC_NotifyURBChange_Callback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#endif /* USE_HAL_HCD_REGISTER_CALLBACKS */
+        HCD_HC_NotifyURBChange(hhcd, chnum);
       }
       else
       {
@@ -1853,11 +1942,7 @@ static void HCD_HC_OUT_IRQHandler(HCD_HandleTypeDef *hhcd, uint8_t chnum)
       return;
     }
 
-#if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
-    hhcd->HC_NotifyURBChangeCallback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#else
-    HAL_HCD_HC_NotifyURBChange_Callback(hhcd, chnum, hhcd->hc[chnum].urb_state);
-#endif /* USE_HAL_HCD_REGISTER_CALLBACKS */
+    HCD_HC_NotifyURBChange(hhcd, chnum);
   }
   else
   {
@@ -2020,6 +2105,146 @@ static void HCD_Port_IRQHandler(HCD_HandleTypeDef *hhcd)
   * @}
   */
 
+/**
+  * @brief  Report an URB state change of a host channel.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 0 to 15
+  * @retval none
+  */
+static void HCD_HC_NotifyURBChange(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  if (hhcd->pURBQueue[chnum] != NULL)
+  {
+    HCD_URBQueue_Notify(hhcd, chnum);
+  }
+  else
+  {
+#if (USE_HAL_HCD_REGISTER_CALLBACKS == 1U)
+    hhcd->HC_NotifyURBChangeCallback(hhcd, chnum, hhcd->hc[chnum].urb_state);
+#else
+    HAL_HCD_HC_NotifyURBChange_Callback(hhcd, chnum, hhcd->hc[chnum].urb_state);
+#endif /* USE_HAL_HCD_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief  Submit the URB at the head of a host channel queue.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 0 to 15
+  * @retval none
+  */
+static void HCD_URBQueue_Submit(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  const HCD_URBTypeDef *pURB = hhcd->pURBQueue[chnum];
+
+  (void)HAL_HCD_HC_SubmitRequest(hhcd, chnum, pURB->direction, pURB->ep_type, pURB->token,
+                                 pURB->pbuff, pURB->length, pURB->do_ping);
+}
+
+/**
+  * @brief  Schedule the queue of a host channel on an URB state change.
+  * @param  hhcd HCD handle
+  * @param  chnum Channel number.
+  *         This parameter can be a value from 0 to 15
+  * @retval none
+  */
+static void HCD_URBQueue_Notify(HCD_HandleTypeDef *hhcd, uint8_t chnum)
+{
+  const USB_OTG_GlobalTypeDef *USBx = hhcd->Instance;
+  uint32_t USBx_BASE = (uint32_t)USBx;
+  HCD_URBTypeDef *pURB = hhcd->pURBQueue[chnum];
+  HCD_URBStateTypeDef urb_state = hhcd->hc[chnum].urb_state;
+  uint8_t complete = 0U;
+
+  if ((urb_state == URB_DONE) || (urb_state == URB_ERROR) || (urb_state == URB_STALL))
+  {
+    complete = 1U;
+  }
+  else if ((urb_state == URB_NOTREADY) || (urb_state == URB_NYET) || (urb_state == URB_NAK_WAIT))
+  {
+    /* Nothing to do while the channel retries by itself */
+    if ((USBx_HC(chnum)->HCCHAR & USB_OTG_HCCHAR_CHENA) == 0U)
+    {
+      if (pURB->ep_type == EP_TYPE_INTR)
+      {
+        /* No data for this interval, poll again on the next one */
+        pURB->sof_count = (pURB->interval != 0U) ? (uint32_t)pURB->interval : 1U;
+      }
+      else
+      {
+        pURB->nak_count++;
+
+        if ((pURB->nak_budget != 0U) && (pURB->nak_count >= pURB->nak_budget))
+        {
+          complete = 1U;
+        }
+        else
+        {
+          HCD_URBQueue_Submit(hhcd, chnum);
+        }
+      }
+    }
+  }
+  else
+  {
+    /* URB_IDLE: nothing to do */
+  }
+
+  if (complete != 0U)
+  {
+    pURB->urb_state = urb_state;
+    pURB->xfer_count = hhcd->hc[chnum].xfer_count;
+
+    if ((pURB->ep_type == EP_TYPE_INTR) && (pURB->interval != 0U) && (urb_state == URB_DONE))
+    {
+      /* Periodic URB: keep it at the head of the queue until the next interval */
+      pURB->sof_count = (uint32_t)pURB->interval;
+    }
+    else
+    {
+      hhcd->pURBQueue[chnum] = pURB->next;
+
+      if (hhcd->pURBQueue[chnum] != NULL)
+      {
+        HCD_URBQueue_Submit(hhcd, chnum);
+      }
+    }
+
+    if (pURB->XferCpltCallback != NULL)
+    {
+      pURB->XferCpltCallback(hhcd, pURB);
+    }
+  }
+}
+
+/**
+  * @brief  Resubmit the periodic URBs whose interval elapsed.
+  * @param  hhcd HCD handle
+  * @retval none
+  */
+static void HCD_URBQueue_SOF(HCD_HandleTypeDef *hhcd)
+{
+  HCD_URBTypeDef *pURB;
+  uint8_t chnum;
+
+  for (chnum = 0U; chnum < hhcd->Init.Host_channels; chnum++)
+  {
+    pURB = hhcd->pURBQueue[chnum];
+
+    if ((pURB != NULL) && (pURB->sof_count != 0U))
+    {
+      pURB->sof_count--;
+
+      if (pURB->sof_count == 0U)
+      {
+        HCD_URBQueue_Submit(hhcd, chnum);
+      }
+    }
+  }
+}
+
 /**
   * @}
   */
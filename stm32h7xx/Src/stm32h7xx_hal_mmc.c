@@ -150,6 +150,27 @@
         through HAL_MMC_GetCardState() function for MMC card state.
         You could also check the IT transfer process through the MMC Tx interrupt event.
 
+  *** MMC Card Request queue ***
+  ==============================
+  [..]
+    (+) Block transfers can be queued with HAL_MMC_QueueRequest() after filling a
+        MMC_RequestTypeDef structure. The request stays owned by the driver until its
+        XferCpltCallback is called or its Status becomes MMC_REQUEST_DONE, MMC_REQUEST_ERROR
+        or MMC_REQUEST_ABORTED.
+    (+) Each transaction is announced with CMD23 (SET_BLOCK_COUNT) and transferred in DMA mode,
+        so no stop command and no status polling are needed between queued transfers: the
+        next transaction is started from the interrupt handler as soon as the previous one ends.
+    (+) Consecutive queued requests of the same direction that follow each other both on the
+        card and in memory are merged into a single transaction.
+    (+) Requests flagged MMC_REQUEST_FLAG_RELIABLE_WRITE are written with the reliable write
+        option of CMD23 and are never merged.
+    (+) HAL_MMC_QueueFlush() removes the requests which are not yet started.
+    (+) When a transaction fails, its requests retire with MMC_REQUEST_ERROR and all the
+        requests not yet started are removed with MMC_REQUEST_ABORTED: the card may not be
+        back in transfer state, so wait for HAL_MMC_GetCardState() to return
+        HAL_MMC_CARD_TRANSFER before queueing requests again.
+    (+) The queue must not be used while another transfer function is in progress.
+
   *** MMC card information ***
   ===========================
   [..]
@@ -377,6 +398,10 @@ static uint32_t MMC_DDR_Mode(MMC_HandleTypeDef *hmmc, FunctionalState state);
 static HAL_StatusTypeDef MMC_ReadExtCSD(MMC_HandleTypeDef *hmmc, uint32_t *pFieldData, uint16_t FieldIndex,
                                         uint32_t Timeout);
 static uint32_t MMC_PwrClassUpdate(MMC_HandleTypeDef *hmmc, uint32_t Wide, uint32_t Speed);
+static void     MMC_QueueStart(MMC_HandleTypeDef *hmmc);
+static void     MMC_QueueRetire(MMC_HandleTypeDef *hmmc);
+static uint32_t MMC_QueueCanMerge(const MMC_RequestTypeDef *pRequest, const MMC_RequestTypeDef *pNext,
+                                  uint32_t NumberOfBlocks);
 
 /**
   * @}
@@ -465,6 +490,9 @@ HAL_StatusTypeDef HAL_MMC_Init(MMC_HandleTypeDef *hmmc)
   /* Initialize the MMC operation */
   hmmc->Context = MMC_CONTEXT_NONE;
 
+  /* Initialize the request queue */
+  hmmc->pRequestQueue = NULL;
+
   /* Initialize the MMC state */
   hmmc->State = HAL_MMC_STATE_READY;
 
@@ -1509,6 +1537,132 @@ HAL_StatusTypeDef HAL_MMC_WriteBlocks_DMA(MMC_HandleTypeDef *hmmc, const uint8_t
   }
 }
 
+/**
+  * @brief  Queue a block transfer request.
+  * @note   The request is started at once when the bus is free, else when the queued
+  *         requests before it complete. Its completion is reported through its Status
+  *         field and its XferCpltCallback, called from the SDMMC interrupt handler.
+  * @note   The request structure and its data buffer must remain valid until the request retires.
+  * @note   After a failed request, check that HAL_MMC_GetCardState() returns HAL_MMC_CARD_TRANSFER
+  *         before queueing new requests.
+  * @param  hmmc: Pointer to MMC handle
+  * @param  pRequest: Pointer to the request to queue
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_QueueRequest(MMC_HandleTypeDef *hmmc, MMC_RequestTypeDef *pRequest)
+{
+  MMC_RequestTypeDef *plast;
+  uint32_t primask_bit;
+
+  if ((pRequest == NULL) || (pRequest->pData == NULL) || (pRequest->NumberOfBlocks == 0U) ||
+      (pRequest->NumberOfBlocks > MMC_REQUEST_MAX_BLOCKS) ||
+      ((pRequest->Direction != MMC_REQUEST_READ) && (pRequest->Direction != MMC_REQUEST_WRITE)))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if ((pRequest->BlockAdd + pRequest->NumberOfBlocks) > (hmmc->MmcCard.LogBlockNbr))
+  {
+    hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_OUT_OF_RANGE;
+    return HAL_ERROR;
+  }
+
+  /* Check the case of 4kB blocks (field DATA SECTOR SIZE of extended CSD register) */
+  if (((hmmc->Ext_CSD[(MMC_EXT_CSD_DATA_SEC_SIZE_INDEX / 4)] >> MMC_EXT_CSD_DATA_SEC_SIZE_POS) & 0x000000FFU) != 0x0U)
+  {
+    if (((pRequest->NumberOfBlocks % 8U) != 0U) || ((pRequest->BlockAdd % 8U) != 0U))
+    {
+      hmmc->ErrorCode |= HAL_MMC_ERROR_ADDR_MISALIGNED;
+      return HAL_ERROR;
+    }
+  }
+
+  pRequest->Status    = MMC_REQUEST_PENDING;
+  pRequest->ErrorCode = HAL_MMC_ERROR_NONE;
+  pRequest->pNext     = NULL;
+
+  /* The queue is also updated by the interrupt handler */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  if (hmmc->pRequestQueue == NULL)
+  {
+    hmmc->pRequestQueue = pRequest;
+  }
+  else
+  {
+    plast = hmmc->pRequestQueue;
+    while (plast->pNext != NULL)
+    {
+      plast = plast->pNext;
+    }
+    plast->pNext = pRequest;
+  }
+
+  if (hmmc->State == HAL_MMC_STATE_READY)
+  {
+    MMC_QueueStart(hmmc);
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Remove the queued requests which are not started yet.
+  * @note   The removed requests get the MMC_REQUEST_ABORTED status and their
+  *         XferCpltCallback is called. The active transaction is not affected.
+  * @param  hmmc: Pointer to MMC handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_MMC_QueueFlush(MMC_HandleTypeDef *hmmc)
+{
+  MMC_RequestTypeDef *pprev = NULL;
+  MMC_RequestTypeDef *preq;
+  MMC_RequestTypeDef *pflushed;
+  uint32_t primask_bit;
+
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  /* Detach the pending requests, which all follow the active ones */
+  preq = hmmc->pRequestQueue;
+  while ((preq != NULL) && (preq->Status == MMC_REQUEST_ACTIVE))
+  {
+    pprev = preq;
+    preq = preq->pNext;
+  }
+
+  pflushed = preq;
+  if (pprev == NULL)
+  {
+    hmmc->pRequestQueue = NULL;
+  }
+  else
+  {
+    pprev->pNext = NULL;
+  }
+
+  __set_PRIMASK(primask_bit);
+
+  while (pflushed != NULL)
+  {
+    preq = pflushed;
+    pflushed = preq->pNext;
+
+    preq->pNext  = NULL;
+    preq->Status = MMC_REQUEST_ABORTED;
+    if (preq->XferCpltCallback != NULL)
+    {
+      preq->XferCpltCallback(preq);
+    }
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Erases the specified memory area of the given MMC card.
   * @note   This API should be followed by a check on the card state through
@@ -1655,8 +1809,9 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
       hmmc->Instance->DCTRL = 0;
       hmmc->Instance->IDMACTRL = SDMMC_DISABLE_IDMA ;
 
-      /* Stop Transfer for Write Multi blocks or Read Multi blocks */
-      if (((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      /* Stop Transfer for Write Multi blocks or Read Multi blocks, queued transfers end by themselves (CMD23) */
+      if ((((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+          && ((context & MMC_CONTEXT_QUEUE) == 0U))
       {
         errorstate = SDMMC_CmdStopTransfer(hmmc->Instance);
         if (errorstate != HAL_MMC_ERROR_NONE)
@@ -1674,7 +1829,15 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
       __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_DATA_FLAGS);
 
       hmmc->State = HAL_MMC_STATE_READY;
-      if (((context & MMC_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
+      if ((context & MMC_CONTEXT_QUEUE) != 0U)
+      {
+        /* Retire the completed requests and start the next transaction without waiting for the card status */
+        hmmc->Context = MMC_CONTEXT_NONE;
+        MMC_QueueRetire(hmmc);
+        MMC_QueueStart(hmmc);
+      }
+      else if (((context & MMC_CONTEXT_WRITE_SINGLE_BLOCK) != 0U) ||
+               ((context & MMC_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
       {
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
         hmmc->TxCpltCallback(hmmc);
@@ -1682,7 +1845,8 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
         HAL_MMC_TxCpltCallback(hmmc);
 #endif /* USE_HAL_MMC_REGISTER_CALLBACKS */
       }
-      if (((context & MMC_CONTEXT_READ_SINGLE_BLOCK) != 0U) || ((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
+      else if (((context & MMC_CONTEXT_READ_SINGLE_BLOCK) != 0U) ||
+               ((context & MMC_CONTEXT_READ_MULTIPLE_BLOCK) != 0U))
       {
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
         hmmc->RxCpltCallback(hmmc);
@@ -1690,6 +1854,10 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
         HAL_MMC_RxCpltCallback(hmmc);
 #endif /* USE_HAL_MMC_REGISTER_CALLBACKS */
       }
+      else
+      {
+        /* Nothing to do */
+      }
     }
     else if ((context & MMC_CONTEXT_IT) != 0U)
     {
@@ -1795,11 +1963,22 @@ void HAL_MMC_IRQHandler(MMC_HandleTypeDef *hmmc)
 
         /* Set the MMC state to ready to be able to start again the process */
         hmmc->State = HAL_MMC_STATE_READY;
+        if ((context & MMC_CONTEXT_QUEUE) != 0U)
+        {
+          /* The card may not be back in transfer state: abort the requests not yet started
+             and report the error to the requests of the failed transaction */
+          hmmc->Context = MMC_CONTEXT_NONE;
+          (void)HAL_MMC_QueueFlush(hmmc);
+          MMC_QueueRetire(hmmc);
+        }
+        else
+        {
 #if defined (USE_HAL_MMC_REGISTER_CALLBACKS) && (USE_HAL_MMC_REGISTER_CALLBACKS == 1U)
-        hmmc->ErrorCallback(hmmc);
+          hmmc->ErrorCallback(hmmc);
 #else
-        HAL_MMC_ErrorCallback(hmmc);
+          HAL_MMC_ErrorCallback(hmmc);
 #endif /* USE_HAL_MMC_REGISTER_CALLBACKS */
+        }
       }
     }
     else
@@ -4348,6 +4527,194 @@ static uint32_t MMC_PwrClassUpdate(MMC_HandleTypeDef *hmmc, uint32_t Wide, uint3
   return errorstate;
 }
 
+/**
+  * @brief  Start the next transactions of the request queue.
+  * @note   Called with the bus free. Returns when a transaction is in progress or when
+  *         the queue is empty; when a transaction cannot be started, its requests retire with
+  *         an error and the requests not yet started are aborted.
+  * @param  hmmc: Pointer to MMC handle
+  * @retval None
+  */
+static void MMC_QueueStart(MMC_HandleTypeDef *hmmc)
+{
+  SDMMC_DataInitTypeDef config;
+  MMC_RequestTypeDef *preq = hmmc->pRequestQueue;
+  MMC_RequestTypeDef *plast;
+  uint32_t errorstate;
+  uint32_t nbblocks;
+  uint32_t arg;
+  uint32_t add;
+
+  while ((preq != NULL) && (hmmc->State == HAL_MMC_STATE_READY))
+  {
+    /* Gather the requests transferred by this transaction */
+    preq->Status = MMC_REQUEST_ACTIVE;
+    nbblocks = preq->NumberOfBlocks;
+    plast = preq;
+    while (MMC_QueueCanMerge(plast, plast->pNext, nbblocks) != 0U)
+    {
+      plast = plast->pNext;
+      plast->Status = MMC_REQUEST_ACTIVE;
+      nbblocks += plast->NumberOfBlocks;
+    }
+
+    hmmc->ErrorCode = HAL_MMC_ERROR_NONE;
+    hmmc->State = HAL_MMC_STATE_BUSY;
+
+    /* Initialize data control register */
+    hmmc->Instance->DCTRL = 0U;
+
+    /* Announce the transaction length so that it ends without stop command */
+    arg = nbblocks;
+    if ((preq->Direction == MMC_REQUEST_WRITE) && ((preq->Flags & MMC_REQUEST_FLAG_RELIABLE_WRITE) != 0U))
+    {
+      arg |= 0x80000000U;
+    }
+    errorstate = SDMMC_CmdBlockCount(hmmc->Instance, arg);
+
+    if (errorstate == HAL_MMC_ERROR_NONE)
+    {
+      add = preq->BlockAdd;
+      if ((hmmc->MmcCard.CardType) != MMC_HIGH_CAPACITY_CARD)
+      {
+        add *= MMC_BLOCKSIZE;
+      }
+
+      /* Configure the MMC DPSM (Data Path State Machine) */
+      config.DataTimeOut   = SDMMC_DATATIMEOUT;
+      config.DataLength    = MMC_BLOCKSIZE * nbblocks;
+      config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+      config.TransferDir   = (preq->Direction == MMC_REQUEST_WRITE) ? SDMMC_TRANSFER_DIR_TO_CARD :
+                             SDMMC_TRANSFER_DIR_TO_SDMMC;
+      config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+      config.DPSM          = SDMMC_DPSM_DISABLE;
+      (void)SDMMC_ConfigData(hmmc->Instance, &config);
+
+      __SDMMC_CMDTRANS_ENABLE(hmmc->Instance);
+
+      hmmc->Instance->IDMABASE0 = (uint32_t) preq->pData;
+      hmmc->Instance->IDMACTRL  = SDMMC_ENABLE_IDMA_SINGLE_BUFF;
+
+      if (preq->Direction == MMC_REQUEST_WRITE)
+      {
+        hmmc->pTxBuffPtr = preq->pData;
+        hmmc->TxXferSize = MMC_BLOCKSIZE * nbblocks;
+        hmmc->Context = (MMC_CONTEXT_WRITE_MULTIPLE_BLOCK | MMC_CONTEXT_DMA | MMC_CONTEXT_QUEUE);
+
+        /* Write Multi Block command */
+        errorstate = SDMMC_CmdWriteMultiBlock(hmmc->Instance, add);
+      }
+      else
+      {
+        hmmc->pRxBuffPtr = preq->pData;
+        hmmc->RxXferSize = MMC_BLOCKSIZE * nbblocks;
+        hmmc->Context = (MMC_CONTEXT_READ_MULTIPLE_BLOCK | MMC_CONTEXT_DMA | MMC_CONTEXT_QUEUE);
+
+        /* Read Multi Block command */
+        errorstate = SDMMC_CmdReadMultiBlock(hmmc->Instance, add);
+      }
+    }
+
+    if (errorstate != HAL_MMC_ERROR_NONE)
+    {
+      /* Clear all the static flags */
+      __HAL_MMC_CLEAR_FLAG(hmmc, SDMMC_STATIC_FLAGS);
+      __SDMMC_CMDTRANS_DISABLE(hmmc->Instance);
+      hmmc->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+      hmmc->ErrorCode |= errorstate;
+      hmmc->Context = MMC_CONTEXT_NONE;
+      hmmc->State = HAL_MMC_STATE_READY;
+
+      /* The card state is unknown after the failed command: abort the requests not yet started
+         and retire the requests of the failed transaction */
+      (void)HAL_MMC_QueueFlush(hmmc);
+      MMC_QueueRetire(hmmc);
+      preq = hmmc->pRequestQueue;
+    }
+    else if (preq->Direction == MMC_REQUEST_WRITE)
+    {
+      __HAL_MMC_ENABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND));
+    }
+    else
+    {
+      __HAL_MMC_ENABLE_IT(hmmc, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_RXOVERR | SDMMC_IT_DATAEND));
+    }
+  }
+}
+
+/**
+  * @brief  Retire the active requests of the queue with the handle error code.
+  * @param  hmmc: Pointer to MMC handle
+  * @retval None
+  */
+static void MMC_QueueRetire(MMC_HandleTypeDef *hmmc)
+{
+  MMC_RequestTypeDef *pdone = hmmc->pRequestQueue;
+  MMC_RequestTypeDef *pprev = NULL;
+  MMC_RequestTypeDef *preq;
+  uint32_t errorcode = hmmc->ErrorCode;
+
+  /* Detach the active requests first, as their callbacks may queue new requests */
+  preq = pdone;
+  while ((preq != NULL) && (preq->Status == MMC_REQUEST_ACTIVE))
+  {
+    pprev = preq;
+    preq = preq->pNext;
+  }
+
+  hmmc->pRequestQueue = preq;
+  if (pprev == NULL)
+  {
+    pdone = NULL;
+  }
+  else
+  {
+    pprev->pNext = NULL;
+  }
+
+  while (pdone != NULL)
+  {
+    preq = pdone;
+    pdone = preq->pNext;
+
+    preq->pNext     = NULL;
+    preq->ErrorCode = errorcode;
+    preq->Status    = (errorcode == HAL_MMC_ERROR_NONE) ? MMC_REQUEST_DONE : MMC_REQUEST_ERROR;
+    if (preq->XferCpltCallback != NULL)
+    {
+      preq->XferCpltCallback(preq);
+    }
+  }
+}
+
+/**
+  * @brief  Check whether a queued request can join the transaction of the previous one.
+  * @param  pRequest: Last request of the transaction
+  * @param  pNext: Request following it in the queue, can be NULL
+  * @param  NumberOfBlocks: Number of blocks already in the transaction
+  * @retval 1 when the request can be merged, 0 otherwise
+  */
+static uint32_t MMC_QueueCanMerge(const MMC_RequestTypeDef *pRequest, const MMC_RequestTypeDef *pNext,
+                                  uint32_t NumberOfBlocks)
+{
+  uint32_t merge = 0U;
+
+  if (pNext != NULL)
+  {
+    if ((pNext->Direction == pRequest->Direction) &&
+        ((pRequest->Flags & MMC_REQUEST_FLAG_RELIABLE_WRITE) == 0U) &&
+        ((pNext->Flags & MMC_REQUEST_FLAG_RELIABLE_WRITE) == 0U) &&
+        (pNext->BlockAdd == (pRequest->BlockAdd + pRequest->NumberOfBlocks)) &&
+        (pNext->pData == &pRequest->pData[pRequest->NumberOfBlocks * MMC_BLOCKSIZE]) &&
+        ((NumberOfBlocks + pNext->NumberOfBlocks) <= MMC_REQUEST_MAX_BLOCKS))
+    {
+      merge = 1U;
+    }
+  }
+
+  return merge;
+}
+
 /**
   * @brief  Used to select the partition.
   * @param  hmmc: Pointer to MMC handle
@@ -43,6 +43,16 @@
           structure. The read/write address information is contained by the Nand_Address_Typedef
           structure passed as parameter.
 
+      (+) Large transfers can use the MDMA through HAL_NAND_Read_Page_8b_MDMA() and
+          HAL_NAND_Write_Page_8b_MDMA(), after the MDMA handle has been linked to the hmdma field
+          of the NAND handle. Both APIs can return the FMC ECC of each page. Call
+          HAL_NAND_ConfigCacheRead() to read consecutive pages with the cache read commands,
+          overlapping the array load of the next page with the transfer of the current one.
+
+      (+) Keep track of the bad blocks with the bad block table cache: attach a table with
+          HAL_NAND_BBT_Init(), then use HAL_NAND_BBT_IsBadBlock() and HAL_NAND_BBT_MarkBadBlock().
+          The markers of a block are read from the device the first time it is looked up only.
+
       (+) Perform NAND flash Reset chip operation using the function HAL_NAND_Reset().
 
       (+) Perform NAND flash erase block operation using the function HAL_NAND_Erase_Block().
@@ -126,6 +136,16 @@
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
+/** @defgroup NAND_Private_Functions_Prototypes NAND Private Functions Prototypes
+  * @{
+  */
+static void NAND_SendAddress(const NAND_HandleTypeDef *hnand, uint32_t nandaddress, uint32_t columnaddress);
+static HAL_StatusTypeDef NAND_WaitReady(const NAND_HandleTypeDef *hnand);
+static HAL_StatusTypeDef NAND_WaitRead(const NAND_HandleTypeDef *hnand);
+static HAL_StatusTypeDef NAND_ReadMarker(const NAND_HandleTypeDef *hnand, uint32_t nandaddress, uint8_t *pMarker);
+/**
+  * @}
+  */
 /* Exported functions ---------------------------------------------------------*/
 
 /** @defgroup NAND_Exported_Functions NAND Exported Functions
@@ -168,6 +188,9 @@ HAL_StatusTypeDef  HAL_NAND_Init(NAND_HandleTypeDef *hnand, FMC_NAND_PCC_TimingT
   {
     /* Allocate lock resource and initialize it */
     hnand->Lock = HAL_UNLOCKED;
+    hnand->hmdma = NULL;
+    hnand->pBBT = NULL;
+    hnand->CacheReadEnable = DISABLE;
 
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
     if (hnand->MspInitCallback == NULL)
@@ -507,6 +530,27 @@ HAL_StatusTypeDef  HAL_NAND_ConfigDevice(NAND_HandleTypeDef *hnand, const NAND_D
   return HAL_OK;
 }
 
+/**
+  * @brief  Enable or disable the cache read commands (31h/3Fh) used by
+  *         HAL_NAND_Read_Page_8b_MDMA() to read consecutive pages of a block.
+  * @note   Only large page (> 512 bytes) devices support these commands, so
+  *         they are never issued on small page devices.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  CacheReadEnable  new state of the cache read commands.
+  *         This parameter can be ENABLE or DISABLE
+  * @retval HAL status
+  */
+HAL_StatusTypeDef  HAL_NAND_ConfigCacheRead(NAND_HandleTypeDef *hnand, FunctionalState CacheReadEnable)
+{
+  /* Check the parameters */
+  assert_param(IS_FUNCTIONAL_STATE(CacheReadEnable));
+
+  hnand->CacheReadEnable = CacheReadEnable;
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Read Page(s) from NAND memory block (8-bits addressing)
   * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
@@ -1865,6 +1909,494 @@ uint32_t HAL_NAND_Address_Inc(const NAND_HandleTypeDef *hnand, NAND_AddressTypeD
   return (status);
 }
 
+/**
+  * @brief  Read Page(s) from NAND memory block (8-bits addressing) using the MDMA
+  * @note   The MDMA handle linked to hnand->hmdma must be configured for memory to memory
+  *         block transfers with a byte source data size. This API returns when all the
+  *         pages are transferred.
+  * @note   When the cache read is enabled on a large page device, consecutive pages of a
+  *         block are read with the cache read commands: the device loads the next page into
+  *         its data register while the current one is transferred by the MDMA.
+  * @note   When pECC is not NULL, the FMC ECC is restarted for each page and its value is
+  *         stored in pECC[n] for the n-th page read. The ECC covers the first
+  *         Init.ECCPageSize bytes of the page.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure
+  * @param  pBuffer  pointer to destination read buffer
+  * @param  NumPageToRead  number of pages to read from block
+  * @param  pECC  pointer to a table of NumPageToRead ECC values, or NULL
+  * @param  Timeout  timeout of each page transfer in ms
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_Read_Page_8b_MDMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                             uint8_t *pBuffer, uint32_t NumPageToRead, uint32_t *pECC,
+                                             uint32_t Timeout)
+{
+  uint32_t deviceaddress;
+  uint32_t nandaddress;
+  uint32_t eccenable;
+  uint32_t nbpages = NumPageToRead;
+  uint32_t runpages = 0U;
+  uint32_t cacheread = 0U;
+  uint32_t page = 0U;
+  uint8_t *buff = pBuffer;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if ((hnand->State == HAL_NAND_STATE_READY) && (hnand->hmdma != NULL))
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    /* Identify the device address */
+    deviceaddress = NAND_DEVICE;
+
+    /* NAND raw address calculation */
+    nandaddress = ARRAY_ADDRESS(pAddress, hnand);
+
+    eccenable = READ_BIT(hnand->Instance->PCR, FMC_PCR_ECCEN);
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* Make sure no dirty data cache line overwrites the buffer while the MDMA fills it */
+    SCB_CleanInvalidateDCache_by_Addr((uint32_t *)buff, (int32_t)(NumPageToRead * hnand->Config.PageSize));
+#endif /* __DCACHE_PRESENT */
+
+    /* Page(s) read loop */
+    while ((status == HAL_OK) && (nbpages != 0U) &&
+           (nandaddress < ((hnand->Config.BlockSize) * (hnand->Config.BlockNbr))))
+    {
+      if (runpages == 0U)
+      {
+        /* Cache read runs stop at the end of the block */
+        runpages = 1U;
+        if ((hnand->CacheReadEnable == ENABLE) && ((hnand->Config.PageSize) > 512U))
+        {
+          runpages = hnand->Config.BlockSize - (nandaddress % hnand->Config.BlockSize);
+          if (runpages > nbpages)
+          {
+            runpages = nbpages;
+          }
+        }
+        cacheread = (runpages > 1U) ? 1U : 0U;
+
+        /* Send read page command sequence */
+        *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+        __DSB();
+        NAND_SendAddress(hnand, nandaddress, 0U);
+        *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_TRUE1;
+        __DSB();
+
+        if (cacheread != 0U)
+        {
+          /* The page must be in the data register before the first cache read command */
+          status = NAND_WaitReady(hnand);
+        }
+        else
+        {
+          status = NAND_WaitRead(hnand);
+        }
+      }
+
+      if ((status == HAL_OK) && (cacheread != 0U))
+      {
+        /* Move the page to the cache register and load the next one, or only move the last one */
+        *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = (runpages > 1U) ? NAND_CMD_CACHE_READ :
+                                                                   NAND_CMD_CACHE_READ_END;
+        __DSB();
+
+        status = NAND_WaitReady(hnand);
+
+        /* Go back to read mode */
+        *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = ((uint8_t)0x00);
+        __DSB();
+      }
+
+      if (status == HAL_OK)
+      {
+        if (pECC != NULL)
+        {
+          /* Restart the ECC computation on the page data */
+          (void)FMC_NAND_ECC_Disable(hnand->Instance, hnand->Init.NandBank);
+          (void)FMC_NAND_ECC_Enable(hnand->Instance, hnand->Init.NandBank);
+        }
+
+        /* Get Data into Buffer */
+        status = HAL_MDMA_Start(hnand->hmdma, deviceaddress, (uint32_t)buff, hnand->Config.PageSize, 1U);
+        if (status == HAL_OK)
+        {
+          status = HAL_MDMA_PollForTransfer(hnand->hmdma, HAL_MDMA_FULL_TRANSFER, Timeout);
+        }
+
+        if ((status == HAL_OK) && (pECC != NULL))
+        {
+          status = FMC_NAND_GetECC(hnand->Instance, &pECC[page], hnand->Init.NandBank, Timeout);
+        }
+      }
+
+      buff += hnand->Config.PageSize;
+      page++;
+      runpages--;
+
+      /* Decrement pages to read */
+      nbpages--;
+
+      /* Increment the NAND address */
+      nandaddress = (uint32_t)(nandaddress + 1U);
+    }
+
+    if ((pECC != NULL) && (eccenable == 0U))
+    {
+      (void)FMC_NAND_ECC_Disable(hnand->Instance, hnand->Init.NandBank);
+    }
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    SCB_InvalidateDCache_by_Addr((uint32_t *)pBuffer, (int32_t)(NumPageToRead * hnand->Config.PageSize));
+#endif /* __DCACHE_PRESENT */
+
+    /* Update the NAND controller state */
+    hnand->State = (status == HAL_OK) ? HAL_NAND_STATE_READY : HAL_NAND_STATE_ERROR;
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Write Page(s) to NAND memory block (8-bits addressing) using the MDMA
+  * @note   The MDMA handle linked to hnand->hmdma must be configured for memory to memory
+  *         block transfers with a byte destination data size. This API returns when all the
+  *         pages are programmed.
+  * @note   When pECC is not NULL, the FMC ECC is restarted for each page and its value is
+  *         stored in pECC[n] for the n-th page written, ready to be stored in the spare area.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure
+  * @param  pBuffer  pointer to source buffer to write
+  * @param  NumPageToWrite   number of pages to write to block
+  * @param  pECC  pointer to a table of NumPageToWrite ECC values, or NULL
+  * @param  Timeout  timeout of each page transfer in ms
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_Write_Page_8b_MDMA(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                              const uint8_t *pBuffer, uint32_t NumPageToWrite, uint32_t *pECC,
+                                              uint32_t Timeout)
+{
+  uint32_t deviceaddress;
+  uint32_t nandaddress;
+  uint32_t eccenable;
+  uint32_t nbpages = NumPageToWrite;
+  uint32_t page = 0U;
+  const uint8_t *buff = pBuffer;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if ((hnand->State == HAL_NAND_STATE_READY) && (hnand->hmdma != NULL))
+  {
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    /* Identify the device address */
+    deviceaddress = NAND_DEVICE;
+
+    /* NAND raw address calculation */
+    nandaddress = ARRAY_ADDRESS(pAddress, hnand);
+
+    eccenable = READ_BIT(hnand->Instance->PCR, FMC_PCR_ECCEN);
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+    /* The MDMA reads the buffer from memory */
+    SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)buff), (int32_t)(NumPageToWrite * hnand->Config.PageSize));
+#endif /* __DCACHE_PRESENT */
+
+    /* Page(s) write loop */
+    while ((status == HAL_OK) && (nbpages != 0U) &&
+           (nandaddress < ((hnand->Config.BlockSize) * (hnand->Config.BlockNbr))))
+    {
+      /* Send write page command sequence */
+      *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+      __DSB();
+      *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_WRITE0;
+      __DSB();
+      NAND_SendAddress(hnand, nandaddress, 0U);
+
+      if (pECC != NULL)
+      {
+        /* Restart the ECC computation on the page data */
+        (void)FMC_NAND_ECC_Disable(hnand->Instance, hnand->Init.NandBank);
+        (void)FMC_NAND_ECC_Enable(hnand->Instance, hnand->Init.NandBank);
+      }
+
+      /* Write data to memory */
+      status = HAL_MDMA_Start(hnand->hmdma, (uint32_t)buff, deviceaddress, hnand->Config.PageSize, 1U);
+      if (status == HAL_OK)
+      {
+        status = HAL_MDMA_PollForTransfer(hnand->hmdma, HAL_MDMA_FULL_TRANSFER, Timeout);
+      }
+
+      if ((status == HAL_OK) && (pECC != NULL))
+      {
+        /* Waits for the FMC FIFO to be empty before reading the ECC */
+        status = FMC_NAND_GetECC(hnand->Instance, &pECC[page], hnand->Init.NandBank, Timeout);
+      }
+
+      if (status == HAL_OK)
+      {
+        *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
+        __DSB();
+
+        status = NAND_WaitReady(hnand);
+      }
+
+      buff += hnand->Config.PageSize;
+      page++;
+
+      /* Decrement pages to write */
+      nbpages--;
+
+      /* Increment the NAND address */
+      nandaddress = (uint32_t)(nandaddress + 1U);
+    }
+
+    if ((pECC != NULL) && (eccenable == 0U))
+    {
+      (void)FMC_NAND_ECC_Disable(hnand->Instance, hnand->Init.NandBank);
+    }
+
+    /* Update the NAND controller state */
+    hnand->State = (status == HAL_OK) ? HAL_NAND_STATE_READY : HAL_NAND_STATE_ERROR;
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Attach a bad block table cache to the NAND handle (8-bits addressing)
+  * @note   The table holds two bits per block, a "checked" bit and a "bad" bit, and must be
+  *         NAND_BBT_SIZE(Config.BlockNbr) words long. It is filled on demand by
+  *         HAL_NAND_BBT_IsBadBlock(), so that the bad block markers of a block are read
+  *         from the device only once.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pTable pointer to the table
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_BBT_Init(NAND_HandleTypeDef *hnand, uint32_t *pTable)
+{
+  uint32_t index;
+
+  if (pTable == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if (hnand->State == HAL_NAND_STATE_READY)
+  {
+    for (index = 0U; index < NAND_BBT_SIZE(hnand->Config.BlockNbr); index++)
+    {
+      pTable[index] = 0U;
+    }
+    hnand->pBBT = pTable;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check whether a block is marked bad (8-bits addressing)
+  * @note   The first spare area byte of the two first pages of the block is checked the first
+  *         time the block is looked up, the result is kept in the bad block table cache.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure, the Page field is ignored
+  * @param  pIsBad  set to 1 when the block is bad, to 0 otherwise
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_BBT_IsBadBlock(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress,
+                                          uint32_t *pIsBad)
+{
+  uint32_t block;
+  uint32_t nandaddress;
+  uint32_t words;
+  uint8_t marker0 = 0xFFU;
+  uint8_t marker1 = 0xFFU;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if ((hnand->State == HAL_NAND_STATE_READY) && (hnand->pBBT != NULL))
+  {
+    block = (uint32_t)pAddress->Block + ((uint32_t)pAddress->Plane * hnand->Config.PlaneSize);
+    if (block >= hnand->Config.BlockNbr)
+    {
+      return HAL_ERROR;
+    }
+    words = NAND_BBT_SIZE(hnand->Config.BlockNbr) / 2U;
+
+    if ((hnand->pBBT[block / 32U] & (1UL << (block % 32U))) == 0U)
+    {
+      /* Process Locked */
+      __HAL_LOCK(hnand);
+
+      /* Update the NAND controller state */
+      hnand->State = HAL_NAND_STATE_BUSY;
+
+      /* Read the bad block markers of the two first pages */
+      nandaddress = block * hnand->Config.BlockSize;
+      status = NAND_ReadMarker(hnand, nandaddress, &marker0);
+      if (status == HAL_OK)
+      {
+        status = NAND_ReadMarker(hnand, nandaddress + 1U, &marker1);
+      }
+
+      if (status == HAL_OK)
+      {
+        hnand->pBBT[block / 32U] |= (1UL << (block % 32U));
+        if ((marker0 != 0xFFU) || (marker1 != 0xFFU))
+        {
+          hnand->pBBT[words + (block / 32U)] |= (1UL << (block % 32U));
+        }
+      }
+
+      /* Update the NAND controller state */
+      hnand->State = (status == HAL_OK) ? HAL_NAND_STATE_READY : HAL_NAND_STATE_ERROR;
+
+      /* Process unlocked */
+      __HAL_UNLOCK(hnand);
+    }
+
+    *pIsBad = ((hnand->pBBT[words + (block / 32U)] & (1UL << (block % 32U))) != 0U) ? 1U : 0U;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Mark a block bad in the device and in the bad block table cache (8-bits addressing)
+  * @note   The first spare area byte of the first page of the block is programmed to 0x00.
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  pAddress  pointer to NAND address structure, the Page field is ignored
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_NAND_BBT_MarkBadBlock(NAND_HandleTypeDef *hnand, const NAND_AddressTypeDef *pAddress)
+{
+  uint32_t deviceaddress;
+  uint32_t block;
+  uint32_t words;
+  HAL_StatusTypeDef status;
+
+  /* Check the NAND controller state */
+  if (hnand->State == HAL_NAND_STATE_BUSY)
+  {
+    return HAL_BUSY;
+  }
+  else if ((hnand->State == HAL_NAND_STATE_READY) && (hnand->pBBT != NULL))
+  {
+    block = (uint32_t)pAddress->Block + ((uint32_t)pAddress->Plane * hnand->Config.PlaneSize);
+    if (block >= hnand->Config.BlockNbr)
+    {
+      return HAL_ERROR;
+    }
+    words = NAND_BBT_SIZE(hnand->Config.BlockNbr) / 2U;
+
+    /* Process Locked */
+    __HAL_LOCK(hnand);
+
+    /* Update the NAND controller state */
+    hnand->State = HAL_NAND_STATE_BUSY;
+
+    /* Identify the device address */
+    deviceaddress = NAND_DEVICE;
+
+    /* Send write spare area command sequence */
+    if ((hnand->Config.PageSize) <= 512U)
+    {
+      *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_C;
+      __DSB();
+      *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_WRITE0;
+      __DSB();
+      NAND_SendAddress(hnand, block * hnand->Config.BlockSize, 0U);
+    }
+    else
+    {
+      *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+      __DSB();
+      *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_WRITE0;
+      __DSB();
+      NAND_SendAddress(hnand, block * hnand->Config.BlockSize, COLUMN_ADDRESS(hnand));
+    }
+
+    /* Write the bad block marker */
+    *(__IO uint8_t *)deviceaddress = 0x00U;
+    __DSB();
+
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_WRITE_TRUE1;
+    __DSB();
+
+    status = NAND_WaitReady(hnand);
+
+    /* The block is bad even when the marker could not be programmed */
+    hnand->pBBT[block / 32U] |= (1UL << (block % 32U));
+    hnand->pBBT[words + (block / 32U)] |= (1UL << (block % 32U));
+
+    /* Update the NAND controller state */
+    hnand->State = (status == HAL_OK) ? HAL_NAND_STATE_READY : HAL_NAND_STATE_ERROR;
+
+    /* Process unlocked */
+    __HAL_UNLOCK(hnand);
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+
+  return status;
+}
+
 #if (USE_HAL_NAND_REGISTER_CALLBACKS == 1)
 /**
   * @brief  Register a User NAND Callback
@@ -2187,6 +2719,131 @@ uint32_t HAL_NAND_Read_Status(const NAND_HandleTypeDef *hnand)
   * @}
   */
 
+/**
+  * @}
+  */
+
+/** @defgroup NAND_Private_Functions NAND Private Functions
+  * @{
+  */
+
+/**
+  * @brief  Send the address cycles of a page access
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  nandaddress NAND raw page address
+  * @param  columnaddress column in the page
+  * @retval None
+  */
+static void NAND_SendAddress(const NAND_HandleTypeDef *hnand, uint32_t nandaddress, uint32_t columnaddress)
+{
+  uint32_t deviceaddress = NAND_DEVICE;
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = COLUMN_1ST_CYCLE(columnaddress);
+  __DSB();
+
+  /* Cards with page size > 512 bytes have two column cycles */
+  if ((hnand->Config.PageSize) > 512U)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = COLUMN_2ND_CYCLE(columnaddress);
+    __DSB();
+  }
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_1ST_CYCLE(nandaddress);
+  __DSB();
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_2ND_CYCLE(nandaddress);
+  __DSB();
+
+  if (((hnand->Config.BlockSize) * (hnand->Config.BlockNbr)) > 65535U)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | ADDR_AREA)) = ADDR_3RD_CYCLE(nandaddress);
+    __DSB();
+  }
+}
+
+/**
+  * @brief  Read the NAND status until the device is ready
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_WaitReady(const NAND_HandleTypeDef *hnand)
+{
+  uint32_t tickstart = HAL_GetTick();
+
+  /* Read status until NAND is ready */
+  while (HAL_NAND_Read_Status(hnand) != NAND_READY)
+  {
+    if ((HAL_GetTick() - tickstart) > NAND_WRITE_TIMEOUT)
+    {
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Wait for the page data after a read command when the device needs the extra command
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_WaitRead(const NAND_HandleTypeDef *hnand)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hnand->Config.ExtraCommandEnable == ENABLE)
+  {
+    status = NAND_WaitReady(hnand);
+
+    /* Go back to read mode */
+    *(__IO uint8_t *)((uint32_t)(NAND_DEVICE | CMD_AREA)) = ((uint8_t)0x00);
+    __DSB();
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Read the bad block marker of a page, the first byte of its spare area
+  * @param  hnand pointer to a NAND_HandleTypeDef structure that contains
+  *                the configuration information for NAND module.
+  * @param  nandaddress NAND raw page address
+  * @param  pMarker pointer to the marker value
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef NAND_ReadMarker(const NAND_HandleTypeDef *hnand, uint32_t nandaddress, uint8_t *pMarker)
+{
+  uint32_t deviceaddress = NAND_DEVICE;
+  HAL_StatusTypeDef status;
+
+  /* Send read spare area command sequence */
+  if ((hnand->Config.PageSize) <= 512U)
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_C;
+    __DSB();
+    NAND_SendAddress(hnand, nandaddress, 0U);
+  }
+  else
+  {
+    *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_A;
+    __DSB();
+    NAND_SendAddress(hnand, nandaddress, COLUMN_ADDRESS(hnand));
+  }
+
+  *(__IO uint8_t *)((uint32_t)(deviceaddress | CMD_AREA)) = NAND_CMD_AREA_TRUE1;
+  __DSB();
+
+  status = NAND_WaitRead(hnand);
+  if (status == HAL_OK)
+  {
+    *pMarker = *(__IO uint8_t *)deviceaddress;
+  }
+
+  return status;
+}
+
 /**
   * @}
   */
@@ -14,6 +14,7 @@
               + DMA channel configuration for indirect functional mode
               + Errors management and abort functionality
               + IO manager configuration
+              + SFDP discovery
 
   ******************************************************************************
   * @attention
@@ -195,6 +196,22 @@
     [..]
      HAL_OSPIM_Config() function configures the IO manager for the OctoSPI instance.
 
+    *** SFDP discovery functions ***
+    ================================
+    [..]
+     HAL_OSPI_SFDP_Read() reads the Serial Flash Discoverable Parameters of the memory in
+     1S-1S-1S mode. HAL_OSPI_SFDP_Parse() decodes them, from a buffer holding the SFDP area
+     from address 0 (512 bytes cover the usual devices), into an OSPI_SFDPTypeDef structure :
+     (+) The device size, to be used in the DeviceSize field of the initialization structure.
+     (+) The read modes supported by the memory with their instruction and wait states.
+     (+) The quad enable requirements and the page size.
+    [..]
+     HAL_OSPI_SFDP_GetReadCmd() builds the read command of the fastest mode supported by both the
+     memory and the application, and HAL_OSPI_SFDP_MemoryMapped() uses it to configure the
+     memory-mapped mode. The memory must first be switched to the selected mode (quad enable bit,
+     QPI or octal DTR mode) as described in its datasheet. HAL_OSPI_SFDP_Parse() and
+     HAL_OSPI_SFDP_GetReadCmd() do not access the peripheral.
+
     *** Callback registration ***
     =============================================
     [..]
@@ -299,13 +316,55 @@
 #define OSPI_IOM_NB_PORTS  2U
 #define OSPI_IOM_PORT_MASK 0x1U
 
+#define OSPI_SFDP_READ_CMD               0x5AU        /*!< Read SFDP instruction                    */
+#define OSPI_SFDP_READ_DUMMY_CYCLES      8U           /*!< Read SFDP wait states                    */
+#define OSPI_SFDP_FAST_READ_CMD          0x0BU        /*!< 1S-1S-1S fast read instruction           */
+#define OSPI_SFDP_FAST_READ_DUMMY_CYCLES 8U           /*!< 1S-1S-1S fast read wait states           */
+#define OSPI_SFDP_PROGRAM_CMD            0x02U        /*!< Page program instruction                 */
+#define OSPI_SFDP_PROGRAM_4B_CMD         0x12U        /*!< Page program instruction, 4-byte address */
+#define OSPI_SFDP_OCTAL_DTR_DUMMY_CYCLES 20U          /*!< 8D-8D-8D wait states when not described  */
+
+#define OSPI_SFDP_BFPT_ID                0xFF00U      /*!< Basic Flash Parameter Table         */
+#define OSPI_SFDP_PROFILE1_ID            0xFF05U      /*!< xSPI Profile 1.0 Table              */
+#define OSPI_SFDP_4BAIT_ID               0xFF84U      /*!< 4-byte Address Instruction Table    */
+#define OSPI_SFDP_BFPT_MIN_LENGTH        9U           /*!< DWORDs of the JESD216 original BFPT */
+
+#define OSPI_SFDP_BFPT_1S_1S_2S          (1UL << 16U) /*!< BFPT 1st DWORD: 1S-1S-2S fast read          */
+#define OSPI_SFDP_BFPT_ADDR_BYTES        (3UL << 17U) /*!< BFPT 1st DWORD: address bytes               */
+#define OSPI_SFDP_BFPT_ADDR_3_OR_4       (1UL << 17U) /*!< 3-byte or 4-byte addressing                 */
+#define OSPI_SFDP_BFPT_ADDR_4_ONLY       (2UL << 17U) /*!< 4-byte addressing only                      */
+#define OSPI_SFDP_BFPT_1S_2S_2S          (1UL << 20U) /*!< BFPT 1st DWORD: 1S-2S-2S fast read          */
+#define OSPI_SFDP_BFPT_1S_4S_4S          (1UL << 21U) /*!< BFPT 1st DWORD: 1S-4S-4S fast read          */
+#define OSPI_SFDP_BFPT_1S_1S_4S          (1UL << 22U) /*!< BFPT 1st DWORD: 1S-1S-4S fast read          */
+#define OSPI_SFDP_BFPT_2S_2S_2S          (1UL << 0U)  /*!< BFPT 5th DWORD: 2S-2S-2S fast read          */
+#define OSPI_SFDP_BFPT_4S_4S_4S          (1UL << 4U)  /*!< BFPT 5th DWORD: 4S-4S-4S fast read          */
+#define OSPI_SFDP_BFPT_CMD_EXT           (3UL << 29U) /*!< BFPT 18th DWORD: 8D-8D-8D command extension */
+#define OSPI_SFDP_BFPT_CMD_EXT_REPEAT    (0UL << 29U) /*!< Extension is the same as the command        */
+#define OSPI_SFDP_BFPT_CMD_EXT_INVERT    (1UL << 29U) /*!< Extension is the inverse of the command     */
+
 /* Private macro -------------------------------------------------------------*/
 #define IS_OSPI_FUNCTIONAL_MODE(MODE) (((MODE) == OSPI_FUNCTIONAL_MODE_INDIRECT_WRITE) || \
                                        ((MODE) == OSPI_FUNCTIONAL_MODE_INDIRECT_READ)  || \
                                        ((MODE) == OSPI_FUNCTIONAL_MODE_AUTO_POLLING)   || \
                                        ((MODE) == OSPI_FUNCTIONAL_MODE_MEMORY_MAPPED))
 
+#define OSPI_SFDP_TABLE_POINTER(SFDP, HEADER) (((uint32_t)(SFDP)[(HEADER) + 6U] << 16U) | \
+                                               ((uint32_t)(SFDP)[(HEADER) + 5U] << 8U)  | \
+                                               (uint32_t)(SFDP)[(HEADER) + 4U])
+
 /* Private variables ---------------------------------------------------------*/
+/* Instruction, address and data modes, number of address lines and alternate bytes mode of the SFDP read modes */
+static const uint32_t OSPI_SFDP_ReadLines[8][5] =
+{
+  {HAL_OSPI_INSTRUCTION_1_LINE,  HAL_OSPI_ADDRESS_1_LINE,  HAL_OSPI_DATA_1_LINE,  1U, HAL_OSPI_ALTERNATE_BYTES_1_LINE},
+  {HAL_OSPI_INSTRUCTION_1_LINE,  HAL_OSPI_ADDRESS_1_LINE,  HAL_OSPI_DATA_2_LINES, 1U, HAL_OSPI_ALTERNATE_BYTES_1_LINE},
+  {HAL_OSPI_INSTRUCTION_1_LINE,  HAL_OSPI_ADDRESS_2_LINES, HAL_OSPI_DATA_2_LINES, 2U, HAL_OSPI_ALTERNATE_BYTES_2_LINES},
+  {HAL_OSPI_INSTRUCTION_2_LINES, HAL_OSPI_ADDRESS_2_LINES, HAL_OSPI_DATA_2_LINES, 2U, HAL_OSPI_ALTERNATE_BYTES_2_LINES},
+  {HAL_OSPI_INSTRUCTION_1_LINE,  HAL_OSPI_ADDRESS_1_LINE,  HAL_OSPI_DATA_4_LINES, 1U, HAL_OSPI_ALTERNATE_BYTES_1_LINE},
+  {HAL_OSPI_INSTRUCTION_1_LINE,  HAL_OSPI_ADDRESS_4_LINES, HAL_OSPI_DATA_4_LINES, 4U, HAL_OSPI_ALTERNATE_BYTES_4_LINES},
+  {HAL_OSPI_INSTRUCTION_4_LINES, HAL_OSPI_ADDRESS_4_LINES, HAL_OSPI_DATA_4_LINES, 4U, HAL_OSPI_ALTERNATE_BYTES_4_LINES},
+  {HAL_OSPI_INSTRUCTION_8_LINES, HAL_OSPI_ADDRESS_8_LINES, HAL_OSPI_DATA_8_LINES, 8U, HAL_OSPI_ALTERNATE_BYTES_8_LINES}
+};
 
 /* Private function prototypes -----------------------------------------------*/
 static void              OSPI_DMACplt(MDMA_HandleTypeDef *hmdma);
@@ -316,6 +375,12 @@ static HAL_StatusTypeDef OSPI_WaitFlagStateUntilTimeout(OSPI_HandleTypeDef *hosp
 static HAL_StatusTypeDef OSPI_ConfigCmd(OSPI_HandleTypeDef *hospi, OSPI_RegularCmdTypeDef *cmd);
 static HAL_StatusTypeDef OSPIM_GetConfig(uint8_t instance_nb, OSPIM_CfgTypeDef *cfg);
 static void OSPI_DMAAbortOnError(MDMA_HandleTypeDef *hmdma);
+static uint32_t          OSPI_SFDP_GetDword(const uint8_t *pTable, uint32_t Index);
+static uint32_t          OSPI_SFDP_FindTable(const uint8_t *pSfdp, uint32_t Size, uint32_t Id, uint32_t *pLength);
+static void              OSPI_SFDP_SetRead(OSPI_SFDPTypeDef *pInfo, uint32_t Index, uint32_t Settings);
+static void              OSPI_SFDP_Set4ByteRead(OSPI_SFDPTypeDef *pInfo, uint32_t Index, uint32_t Dword, uint32_t Bit,
+                                                uint32_t Instruction);
+static uint32_t          OSPI_SFDP_GetOctalDtrDummy(const OSPI_SFDPTypeDef *pInfo, uint32_t ClockFreq);
 /**
   @endcond
   */
@@ -2748,6 +2813,427 @@ HAL_StatusTypeDef HAL_OSPIM_Config(OSPI_HandleTypeDef *hospi, OSPIM_CfgTypeDef *
   return status;
 }
 
+/**
+  * @}
+  */
+
+/** @defgroup OSPI_Exported_Functions_Group5 SFDP discovery functions
+  *  @brief   OSPI SFDP discovery functions
+  *
+@verbatim
+ ===============================================================================
+                  ##### SFDP discovery functions #####
+ ===============================================================================
+    [..]
+    This subsection provides a set of functions allowing to :
+      (+) Read the Serial Flash Discoverable Parameters (SFDP) of the memory.
+      (+) Decode the JEDEC SFDP tables.
+      (+) Build the read command of the fastest supported mode.
+      (+) Configure the memory-mapped mode with this read command.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Read the SFDP area of the memory.
+  * @param  hospi   : OSPI handle
+  * @param  Address : Address in the SFDP area
+  * @param  pData   : pointer to data buffer
+  * @param  Size    : Number of bytes to read
+  * @param  Timeout : Timeout duration
+  * @note   The Read SFDP command (5Ah) is sent in 1S-1S-1S mode, with a 24-bit address and 8 wait states,
+  *         so the memory must be in its power-up SPI mode.
+  * @note   This function is used only in single or octal mode, not in dual-quad mode.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_SFDP_Read(OSPI_HandleTypeDef *hospi, uint32_t Address, uint8_t *pData, uint32_t Size,
+                                     uint32_t Timeout)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+
+  if ((pData == NULL) || (Size == 0U) || (hospi->Init.DualQuad != HAL_OSPI_DUALQUAD_DISABLE))
+  {
+    status = HAL_ERROR;
+    hospi->ErrorCode = HAL_OSPI_ERROR_INVALID_PARAM;
+  }
+  else
+  {
+    cmd.OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+    cmd.FlashId               = HAL_OSPI_FLASH_ID_1;
+    cmd.Instruction           = OSPI_SFDP_READ_CMD;
+    cmd.InstructionMode       = HAL_OSPI_INSTRUCTION_1_LINE;
+    cmd.InstructionSize       = HAL_OSPI_INSTRUCTION_8_BITS;
+    cmd.InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+    cmd.Address               = Address;
+    cmd.AddressMode           = HAL_OSPI_ADDRESS_1_LINE;
+    cmd.AddressSize           = HAL_OSPI_ADDRESS_24_BITS;
+    cmd.AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+    cmd.AlternateBytes        = 0U;
+    cmd.AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+    cmd.AlternateBytesSize    = HAL_OSPI_ALTERNATE_BYTES_8_BITS;
+    cmd.AlternateBytesDtrMode = HAL_OSPI_ALTERNATE_BYTES_DTR_DISABLE;
+    cmd.DataMode              = HAL_OSPI_DATA_1_LINE;
+    cmd.NbData                = Size;
+    cmd.DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+    cmd.DummyCycles           = OSPI_SFDP_READ_DUMMY_CYCLES;
+    cmd.DQSMode               = HAL_OSPI_DQS_DISABLE;
+    cmd.SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+    status = HAL_OSPI_Command(hospi, &cmd, Timeout);
+
+    if (status == HAL_OK)
+    {
+      status = HAL_OSPI_Receive(hospi, pData, Timeout);
+    }
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Decode the SFDP tables of the memory.
+  * @param  pSfdp : pointer to the SFDP area, read from address 0
+  * @param  Size  : Number of bytes of the SFDP area available in pSfdp
+  * @param  pInfo : pointer to the decoded flash parameters
+  * @note   The Basic Flash Parameter Table is mandatory. The 4-byte Address Instruction Table
+  *         is used for devices larger than 16 MB, and the xSPI Profile 1.0 Table gives the
+  *         8D-8D-8D read command. Tables lying beyond Size are ignored.
+  * @note   This function only works on the buffer and does not access the OSPI peripheral.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_SFDP_Parse(const uint8_t *pSfdp, uint32_t Size, OSPI_SFDPTypeDef *pInfo)
+{
+  const uint8_t *bfpt;
+  const uint8_t *table;
+  uint32_t header;
+  uint32_t length;
+  uint32_t bfptlength;
+  uint32_t dword;
+  uint32_t addrbytes;
+  uint32_t opcode;
+  uint32_t index;
+
+  if ((pSfdp == NULL) || (pInfo == NULL) || (Size < 16U) ||
+      (OSPI_SFDP_GetDword(pSfdp, 1U) != HAL_OSPI_SFDP_SIGNATURE))
+  {
+    return HAL_ERROR;
+  }
+
+  header = OSPI_SFDP_FindTable(pSfdp, Size, OSPI_SFDP_BFPT_ID, &bfptlength);
+  if ((header == 0U) || (bfptlength < OSPI_SFDP_BFPT_MIN_LENGTH))
+  {
+    return HAL_ERROR;
+  }
+  bfpt = &pSfdp[OSPI_SFDP_TABLE_POINTER(pSfdp, header)];
+
+  pInfo->Revision           = ((uint32_t)pSfdp[header + 2U] << 8U) | (uint32_t)pSfdp[header + 1U];
+  pInfo->AddressSize        = HAL_OSPI_ADDRESS_24_BITS;
+  pInfo->PageSize           = 256U;
+  pInfo->QuadEnable         = HAL_OSPI_SFDP_QER_UNKNOWN;
+  pInfo->ProgramInstruction = OSPI_SFDP_PROGRAM_CMD;
+  pInfo->ReadModes          = 0U;
+  for (index = 0U; index < 8U; index++)
+  {
+    pInfo->Read[index].Instruction = 0U;
+    pInfo->Read[index].DummyCycles = 0U;
+    pInfo->Read[index].ModeClocks  = 0U;
+  }
+  for (index = 0U; index < 4U; index++)
+  {
+    pInfo->OctalDtrDummyCycles[index] = 0U;
+  }
+
+  /* Memory density: number of bits minus one, or power of two of the number of bits */
+  dword = OSPI_SFDP_GetDword(bfpt, 2U);
+  if ((dword & 0x80000000U) != 0U)
+  {
+    index = dword & 0x7FFFFFFFU;
+    pInfo->DeviceSize = (index > 35U) ? 32U : ((index > 3U) ? (index - 3U) : 1U);
+  }
+  else
+  {
+    dword = (dword >> 3U) + 1U;
+    index = 1U;
+    while ((index < 32U) && ((1UL << index) < dword))
+    {
+      index++;
+    }
+    pInfo->DeviceSize = index;
+  }
+
+  /* The fast read (0Bh) is supported by all the SFDP devices */
+  OSPI_SFDP_SetRead(pInfo, 0U, (OSPI_SFDP_FAST_READ_CMD << 8U) | OSPI_SFDP_FAST_READ_DUMMY_CYCLES);
+
+  /* Single, dual and quad fast read commands */
+  dword = OSPI_SFDP_GetDword(bfpt, 1U);
+  if ((dword & OSPI_SFDP_BFPT_1S_1S_2S) != 0U)
+  {
+    OSPI_SFDP_SetRead(pInfo, 1U, OSPI_SFDP_GetDword(bfpt, 4U) & 0xFFFFU);
+  }
+  if ((dword & OSPI_SFDP_BFPT_1S_2S_2S) != 0U)
+  {
+    OSPI_SFDP_SetRead(pInfo, 2U, OSPI_SFDP_GetDword(bfpt, 4U) >> 16U);
+  }
+  if ((OSPI_SFDP_GetDword(bfpt, 5U) & OSPI_SFDP_BFPT_2S_2S_2S) != 0U)
+  {
+    OSPI_SFDP_SetRead(pInfo, 3U, OSPI_SFDP_GetDword(bfpt, 6U) >> 16U);
+  }
+  if ((dword & OSPI_SFDP_BFPT_1S_1S_4S) != 0U)
+  {
+    OSPI_SFDP_SetRead(pInfo, 4U, OSPI_SFDP_GetDword(bfpt, 3U) >> 16U);
+  }
+  if ((dword & OSPI_SFDP_BFPT_1S_4S_4S) != 0U)
+  {
+    OSPI_SFDP_SetRead(pInfo, 5U, OSPI_SFDP_GetDword(bfpt, 3U) & 0xFFFFU);
+  }
+  if ((OSPI_SFDP_GetDword(bfpt, 5U) & OSPI_SFDP_BFPT_4S_4S_4S) != 0U)
+  {
+    OSPI_SFDP_SetRead(pInfo, 6U, OSPI_SFDP_GetDword(bfpt, 7U) >> 16U);
+  }
+
+  if (bfptlength >= 11U)
+  {
+    pInfo->PageSize = 1UL << ((OSPI_SFDP_GetDword(bfpt, 11U) >> 4U) & 0xFU);
+  }
+  if (bfptlength >= 15U)
+  {
+    pInfo->QuadEnable = (OSPI_SFDP_GetDword(bfpt, 15U) >> 20U) & 0x7U;
+  }
+
+  /* Address size */
+  addrbytes = dword & OSPI_SFDP_BFPT_ADDR_BYTES;
+  if (addrbytes == OSPI_SFDP_BFPT_ADDR_4_ONLY)
+  {
+    pInfo->AddressSize = HAL_OSPI_ADDRESS_32_BITS;
+  }
+  else if ((addrbytes == OSPI_SFDP_BFPT_ADDR_3_OR_4) && (pInfo->DeviceSize > 24U))
+  {
+    /* Switch to the 4-byte address instructions, without changing the addressing mode of the memory */
+    header = OSPI_SFDP_FindTable(pSfdp, Size, OSPI_SFDP_4BAIT_ID, &length);
+    if (header != 0U)
+    {
+      dword = OSPI_SFDP_GetDword(&pSfdp[OSPI_SFDP_TABLE_POINTER(pSfdp, header)], 1U);
+      OSPI_SFDP_Set4ByteRead(pInfo, 0U, dword, 1U, 0x0CU);
+      OSPI_SFDP_Set4ByteRead(pInfo, 1U, dword, 2U, 0x3CU);
+      OSPI_SFDP_Set4ByteRead(pInfo, 2U, dword, 3U, 0xBCU);
+      OSPI_SFDP_Set4ByteRead(pInfo, 4U, dword, 4U, 0x6CU);
+      OSPI_SFDP_Set4ByteRead(pInfo, 5U, dword, 5U, 0xECU);
+
+      /* There is no 4-byte address instruction in 2S-2S-2S and 4S-4S-4S modes */
+      pInfo->ReadModes &= ~(HAL_OSPI_SFDP_READ_2S_2S_2S | HAL_OSPI_SFDP_READ_4S_4S_4S);
+      pInfo->ProgramInstruction = ((dword & (1UL << 6U)) != 0U) ? OSPI_SFDP_PROGRAM_4B_CMD : 0U;
+      pInfo->AddressSize = HAL_OSPI_ADDRESS_32_BITS;
+    }
+    else
+    {
+      /* Only the first 16 MB are reachable until the memory enters its 4-byte address mode */
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  /* 8D-8D-8D fast read command */
+  header = OSPI_SFDP_FindTable(pSfdp, Size, OSPI_SFDP_PROFILE1_ID, &length);
+  if ((header != 0U) && (length >= 5U) && (bfptlength >= 18U))
+  {
+    table  = &pSfdp[OSPI_SFDP_TABLE_POINTER(pSfdp, header)];
+    opcode = (OSPI_SFDP_GetDword(table, 1U) >> 8U) & 0xFFU;
+    dword  = OSPI_SFDP_GetDword(bfpt, 18U) & OSPI_SFDP_BFPT_CMD_EXT;
+
+    /* The 8D-8D-8D instructions are sent on 16 bits, the second byte being the command extension */
+    if ((opcode != 0U) && ((dword == OSPI_SFDP_BFPT_CMD_EXT_REPEAT) || (dword == OSPI_SFDP_BFPT_CMD_EXT_INVERT)))
+    {
+      pInfo->OctalDtrDummyCycles[0] = (OSPI_SFDP_GetDword(table, 5U) >> 7U) & 0x1FU;
+      pInfo->OctalDtrDummyCycles[1] = (OSPI_SFDP_GetDword(table, 5U) >> 17U) & 0x1FU;
+      pInfo->OctalDtrDummyCycles[2] = (OSPI_SFDP_GetDword(table, 5U) >> 27U) & 0x1FU;
+      pInfo->OctalDtrDummyCycles[3] = (OSPI_SFDP_GetDword(table, 4U) >> 7U) & 0x1FU;
+
+      pInfo->Read[7].Instruction = (opcode << 8U) |
+                                   ((dword == OSPI_SFDP_BFPT_CMD_EXT_REPEAT) ? opcode : (~opcode & 0xFFU));
+      pInfo->Read[7].DummyCycles = OSPI_SFDP_GetOctalDtrDummy(pInfo, 0U);
+      pInfo->ReadModes |= HAL_OSPI_SFDP_READ_8D_8D_8D;
+    }
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Build the read command of the fastest mode supported by the memory.
+  * @param  pInfo     : pointer to the flash parameters decoded by HAL_OSPI_SFDP_Parse()
+  * @param  Modes     : read modes allowed by the board and the current mode of the memory.
+  *                     This parameter can be a combination of @ref OSPI_SFDP_ReadMode
+  * @param  ClockFreq : OSPI clock frequency in Hz, used to select the 8D-8D-8D wait states.
+  *                     0 selects the wait states of the highest frequency supported by the memory
+  * @param  cmd       : structure filled with the read command. The Address and NbData fields are
+  *                     left to 0 and should be set before using it in indirect mode
+  * @note   The modes are ranked 8D-8D-8D, 4S-4S-4S, 1S-4S-4S, 1S-1S-4S, 2S-2S-2S, 1S-2S-2S, 1S-1S-2S
+  *         then 1S-1S-1S. The memory must already be configured for the selected mode (quad enable
+  *         bit, QPI or octal DTR mode), as described by its datasheet.
+  * @note   When the mode bits fill one byte they are sent as an alternate byte set to 0xFF, which keeps
+  *         the memory out of its continuous read mode, otherwise they are added to the dummy cycles.
+  * @note   This function does not access the OSPI peripheral.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_SFDP_GetReadCmd(const OSPI_SFDPTypeDef *pInfo, uint32_t Modes, uint32_t ClockFreq,
+                                           OSPI_RegularCmdTypeDef *cmd)
+{
+  uint32_t modes;
+  uint32_t index = 7U;
+  uint32_t modebits;
+
+  if ((pInfo == NULL) || (cmd == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  modes = pInfo->ReadModes & Modes;
+  if (modes == 0U)
+  {
+    return HAL_ERROR;
+  }
+
+  /* The fastest mode has the highest bit position */
+  while ((modes & (1UL << index)) == 0U)
+  {
+    index--;
+  }
+
+  cmd->OperationType         = HAL_OSPI_OPTYPE_COMMON_CFG;
+  cmd->FlashId               = HAL_OSPI_FLASH_ID_1;
+  cmd->Instruction           = pInfo->Read[index].Instruction;
+  cmd->InstructionMode       = OSPI_SFDP_ReadLines[index][0];
+  cmd->InstructionSize       = HAL_OSPI_INSTRUCTION_8_BITS;
+  cmd->InstructionDtrMode    = HAL_OSPI_INSTRUCTION_DTR_DISABLE;
+  cmd->Address               = 0U;
+  cmd->AddressMode           = OSPI_SFDP_ReadLines[index][1];
+  cmd->AddressSize           = pInfo->AddressSize;
+  cmd->AddressDtrMode        = HAL_OSPI_ADDRESS_DTR_DISABLE;
+  cmd->AlternateBytes        = 0U;
+  cmd->AlternateBytesMode    = HAL_OSPI_ALTERNATE_BYTES_NONE;
+  cmd->AlternateBytesSize    = HAL_OSPI_ALTERNATE_BYTES_8_BITS;
+  cmd->AlternateBytesDtrMode = HAL_OSPI_ALTERNATE_BYTES_DTR_DISABLE;
+  cmd->DataMode              = OSPI_SFDP_ReadLines[index][2];
+  cmd->NbData                = 0U;
+  cmd->DataDtrMode           = HAL_OSPI_DATA_DTR_DISABLE;
+  cmd->DummyCycles           = pInfo->Read[index].DummyCycles;
+  cmd->DQSMode               = HAL_OSPI_DQS_DISABLE;
+  cmd->SIOOMode              = HAL_OSPI_SIOO_INST_EVERY_CMD;
+
+  if (index == 7U)
+  {
+    /* 8D-8D-8D mode */
+    cmd->InstructionSize    = HAL_OSPI_INSTRUCTION_16_BITS;
+    cmd->InstructionDtrMode = HAL_OSPI_INSTRUCTION_DTR_ENABLE;
+    cmd->AddressSize        = HAL_OSPI_ADDRESS_32_BITS;
+    cmd->AddressDtrMode     = HAL_OSPI_ADDRESS_DTR_ENABLE;
+    cmd->DataDtrMode        = HAL_OSPI_DATA_DTR_ENABLE;
+    cmd->DummyCycles        = OSPI_SFDP_GetOctalDtrDummy(pInfo, ClockFreq);
+    cmd->DQSMode            = HAL_OSPI_DQS_ENABLE;
+  }
+  else if (pInfo->Read[index].ModeClocks != 0U)
+  {
+    /* The mode bits are sent on the address lines */
+    modebits = pInfo->Read[index].ModeClocks * OSPI_SFDP_ReadLines[index][3];
+    if (modebits == 8U)
+    {
+      cmd->AlternateBytes     = 0xFFU;
+      cmd->AlternateBytesMode = OSPI_SFDP_ReadLines[index][4];
+    }
+    else
+    {
+      cmd->DummyCycles += pInfo->Read[index].ModeClocks;
+    }
+  }
+  else
+  {
+    /* Nothing to do */
+  }
+
+  if (cmd->DummyCycles > 31U)
+  {
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Configure the Memory Mapped mode with the fastest read mode supported by the memory.
+  * @param  hospi     : OSPI handle
+  * @param  pInfo     : pointer to the flash parameters decoded by HAL_OSPI_SFDP_Parse()
+  * @param  Modes     : read modes allowed by the board and the current mode of the memory.
+  *                     This parameter can be a combination of @ref OSPI_SFDP_ReadMode
+  * @param  ClockFreq : OSPI clock frequency in Hz, see HAL_OSPI_SFDP_GetReadCmd()
+  * @param  cfg       : structure that contains the memory mapped configuration information.
+  * @note   The read configuration uses the command built by HAL_OSPI_SFDP_GetReadCmd(). The write
+  *         configuration uses the page program instruction in the same instruction mode, the memory
+  *         must be write enabled by the application before any write access.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_OSPI_SFDP_MemoryMapped(OSPI_HandleTypeDef *hospi, const OSPI_SFDPTypeDef *pInfo,
+                                             uint32_t Modes, uint32_t ClockFreq, OSPI_MemoryMappedTypeDef *cfg)
+{
+  HAL_StatusTypeDef status;
+  OSPI_RegularCmdTypeDef cmd;
+  uint32_t opcode;
+
+  status = HAL_OSPI_SFDP_GetReadCmd(pInfo, Modes, ClockFreq, &cmd);
+
+  if ((status != HAL_OK) ||
+      ((cmd.InstructionDtrMode == HAL_OSPI_INSTRUCTION_DTR_DISABLE) && (pInfo->ProgramInstruction == 0U)))
+  {
+    status = HAL_ERROR;
+    hospi->ErrorCode = HAL_OSPI_ERROR_INVALID_PARAM;
+  }
+  else
+  {
+    /* Read configuration */
+    cmd.OperationType = HAL_OSPI_OPTYPE_READ_CFG;
+    status = HAL_OSPI_Command(hospi, &cmd, hospi->Timeout);
+
+    if (status == HAL_OK)
+    {
+      /* Write configuration */
+      cmd.OperationType      = HAL_OSPI_OPTYPE_WRITE_CFG;
+      cmd.AlternateBytesMode = HAL_OSPI_ALTERNATE_BYTES_NONE;
+      cmd.DummyCycles        = 0U;
+
+      if (cmd.InstructionDtrMode == HAL_OSPI_INSTRUCTION_DTR_ENABLE)
+      {
+        /* 8D-8D-8D page program with the command extension of the read instruction */
+        opcode = OSPI_SFDP_PROGRAM_4B_CMD;
+        cmd.Instruction = (opcode << 8U) |
+                          (((cmd.Instruction & 0xFFU) == (cmd.Instruction >> 8U)) ? opcode : (~opcode & 0xFFU));
+      }
+      else
+      {
+        /* Page program on the instruction lines of the read command */
+        cmd.Instruction = pInfo->ProgramInstruction;
+        cmd.AddressMode = (cmd.InstructionMode == HAL_OSPI_INSTRUCTION_1_LINE) ? HAL_OSPI_ADDRESS_1_LINE :
+                          cmd.AddressMode;
+        cmd.DataMode    = (cmd.InstructionMode == HAL_OSPI_INSTRUCTION_1_LINE) ? HAL_OSPI_DATA_1_LINE :
+                          cmd.DataMode;
+      }
+
+      status = HAL_OSPI_Command(hospi, &cmd, hospi->Timeout);
+    }
+
+    if (status == HAL_OK)
+    {
+      status = HAL_OSPI_MemoryMapped(hospi, cfg);
+    }
+  }
+
+  /* Return function status */
+  return status;
+}
+
 /**
   * @}
   */
@@ -3225,6 +3711,141 @@ static HAL_StatusTypeDef OSPIM_GetConfig(uint8_t instance_nb, OSPIM_CfgTypeDef *
   return status;
 }
 
+/**
+  * @brief  Read a DWORD of an SFDP table.
+  * @param  pTable : pointer to the table
+  * @param  Index  : DWORD number, starting from 1 as in JESD216
+  * @retval DWORD value
+  */
+static uint32_t OSPI_SFDP_GetDword(const uint8_t *pTable, uint32_t Index)
+{
+  const uint8_t *dword = &pTable[(Index - 1U) * 4U];
+
+  /* SFDP tables are little endian */
+  return (((uint32_t)dword[3] << 24U) | ((uint32_t)dword[2] << 16U) | ((uint32_t)dword[1] << 8U) |
+          (uint32_t)dword[0]);
+}
+
+/**
+  * @brief  Look for a parameter table in the SFDP parameter headers.
+  * @param  pSfdp   : pointer to the SFDP area
+  * @param  Size    : Number of bytes of the SFDP area
+  * @param  Id      : Parameter ID of the table
+  * @param  pLength : Number of DWORDs of the table
+  * @note   When several revisions of the table are described, the latest one fitting in the
+  *         buffer is used.
+  * @retval Offset of the parameter header, 0 if the table is not found
+  */
+static uint32_t OSPI_SFDP_FindTable(const uint8_t *pSfdp, uint32_t Size, uint32_t Id, uint32_t *pLength)
+{
+  uint32_t header;
+  uint32_t found = 0U;
+  uint32_t end = 8U + (((uint32_t)pSfdp[6] + 1U) * 8U);
+
+  if (end > Size)
+  {
+    end = Size;
+  }
+
+  for (header = 8U; (header + 8U) <= end; header += 8U)
+  {
+    /* Major revision 1 tables only, the pointer and the length must be within the buffer */
+    if (((((uint32_t)pSfdp[header + 7U] << 8U) | (uint32_t)pSfdp[header]) == Id) && (pSfdp[header + 2U] == 1U) &&
+        (pSfdp[header + 3U] != 0U) &&
+        ((OSPI_SFDP_TABLE_POINTER(pSfdp, header) + ((uint32_t)pSfdp[header + 3U] * 4U)) <= Size))
+    {
+      if ((found == 0U) || (pSfdp[header + 1U] >= pSfdp[found + 1U]))
+      {
+        found = header;
+        *pLength = pSfdp[header + 3U];
+      }
+    }
+  }
+
+  return found;
+}
+
+/**
+  * @brief  Store the settings of a read mode described by the Basic Flash Parameter Table.
+  * @param  pInfo    : pointer to the flash parameters
+  * @param  Index    : bit position of the mode in @ref OSPI_SFDP_ReadMode
+  * @param  Settings : instruction in bits 15:8, mode clocks in bits 7:5 and wait states in bits 4:0
+  * @retval None
+  */
+static void OSPI_SFDP_SetRead(OSPI_SFDPTypeDef *pInfo, uint32_t Index, uint32_t Settings)
+{
+  pInfo->Read[Index].Instruction = (Settings >> 8U) & 0xFFU;
+  pInfo->Read[Index].ModeClocks  = (Settings >> 5U) & 0x7U;
+  pInfo->Read[Index].DummyCycles = Settings & 0x1FU;
+
+  if (pInfo->Read[Index].Instruction != 0U)
+  {
+    pInfo->ReadModes |= (1UL << Index);
+  }
+}
+
+/**
+  * @brief  Replace a read instruction by its 4-byte address version.
+  * @param  pInfo       : pointer to the flash parameters
+  * @param  Index       : bit position of the mode in @ref OSPI_SFDP_ReadMode
+  * @param  Dword       : first DWORD of the 4-byte Address Instruction Table
+  * @param  Bit         : bit of the instruction support in Dword
+  * @param  Instruction : 4-byte address instruction
+  * @note   The mode is removed from the supported modes if the instruction is not supported.
+  * @retval None
+  */
+static void OSPI_SFDP_Set4ByteRead(OSPI_SFDPTypeDef *pInfo, uint32_t Index, uint32_t Dword, uint32_t Bit,
+                                   uint32_t Instruction)
+{
+  if ((Dword & (1UL << Bit)) != 0U)
+  {
+    pInfo->Read[Index].Instruction = Instruction;
+  }
+  else
+  {
+    pInfo->ReadModes &= ~(1UL << Index);
+  }
+}
+
+/**
+  * @brief  Get the 8D-8D-8D wait states for a clock frequency.
+  * @param  pInfo     : pointer to the flash parameters
+  * @param  ClockFreq : OSPI clock frequency in Hz, 0 for the highest frequency supported by the memory
+  * @note   The wait states of the lowest described frequency not below ClockFreq are used. The
+  *         value is rounded up to an even number, as expected by most octal DTR memories.
+  * @retval Number of wait states
+  */
+static uint32_t OSPI_SFDP_GetOctalDtrDummy(const OSPI_SFDPTypeDef *pInfo, uint32_t ClockFreq)
+{
+  static const uint32_t frequency[4] = {100000000U, 133000000U, 166000000U, 200000000U};
+  uint32_t dummy = 0U;
+  uint32_t index;
+
+  if (ClockFreq != 0U)
+  {
+    for (index = 0U; (index < 4U) && (dummy == 0U); index++)
+    {
+      if (ClockFreq <= frequency[index])
+      {
+        dummy = pInfo->OctalDtrDummyCycles[index];
+      }
+    }
+  }
+
+  /* Use the wait states of the highest supported frequency, which are enough at any lower frequency */
+  for (index = 4U; (index > 0U) && (dummy == 0U); index--)
+  {
+    dummy = pInfo->OctalDtrDummyCycles[index - 1U];
+  }
+
+  if (dummy == 0U)
+  {
+    dummy = OSPI_SFDP_OCTAL_DTR_DUMMY_CYCLES;
+  }
+
+  return ((dummy + 1U) & ~1UL);
+}
+
 /**
   @endcond
   */
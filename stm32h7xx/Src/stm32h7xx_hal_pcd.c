@@ -50,6 +50,21 @@
      (#)Enable PCD transmission and reception:
          (##) HAL_PCD_Start();
 
+     (#)Isochronous streaming: open the isochronous endpoint(s) with HAL_PCD_EP_Open(),
+        fill a PCD_IsoStreamTypeDef with a ring of packet buffers and call
+        HAL_PCD_ISO_StreamStart(). One packet is then submitted or armed on each SOF:
+         (##) IN stream: queue packets with HAL_PCD_ISO_StreamWrite(), a zero length
+              packet is sent and the underruns counter incremented when the ring is empty.
+         (##) OUT stream: fetch packets with HAL_PCD_ISO_StreamRead(), the overruns
+              counter is incremented when the ring is full.
+         (##) Feedback endpoint: update the value with HAL_PCD_ISO_StreamSetFeedback(),
+              it is sent every fb_interval SOF.
+
+     (#)DMA mode: the OTG internal DMA only handles word aligned buffers. The transfers
+        of HAL_PCD_EP_Transmit() and HAL_PCD_EP_Receive() on a buffer which is not word
+        aligned go through one of HAL_PCD_DMA_BOUNCE_BUFFER_NBR bounce buffers of
+        HAL_PCD_DMA_BOUNCE_BUFFER_SIZE bytes, at the cost of a copy.
+
   @endverbatim
   ******************************************************************************
   */
@@ -72,6 +87,19 @@
 
 /* Private types -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
+/** @defgroup PCD_Private_Variables PCD Private Variables
+  * @{
+  */
+/* Bounce buffers of the DMA transfers whose buffer is not word aligned */
+static ALIGN_32BYTES(uint8_t PCD_BounceBuffer[HAL_PCD_DMA_BOUNCE_BUFFER_NBR][HAL_PCD_DMA_BOUNCE_BUFFER_SIZE]);
+/* Endpoint owning each bounce buffer, NULL when the buffer is free */
+static const PCD_EPTypeDef *PCD_BounceOwner[HAL_PCD_DMA_BOUNCE_BUFFER_NBR];
+/* Application buffer of the transfer served by each bounce buffer */
+static uint8_t *PCD_BounceAppBuffer[HAL_PCD_DMA_BOUNCE_BUFFER_NBR];
+/**
+  * @}
+  */
+
 /* Private constants ---------------------------------------------------------*/
 /* Private macros ------------------------------------------------------------*/
 /** @defgroup PCD_Private_Macros PCD Private Macros
@@ -92,6 +120,10 @@ static HAL_StatusTypeDef PCD_WriteEmptyTxFifo(PCD_HandleTypeDef *hpcd, uint32_t
 static HAL_StatusTypeDef PCD_EP_OutXfrComplete_int(PCD_HandleTypeDef *hpcd, uint32_t epnum);
 static HAL_StatusTypeDef PCD_EP_OutSetupPacket_int(PCD_HandleTypeDef *hpcd, uint32_t epnum);
 #endif /* defined (USB_OTG_FS) || defined (USB_OTG_HS) */
+static void PCD_ISO_StreamSOF(PCD_HandleTypeDef *hpcd);
+static void PCD_ISO_StreamIncomplete(const PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
+static uint8_t *PCD_BounceStart(const PCD_EPTypeDef *ep, uint8_t *pBuf, uint32_t len);
+static void PCD_BounceEnd(const PCD_EPTypeDef *ep, uint32_t count);
 /**
   * @}
   */
@@ -168,6 +200,9 @@ HAL_StatusTypeDef HAL_PCD_Init(PCD_HandleTypeDef *hpcd)
 
   hpcd->State = HAL_PCD_STATE_BUSY;
 
+  /* No isochronous stream attached */
+  hpcd->pIsoStream = NULL;
+
   /* Disable the Interrupts */
   __HAL_PCD_DISABLE(hpcd);
 
@@ -1153,6 +1188,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
             if (ep->is_iso_incomplete == 1U)
             {
               ep->is_iso_incomplete = 0U;
+              PCD_ISO_StreamIncomplete(hpcd, (uint8_t)epnum);
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
               hpcd->ISOOUTIncompleteCallback(hpcd, (uint8_t)epnum);
@@ -1203,6 +1239,8 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
 
             if (hpcd->Init.dma_enable == 1U)
             {
+              PCD_BounceEnd(&hpcd->IN_ep[epnum], 0U);
+
               hpcd->IN_ep[epnum].xfer_buff += hpcd->IN_ep[epnum].maxpacket;
 
               /* this is ZLP, so prepare EP0 for next setup */
@@ -1240,6 +1278,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
             if (ep->is_iso_incomplete == 1U)
             {
               ep->is_iso_incomplete = 0U;
+              PCD_ISO_StreamIncomplete(hpcd, (uint8_t)(epnum | 0x80U));
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
               hpcd->ISOINIncompleteCallback(hpcd, (uint8_t)epnum);
@@ -1400,6 +1439,8 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
     /* Handle SOF Interrupt */
     if (__HAL_PCD_GET_FLAG(hpcd, USB_OTG_GINTSTS_SOF))
     {
+      PCD_ISO_StreamSOF(hpcd);
+
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->SOFCallback(hpcd);
 #else
@@ -1829,6 +1870,10 @@ HAL_StatusTypeDef HAL_PCD_EP_Close(PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
   __HAL_LOCK(hpcd);
   (void)USB_DeactivateEndpoint(hpcd->Instance, ep);
   __HAL_UNLOCK(hpcd);
+
+  /* Release the bounce buffer of a pending transfer */
+  PCD_BounceEnd(ep, 0U);
+
   return HAL_OK;
 }
 
@@ -1839,11 +1884,15 @@ HAL_StatusTypeDef HAL_PCD_EP_Close(PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
   * @param  ep_addr endpoint address
   * @param  pBuf pointer to the reception buffer
   * @param  len amount of data to be received
+  * @note   In DMA mode a buffer which is not word aligned is transferred through a bounce
+  *         buffer: HAL_ERROR is returned when no bounce buffer is free or when the transfer
+  *         exceeds HAL_PCD_DMA_BOUNCE_BUFFER_SIZE bytes.
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_PCD_EP_Receive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t *pBuf, uint32_t len)
 {
   PCD_EPTypeDef *ep;
+  uint8_t *pDmaBuf = pBuf;
 
   ep = &hpcd->OUT_ep[ep_addr & EP_ADDR_MSK];
 
@@ -1856,7 +1905,17 @@ HAL_StatusTypeDef HAL_PCD_EP_Receive(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, u
 
   if (hpcd->Init.dma_enable == 1U)
   {
-    ep->dma_addr = (uint32_t)pBuf;
+    /* The OTG internal DMA only handles word aligned buffers */
+    if ((len != 0U) && (((uint32_t)pBuf & 0x3U) != 0U))
+    {
+      pDmaBuf = PCD_BounceStart(ep, pBuf, len);
+      if (pDmaBuf == NULL)
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    ep->dma_addr = (uint32_t)pDmaBuf;
   }
 
   (void)USB_EPStartXfer(hpcd->Instance, ep, (uint8_t)hpcd->Init.dma_enable);
@@ -1880,11 +1939,15 @@ uint32_t HAL_PCD_EP_GetRxCount(PCD_HandleTypeDef const *hpcd, uint8_t ep_addr)
   * @param  ep_addr endpoint address
   * @param  pBuf pointer to the transmission buffer
   * @param  len amount of data to be sent
+  * @note   In DMA mode a buffer which is not word aligned is transferred through a bounce
+  *         buffer: HAL_ERROR is returned when no bounce buffer is free or when the transfer
+  *         exceeds HAL_PCD_DMA_BOUNCE_BUFFER_SIZE bytes.
   * @retval HAL status
   */
 HAL_StatusTypeDef HAL_PCD_EP_Transmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr, uint8_t *pBuf, uint32_t len)
 {
   PCD_EPTypeDef *ep;
+  uint8_t *pDmaBuf = pBuf;
 
   ep = &hpcd->IN_ep[ep_addr & EP_ADDR_MSK];
 
@@ -1897,7 +1960,17 @@ HAL_StatusTypeDef HAL_PCD_EP_Transmit(PCD_HandleTypeDef *hpcd, uint8_t ep_addr,
 
   if (hpcd->Init.dma_enable == 1U)
   {
-    ep->dma_addr = (uint32_t)pBuf;
+    /* The OTG internal DMA only handles word aligned buffers */
+    if ((len != 0U) && (((uint32_t)pBuf & 0x3U) != 0U))
+    {
+      pDmaBuf = PCD_BounceStart(ep, pBuf, len);
+      if (pDmaBuf == NULL)
+      {
+        return HAL_ERROR;
+      }
+    }
+
+    ep->dma_addr = (uint32_t)pDmaBuf;
   }
 
   (void)USB_EPStartXfer(hpcd->Instance, ep, (uint8_t)hpcd->Init.dma_enable);
@@ -2007,6 +2080,9 @@ HAL_StatusTypeDef HAL_PCD_EP_Abort(PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
   /* Stop Xfer */
   ret = USB_EPStopXfer(hpcd->Instance, ep);
 
+  /* Release the bounce buffer of the aborted transfer */
+  PCD_BounceEnd(ep, 0U);
+
   return ret;
 }
 
@@ -2054,6 +2130,199 @@ HAL_StatusTypeDef HAL_PCD_DeActivateRemoteWakeup(PCD_HandleTypeDef *hpcd)
   return (USB_DeActivateRemoteWakeup(hpcd->Instance));
 }
 
+/**
+  * @brief  Start an isochronous stream served on each SOF.
+  * @note   One packet is submitted (IN) or armed (OUT) per (micro)frame, the
+  *         endpoint must have been opened as EP_TYPE_ISOC with a bInterval of 1.
+  *         The data endpoint must not be handled by the DataIn/DataOut stage
+  *         callbacks while the stream is running.
+  * @param  hpcd PCD handle
+  * @param  pStream stream structure, ep_addr, fb_* and ring fields filled by the caller
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamStart(PCD_HandleTypeDef *hpcd, PCD_IsoStreamTypeDef *pStream)
+{
+  PCD_EPTypeDef *ep;
+
+  if ((pStream == NULL) || (pStream->buff == NULL) || (pStream->length == NULL) ||
+      (pStream->depth == 0U) || (pStream->maxpacket == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pStream->fb_ep_addr != 0U) &&
+      (((pStream->fb_ep_addr & 0x80U) == 0U) || (pStream->fb_interval == 0U) ||
+       ((pStream->fb_size != 3U) && (pStream->fb_size != 4U))))
+  {
+    return HAL_ERROR;
+  }
+
+#if defined (USB_OTG_FS) || defined (USB_OTG_HS)
+  /* SOF interrupt is needed to serve the stream, and the DMA needs word aligned slots */
+  if ((hpcd->Init.Sof_enable == 0U) ||
+      ((hpcd->Init.dma_enable == 1U) && ((((uint32_t)pStream->buff | pStream->maxpacket) & 0x3U) != 0U)))
+  {
+    return HAL_ERROR;
+  }
+#endif /* defined (USB_OTG_FS) || defined (USB_OTG_HS) */
+
+  if ((0x80U & pStream->ep_addr) == 0x80U)
+  {
+    ep = &hpcd->IN_ep[pStream->ep_addr & EP_ADDR_MSK];
+  }
+  else
+  {
+    ep = &hpcd->OUT_ep[pStream->ep_addr & EP_ADDR_MSK];
+  }
+
+  if ((ep->type != EP_TYPE_ISOC) || (pStream->maxpacket < ep->maxpacket))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hpcd);
+
+  pStream->head = 0U;
+  pStream->tail = 0U;
+  pStream->pending = 0U;
+  pStream->fb_count = 0U;
+  pStream->underruns = 0U;
+  pStream->overruns = 0U;
+  pStream->incomplete = 0U;
+
+  /* Attach the stream, it is served from the next SOF */
+  pStream->next = hpcd->pIsoStream;
+  hpcd->pIsoStream = pStream;
+
+  __HAL_UNLOCK(hpcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop an isochronous stream.
+  * @note   The endpoint is left open, a packet already submitted may still complete.
+  * @param  hpcd PCD handle
+  * @param  pStream stream structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamStop(PCD_HandleTypeDef *hpcd, PCD_IsoStreamTypeDef *pStream)
+{
+  PCD_IsoStreamTypeDef **pLink;
+  HAL_StatusTypeDef ret = HAL_ERROR;
+
+  __HAL_LOCK(hpcd);
+
+  pLink = &hpcd->pIsoStream;
+
+  while ((*pLink != NULL) && (ret != HAL_OK))
+  {
+    if (*pLink == pStream)
+    {
+      /* Detach the stream */
+      *pLink = pStream->next;
+      ret = HAL_OK;
+    }
+    else
+    {
+      pLink = &(*pLink)->next;
+    }
+  }
+
+  __HAL_UNLOCK(hpcd);
+
+  return ret;
+}
+
+/**
+  * @brief  Queue a packet on an isochronous IN stream.
+  * @param  pStream stream structure
+  * @param  pBuf pointer to the packet data
+  * @param  len packet length, at most maxpacket
+  * @retval HAL status, HAL_BUSY when the ring is full
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamWrite(PCD_IsoStreamTypeDef *pStream, const uint8_t *pBuf, uint32_t len)
+{
+  uint8_t *pSlot;
+  uint32_t slot;
+  uint32_t count;
+
+  if (((pStream->ep_addr & 0x80U) == 0U) || (len > pStream->maxpacket))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pStream->head - pStream->tail) >= pStream->depth)
+  {
+    return HAL_BUSY;
+  }
+
+  slot = pStream->head % pStream->depth;
+  pSlot = &pStream->buff[slot * pStream->maxpacket];
+
+  for (count = 0U; count < len; count++)
+  {
+    pSlot[count] = pBuf[count];
+  }
+
+  pStream->length[slot] = (uint16_t)len;
+
+  /* Publish the packet to the SOF handler */
+  pStream->head++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Fetch the oldest packet received on an isochronous OUT stream.
+  * @param  pStream stream structure
+  * @param  pBuf pointer to a buffer of at least maxpacket bytes
+  * @param  pLen returned packet length
+  * @retval HAL status, HAL_BUSY when the ring is empty
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamRead(PCD_IsoStreamTypeDef *pStream, uint8_t *pBuf, uint32_t *pLen)
+{
+  const uint8_t *pSlot;
+  uint32_t slot;
+  uint32_t count;
+
+  if ((pStream->ep_addr & 0x80U) == 0x80U)
+  {
+    return HAL_ERROR;
+  }
+
+  if (pStream->head == pStream->tail)
+  {
+    return HAL_BUSY;
+  }
+
+  slot = pStream->tail % pStream->depth;
+  pSlot = &pStream->buff[slot * pStream->maxpacket];
+
+  for (count = 0U; count < (uint32_t)pStream->length[slot]; count++)
+  {
+    pBuf[count] = pSlot[count];
+  }
+
+  *pLen = (uint32_t)pStream->length[slot];
+
+  /* Give the slot back to the SOF handler */
+  pStream->tail++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Update the value sent on the feedback endpoint of a stream.
+  * @param  pStream stream structure
+  * @param  feedback feedback value, 10.14 (full speed) or 16.16 (high speed) format
+  * @retval None
+  */
+void HAL_PCD_ISO_StreamSetFeedback(PCD_IsoStreamTypeDef *pStream, uint32_t feedback)
+{
+  pStream->fb_value = feedback;
+}
+
 /**
   * @}
   */
@@ -2230,6 +2499,9 @@ static HAL_StatusTypeDef PCD_EP_OutXfrComplete_int(PCD_HandleTypeDef *hpcd, uint
         /* out data packet received over EP */
         ep->xfer_count = ep->xfer_size - (USBx_OUTEP(epnum)->DOEPTSIZ & USB_OTG_DOEPTSIZ_XFRSIZ);
 
+        /* Copy the data received in a bounce buffer to the application buffer */
+        PCD_BounceEnd(ep, PCD_MIN(ep->xfer_count, ep->xfer_len));
+
         if (epnum == 0U)
         {
           if (ep->xfer_len == 0U)
@@ -2333,6 +2605,208 @@ static HAL_StatusTypeDef PCD_EP_OutSetupPacket_int(PCD_HandleTypeDef *hpcd, uint
 }
 #endif /* defined (USB_OTG_FS) || defined (USB_OTG_HS) */
 
+
+/**
+  * @brief  Serve the isochronous streams on SOF.
+  * @param  hpcd PCD handle
+  * @retval None
+  */
+static void PCD_ISO_StreamSOF(PCD_HandleTypeDef *hpcd)
+{
+  PCD_IsoStreamTypeDef *pStream = hpcd->pIsoStream;
+  uint32_t slot;
+  uint32_t len;
+
+  while (pStream != NULL)
+  {
+    if ((pStream->ep_addr & 0x80U) == 0x80U)
+    {
+      /* The packet submitted on the previous SOF went out during the last frame */
+      if (pStream->pending != 0U)
+      {
+        pStream->pending = 0U;
+        pStream->tail++;
+      }
+
+      if (pStream->head != pStream->tail)
+      {
+        slot = pStream->tail % pStream->depth;
+        pStream->pending = 1U;
+
+        (void)HAL_PCD_EP_Transmit(hpcd, pStream->ep_addr, &pStream->buff[slot * pStream->maxpacket],
+                                  (uint32_t)pStream->length[slot]);
+      }
+      else
+      {
+        /* Nothing queued, keep the stream running with a zero length packet */
+        pStream->underruns++;
+        (void)HAL_PCD_EP_Transmit(hpcd, pStream->ep_addr, NULL, 0U);
+      }
+    }
+    else
+    {
+      /* Commit the packet received during the last frame, if any */
+      if (pStream->pending != 0U)
+      {
+        pStream->pending = 0U;
+        len = HAL_PCD_EP_GetRxCount(hpcd, pStream->ep_addr);
+
+        if (len != 0U)
+        {
+          pStream->length[pStream->head % pStream->depth] = (uint16_t)len;
+          pStream->head++;
+        }
+      }
+
+      if ((pStream->head - pStream->tail) < pStream->depth)
+      {
+        slot = pStream->head % pStream->depth;
+        pStream->pending = 1U;
+
+        (void)HAL_PCD_EP_Receive(hpcd, pStream->ep_addr, &pStream->buff[slot * pStream->maxpacket],
+                                 pStream->maxpacket);
+      }
+      else
+      {
+        /* Ring full, the packet of this frame is dropped */
+        pStream->overruns++;
+      }
+    }
+
+    if (pStream->fb_ep_addr != 0U)
+    {
+      pStream->fb_count++;
+
+      if (pStream->fb_count >= (uint32_t)pStream->fb_interval)
+      {
+        pStream->fb_count = 0U;
+        pStream->fb_buff = pStream->fb_value;
+
+        (void)HAL_PCD_EP_Transmit(hpcd, pStream->fb_ep_addr, (uint8_t *)&pStream->fb_buff,
+                                  (uint32_t)pStream->fb_size);
+      }
+    }
+
+    pStream = pStream->next;
+  }
+}
+
+/**
+  * @brief  Account an incomplete isochronous transfer on the matching stream.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @retval None
+  */
+static void PCD_ISO_StreamIncomplete(const PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
+{
+  PCD_IsoStreamTypeDef *pStream = hpcd->pIsoStream;
+
+  while (pStream != NULL)
+  {
+    if (pStream->ep_addr == ep_addr)
+    {
+      pStream->incomplete++;
+    }
+
+    pStream = pStream->next;
+  }
+}
+
+/**
+  * @brief  Take a bounce buffer for the DMA transfer of a buffer which is not word aligned.
+  * @note   The data of an IN transfer is copied to the bounce buffer, the data of an OUT
+  *         transfer is copied back to the application buffer by PCD_BounceEnd().
+  * @param  ep endpoint
+  * @param  pBuf application buffer
+  * @param  len amount of data to transfer
+  * @retval Bounce buffer address, NULL when no buffer is free or when it is too small
+  */
+static uint8_t *PCD_BounceStart(const PCD_EPTypeDef *ep, uint8_t *pBuf, uint32_t len)
+{
+  uint8_t *pDmaBuf = NULL;
+  uint32_t size = len;
+  uint32_t index = 0U;
+  uint32_t count;
+  uint32_t primask;
+
+  /* Release the bounce buffer of a previous transfer of the endpoint */
+  PCD_BounceEnd(ep, 0U);
+
+  /* The DMA of an OUT endpoint writes whole packets */
+  if ((ep->is_in == 0U) && (ep->maxpacket != 0U))
+  {
+    size = ((len + ep->maxpacket - 1U) / ep->maxpacket) * ep->maxpacket;
+  }
+
+  if (size <= HAL_PCD_DMA_BOUNCE_BUFFER_SIZE)
+  {
+    /* Transfers may be started from the thread and from the PCD callbacks */
+    primask = __get_PRIMASK();
+    __disable_irq();
+    while ((index < HAL_PCD_DMA_BOUNCE_BUFFER_NBR) && (PCD_BounceOwner[index] != NULL))
+    {
+      index++;
+    }
+    if (index < HAL_PCD_DMA_BOUNCE_BUFFER_NBR)
+    {
+      PCD_BounceOwner[index] = ep;
+    }
+    __set_PRIMASK(primask);
+
+    if (index < HAL_PCD_DMA_BOUNCE_BUFFER_NBR)
+    {
+      pDmaBuf = PCD_BounceBuffer[index];
+      PCD_BounceAppBuffer[index] = pBuf;
+
+      if (ep->is_in == 1U)
+      {
+        for (count = 0U; count < len; count++)
+        {
+          pDmaBuf[count] = pBuf[count];
+        }
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+        HAL_DCACHE_CleanForDMA(pDmaBuf, len);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+      }
+    }
+  }
+
+  return pDmaBuf;
+}
+
+/**
+  * @brief  Release the bounce buffer of an endpoint, if any.
+  * @param  ep endpoint
+  * @param  count amount of received data to copy to the application buffer
+  * @retval None
+  */
+static void PCD_BounceEnd(const PCD_EPTypeDef *ep, uint32_t count)
+{
+  uint32_t index = 0U;
+  uint32_t i;
+
+  while ((index < HAL_PCD_DMA_BOUNCE_BUFFER_NBR) && (PCD_BounceOwner[index] != ep))
+  {
+    index++;
+  }
+
+  if (index < HAL_PCD_DMA_BOUNCE_BUFFER_NBR)
+  {
+    if (count != 0U)
+    {
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+      HAL_DCACHE_SyncRxDMA(ep, PCD_BounceBuffer[index], count);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+      for (i = 0U; i < count; i++)
+      {
+        PCD_BounceAppBuffer[index][i] = PCD_BounceBuffer[index][i];
+      }
+    }
+
+    PCD_BounceOwner[index] = NULL;
+  }
+}
+
 /**
   * @}
   */
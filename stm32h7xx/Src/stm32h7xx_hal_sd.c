@@ -151,6 +151,39 @@
         through HAL_SD_GetCardState() function for SD card state.
         You could also check the IT transfer process through the SD Tx interrupt event.
 
+  *** SD Card streaming write ***
+  ===============================
+  [..]
+    (+) A stream keeps one Write Multi Block command (CMD25) open across an unbounded
+        sequence of buffers, so that no stop command and no programming busy is spent
+        between the buffers. Fill a SD_StreamTypeDef with a ring of buffer pointers
+        (pQueue, NbSlots), the size of the buffers in blocks (BufferBlocks) and an optional
+        BufferCpltCallback, then call HAL_SD_StreamOpen() with the first card block.
+    (+) Queue each filled buffer with HAL_SD_StreamWrite(). The queued buffers are sent by
+        the internal DMA in its double buffer mode; each one is handed back through
+        BufferCpltCallback once it has been read. HAL_SD_StreamWrite() returns HAL_BUSY
+        while the ring is full and HAL_SD_StreamGetFreeSlots() reports the room left, so
+        that the producer can throttle itself.
+    (+) When the producer falls behind, the data path stops after the last queued buffer
+        and the card keeps waiting inside the open CMD25; the Stalls field counts these
+        events. The next HAL_SD_StreamWrite() resumes the data path.
+    (+) Call HAL_SD_StreamClose() to end the stream. If buffers are still being written,
+        the stop command is sent after the last one and HAL_SD_TxCpltCallback() is called.
+    (+) A transfer error ends the stream in the SD_STREAM_STATE_ERROR state and calls
+        HAL_SD_ErrorCallback(); the buffers still queued are not written.
+
+  *** SD Card sampling point tuning ***
+  ====================================
+  [..]
+    (+) In SDR104 mode, the receive data are sampled with the feedback clock delayed by the
+        delay block. Once the SDMMC kernel clock is raised to its final frequency, call
+        HAL_SD_ExecuteTuning(): it sweeps the delay block output phases, reads the tuning
+        block (CMD19) at each phase and selects the centre of the widest window of phases
+        reading it correctly. The selected phase is kept in the TuningPhase field of the handle.
+    (+) Data CRC errors are counted in the TuningCrcErrors field of the handle. When
+        SD_RETUNE_CRC_ERRORS errors have been counted, the tuning is executed again at the
+        start of the next read or write operation.
+
   *** SD card status ***
   ======================
   [..]
@@ -272,6 +305,9 @@
 #define SD_INIT_FREQ                   400000U   /* Initialization phase : 400 kHz max */
 #define SD_NORMAL_SPEED_FREQ           25000000U /* Normal speed phase : 25 MHz max */
 #define SD_HIGH_SPEED_FREQ             50000000U /* High speed phase : 50 MHz max */
+/* Sampling point tuning: data timeout in SDMMC clock cycles and software timeout in ms */
+#define SD_TUNING_DATATIMEOUT          0x00100000U
+#define SD_TUNING_TIMEOUT              10U
 /* Private macro -------------------------------------------------------------*/
 #if defined (DLYB_SDMMC1) && defined (DLYB_SDMMC2)
 #define SD_GET_DLYB_INSTANCE(SDMMC_INSTANCE) (((SDMMC_INSTANCE) == SDMMC1)?  \
@@ -279,6 +315,11 @@
 #elif defined (DLYB_SDMMC1)
 #define SD_GET_DLYB_INSTANCE(SDMMC_INSTANCE) ( DLYB_SDMMC1 )
 #endif /* (DLYB_SDMMC1) && defined (DLYB_SDMMC2) */
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+#define SD_TUNING_CRC_ERROR(HANDLE) ((HANDLE)->TuningCrcErrors++)
+#else
+#define SD_TUNING_CRC_ERROR(HANDLE) UNUSED(HANDLE)
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
 
 /**
   * @}
@@ -305,6 +346,16 @@ static uint32_t SD_SwitchSpeed(SD_HandleTypeDef *hsd, uint32_t SwitchSpeedMode);
 static uint32_t SD_UltraHighSpeed(SD_HandleTypeDef *hsd, uint32_t UltraHighSpeedMode);
 static uint32_t SD_DDR_Mode(SD_HandleTypeDef *hsd);
 #endif /* USE_SD_TRANSCEIVER */
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+static uint32_t SD_Tuning(SD_HandleTypeDef *hsd);
+static uint32_t SD_SendTuningBlock(SD_HandleTypeDef *hsd);
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+static void     SD_TuningCheck(SD_HandleTypeDef *hsd);
+static uint32_t SD_StreamStart(SD_HandleTypeDef *hsd);
+static void     SD_StreamRelease(SD_StreamTypeDef *hstream);
+static void     SD_StreamBufferCplt(SD_HandleTypeDef *hsd);
+static void     SD_StreamDataEnd(SD_HandleTypeDef *hsd);
+static void     SD_StreamDetach(SD_HandleTypeDef *hsd, uint32_t State);
 /**
   * @}
   */
@@ -447,6 +498,15 @@ HAL_StatusTypeDef HAL_SD_Init(SD_HandleTypeDef *hsd)
     }
   }
 
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+  /* No sampling point tuning done yet */
+  hsd->TuningPhase = 0U;
+  hsd->TuningCrcErrors = 0U;
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
+  /* No streaming write attached */
+  hsd->pStream = NULL;
+
   /* Initialize the error code */
   hsd->ErrorCode = HAL_SD_ERROR_NONE;
 
@@ -695,6 +755,8 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks(SD_HandleTypeDef *hsd, uint8_t *pData, uint3
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
+    SD_TuningCheck(hsd);
+
     hsd->ErrorCode = HAL_SD_ERROR_NONE;
 
     if ((add + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
@@ -816,6 +878,7 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks(SD_HandleTypeDef *hsd, uint8_t *pData, uint3
       /* Clear all the static flags */
       __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
       hsd->ErrorCode |= HAL_SD_ERROR_DATA_CRC_FAIL;
+      SD_TUNING_CRC_ERROR(hsd);
       hsd->State = HAL_SD_STATE_READY;
       hsd->Context = SD_CONTEXT_NONE;
       return HAL_ERROR;
@@ -880,6 +943,8 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks(SD_HandleTypeDef *hsd, const uint8_t *pData
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
+    SD_TuningCheck(hsd);
+
     hsd->ErrorCode = HAL_SD_ERROR_NONE;
 
     if ((add + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
@@ -1002,6 +1067,7 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks(SD_HandleTypeDef *hsd, const uint8_t *pData
       /* Clear all the static flags */
       __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
       hsd->ErrorCode |= HAL_SD_ERROR_DATA_CRC_FAIL;
+      SD_TUNING_CRC_ERROR(hsd);
       hsd->State = HAL_SD_STATE_READY;
       hsd->Context = SD_CONTEXT_NONE;
       return HAL_ERROR;
@@ -1062,6 +1128,8 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_IT(SD_HandleTypeDef *hsd, uint8_t *pData, ui
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
+    SD_TuningCheck(hsd);
+
     hsd->ErrorCode = HAL_SD_ERROR_NONE;
 
     if ((add + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
@@ -1157,6 +1225,8 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_IT(SD_HandleTypeDef *hsd, const uint8_t *pD
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
+    SD_TuningCheck(hsd);
+
     hsd->ErrorCode = HAL_SD_ERROR_NONE;
 
     if ((add + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
@@ -1254,6 +1324,8 @@ HAL_StatusTypeDef HAL_SD_ReadBlocks_DMA(SD_HandleTypeDef *hsd, uint8_t *pData, u
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
+    SD_TuningCheck(hsd);
+
     hsd->ErrorCode = HAL_SD_ERROR_NONE;
 
     if ((add + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
@@ -1352,6 +1424,8 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *p
 
   if (hsd->State == HAL_SD_STATE_READY)
   {
+    SD_TuningCheck(hsd);
+
     hsd->ErrorCode = HAL_SD_ERROR_NONE;
 
     if ((add + NumberOfBlocks) > (hsd->SdCard.LogBlockNbr))
@@ -1423,6 +1497,218 @@ HAL_StatusTypeDef HAL_SD_WriteBlocks_DMA(SD_HandleTypeDef *hsd, const uint8_t *p
   }
 }
 
+/**
+  * @brief  Open a streaming write starting at the specified card block.
+  * @note   The Write Multi Block command is sent when the first buffer is queued and stays
+  *         open until HAL_SD_StreamClose() is called.
+  * @param  hsd: Pointer to SD handle
+  * @param  hstream: Pointer to the stream structure, with pQueue, NbSlots, BufferBlocks and
+  *         BufferCpltCallback filled in
+  * @param  BlockAdd: Card block receiving the first buffer
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_StreamOpen(SD_HandleTypeDef *hsd, SD_StreamTypeDef *hstream, uint32_t BlockAdd)
+{
+  if ((hstream == NULL) || (hstream->pQueue == NULL) || (hstream->NbSlots == 0U) ||
+      (hstream->BufferBlocks == 0U) || ((hstream->BufferBlocks * BLOCKSIZE) > SDMMC_IDMABSIZE_IDMABNDT))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if (BlockAdd >= hsd->SdCard.LogBlockNbr)
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+    return HAL_ERROR;
+  }
+
+  SD_TuningCheck(hsd);
+
+  hsd->ErrorCode = HAL_SD_ERROR_NONE;
+  hsd->State = HAL_SD_STATE_BUSY;
+  hsd->Context = (SD_CONTEXT_WRITE_MULTIPLE_BLOCK | SD_CONTEXT_DMA | SD_CONTEXT_STREAM);
+  hsd->pStream = hstream;
+
+  hstream->hsd = hsd;
+  hstream->BlockAdd = BlockAdd;
+  hstream->Head = 0U;
+  hstream->Count = 0U;
+  hstream->SegmentCount = 0U;
+  hstream->SegmentPending = 0U;
+  hstream->BufferCount = 0U;
+  hstream->Stalls = 0U;
+  hstream->State = SD_STREAM_STATE_OPEN;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Queue a buffer of BufferBlocks blocks on an open stream.
+  * @note   The buffer must stay untouched until it is handed back by BufferCpltCallback.
+  * @note   A single producer is supported. This API can be called from an interrupt handler
+  *         of a lower priority than the SDMMC one.
+  * @param  hstream: Pointer to the stream structure
+  * @param  pData: Pointer to the buffer to write
+  * @retval HAL status, HAL_BUSY when the ring is full and HAL_ERROR when the stream is not open
+  */
+HAL_StatusTypeDef HAL_SD_StreamWrite(SD_StreamTypeDef *hstream, const uint8_t *pData)
+{
+  SD_HandleTypeDef *hsd;
+  uint32_t primask_bit;
+  uint32_t state;
+  uint32_t errorstate;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if ((hstream == NULL) || (pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The SD handle is only linked to a stream opened by HAL_SD_StreamOpen() */
+  state = hstream->State;
+  if ((state != SD_STREAM_STATE_OPEN) && (state != SD_STREAM_STATE_RUNNING) && (state != SD_STREAM_STATE_STARVED))
+  {
+    return HAL_ERROR;
+  }
+
+  hsd = hstream->hsd;
+
+  if (((hsd->SdCard.LogBlockNbr - hstream->BlockAdd) / hstream->BufferBlocks) <=
+      (hstream->BufferCount + hstream->Count))
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+    return HAL_ERROR;
+  }
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* The internal DMA reads the buffer from memory */
+  SCB_CleanDCache_by_Addr((uint32_t *)((uint32_t)pData), (int32_t)(hstream->BufferBlocks * BLOCKSIZE));
+#endif /* __DCACHE_PRESENT */
+
+  /* Enter critical section: the SDMMC interrupt releases buffers and restarts the data path */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  state = hstream->State;
+  if ((state != SD_STREAM_STATE_OPEN) && (state != SD_STREAM_STATE_RUNNING) && (state != SD_STREAM_STATE_STARVED))
+  {
+    status = HAL_ERROR;
+  }
+  else if (hstream->Count >= hstream->NbSlots)
+  {
+    status = HAL_BUSY;
+  }
+  else
+  {
+    hstream->pQueue[(hstream->Head + hstream->Count) % hstream->NbSlots] = pData;
+    hstream->Count++;
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  /* A running data path picks the buffer up when it ends, otherwise no interrupt is pending */
+  if ((status == HAL_OK) && (state != SD_STREAM_STATE_RUNNING))
+  {
+    errorstate = SD_StreamStart(hsd);
+    if (errorstate != HAL_SD_ERROR_NONE)
+    {
+      hsd->ErrorCode |= errorstate;
+      hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+      __SDMMC_CMDTRANS_DISABLE(hsd->Instance);
+      SD_StreamDetach(hsd, SD_STREAM_STATE_ERROR);
+      status = HAL_ERROR;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Close a stream.
+  * @note   When buffers are still being written, the stop command is sent after the last
+  *         queued one and the end of the stream is reported by HAL_SD_TxCpltCallback().
+  *         Otherwise the stream is closed before this API returns.
+  * @param  hstream: Pointer to the stream structure
+  * @retval HAL status, HAL_ERROR when hstream is NULL or the stream is not open
+  */
+HAL_StatusTypeDef HAL_SD_StreamClose(SD_StreamTypeDef *hstream)
+{
+  SD_HandleTypeDef *hsd;
+  uint32_t primask_bit;
+  uint32_t state;
+  uint32_t errorstate = HAL_SD_ERROR_NONE;
+
+  if (hstream == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Only dereferenced once the state shows the stream is open */
+  hsd = hstream->hsd;
+
+  /* Enter critical section: the data path may end at any time */
+  primask_bit = __get_PRIMASK();
+  __disable_irq();
+
+  state = hstream->State;
+  if (state == SD_STREAM_STATE_RUNNING)
+  {
+    hstream->State = SD_STREAM_STATE_CLOSING;
+  }
+
+  /* Exit critical section: restore previous priority mask */
+  __set_PRIMASK(primask_bit);
+
+  if ((state == SD_STREAM_STATE_RUNNING) || (state == SD_STREAM_STATE_CLOSING))
+  {
+    return HAL_OK;
+  }
+  else if (state == SD_STREAM_STATE_STARVED)
+  {
+    /* The card is still receiving: end the open Write Multi Block command */
+    errorstate = SDMMC_CmdStopTransfer(hsd->Instance);
+  }
+  else if (state != SD_STREAM_STATE_OPEN)
+  {
+    return HAL_ERROR;
+  }
+  else
+  {
+    /* Nothing sent to the card yet */
+  }
+
+  SD_StreamDetach(hsd, SD_STREAM_STATE_IDLE);
+
+  if (errorstate != HAL_SD_ERROR_NONE)
+  {
+    hsd->ErrorCode |= errorstate;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Return the number of buffers that can still be queued on a stream.
+  * @param  hstream: Pointer to the stream structure
+  * @retval Number of free entries of the ring, 0 when hstream is NULL
+  */
+uint32_t HAL_SD_StreamGetFreeSlots(const SD_StreamTypeDef *hstream)
+{
+  if (hstream == NULL)
+  {
+    return 0U;
+  }
+
+  return (hstream->NbSlots - hstream->Count);
+}
+
 /**
   * @brief  Erases the specified memory area of the given SD card.
   * @note   This API should be followed by a check on the card state through
@@ -1556,7 +1842,11 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
     __HAL_SD_DISABLE_IT(hsd, SDMMC_IT_IDMABTC);
     __SDMMC_CMDTRANS_DISABLE(hsd->Instance);
 
-    if ((context & SD_CONTEXT_IT) != 0U)
+    if ((context & SD_CONTEXT_STREAM) != 0U)
+    {
+      SD_StreamDataEnd(hsd);
+    }
+    else if ((context & SD_CONTEXT_IT) != 0U)
     {
       if (((context & SD_CONTEXT_READ_MULTIPLE_BLOCK) != 0U) || ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U))
       {
@@ -1652,6 +1942,7 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
     if (__HAL_SD_GET_FLAG(hsd, SDMMC_IT_DCRCFAIL) != RESET)
     {
       hsd->ErrorCode |= HAL_SD_ERROR_DATA_CRC_FAIL;
+      SD_TUNING_CRC_ERROR(hsd);
     }
     if (__HAL_SD_GET_FLAG(hsd, SDMMC_IT_DTIMEOUT) != RESET)
     {
@@ -1680,6 +1971,12 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
     hsd->Instance->CMD &= ~(SDMMC_CMD_CMDSTOP);
     __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_DABORT);
 
+    if ((context & SD_CONTEXT_STREAM) != 0U)
+    {
+      /* The buffers still queued are left to the user */
+      SD_StreamDetach(hsd, SD_STREAM_STATE_ERROR);
+    }
+
     if ((context & SD_CONTEXT_IT) != 0U)
     {
       /* Set the SD state to ready to be able to start again the process */
@@ -1717,7 +2014,11 @@ void HAL_SD_IRQHandler(SD_HandleTypeDef *hsd)
   else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_IDMABTC) != RESET)
   {
     __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_IDMABTC);
-    if (READ_BIT(hsd->Instance->IDMACTRL, SDMMC_IDMA_IDMABACT) == 0U)
+    if ((context & SD_CONTEXT_STREAM) != 0U)
+    {
+      SD_StreamBufferCplt(hsd);
+    }
+    else if (READ_BIT(hsd->Instance->IDMACTRL, SDMMC_IDMA_IDMABACT) == 0U)
     {
       /* Current buffer is buffer0, Transfer complete for buffer1 */
       if ((context & SD_CONTEXT_WRITE_MULTIPLE_BLOCK) != 0U)
@@ -2860,6 +3161,46 @@ HAL_StatusTypeDef HAL_SD_ConfigSpeedBusOperation(SD_HandleTypeDef *hsd, uint32_t
   return status;
 }
 
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/**
+  * @brief  Tune the sampling point of the receive data in SDR104 mode.
+  * @note   This API must be called after HAL_SD_ConfigSpeedBusOperation() has enabled the
+  *         SDR104 mode and the SDMMC kernel clock has been set to its final frequency.
+  * @param  hsd: Pointer to the SD handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SD_ExecuteTuning(SD_HandleTypeDef *hsd)
+{
+  uint32_t errorstate;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  /* The delay block only drives the feedback clock used for SDR104 */
+  if ((hsd->Instance->CLKCR & SDMMC_CLKCR_SELCLKRX) != SDMMC_CLKCR_SELCLKRX_1)
+  {
+    hsd->ErrorCode |= HAL_SD_ERROR_REQUEST_NOT_APPLICABLE;
+    return HAL_ERROR;
+  }
+
+  hsd->State = HAL_SD_STATE_BUSY;
+
+  errorstate = SD_Tuning(hsd);
+  if (errorstate != HAL_SD_ERROR_NONE)
+  {
+    hsd->ErrorCode |= errorstate;
+    status = HAL_ERROR;
+  }
+
+  hsd->State = HAL_SD_STATE_READY;
+
+  return status;
+}
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
 /**
   * @brief  Gets the current sd card data state.
   * @param  hsd: pointer to SD handle
@@ -2970,10 +3311,8 @@ HAL_StatusTypeDef HAL_SD_Abort(SD_HandleTypeDef *hsd)
     /* If IDMA Context, disable Internal DMA */
     hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
 
-    hsd->State = HAL_SD_STATE_READY;
-
-    /* Initialize the SD operation */
-    hsd->Context = SD_CONTEXT_NONE;
+    /* An aborted stream leaves its queued buffers to the user */
+    SD_StreamDetach(hsd, SD_STREAM_STATE_ERROR);
   }
   return HAL_OK;
 }
@@ -3001,6 +3340,13 @@ HAL_StatusTypeDef HAL_SD_Abort_IT(SD_HandleTypeDef *hsd)
   CardState = HAL_SD_GetCardState(hsd);
   hsd->State = HAL_SD_STATE_READY;
 
+  /* An aborted stream leaves its queued buffers to the user */
+  if (hsd->pStream != NULL)
+  {
+    hsd->pStream->State = SD_STREAM_STATE_ERROR;
+    hsd->pStream = NULL;
+  }
+
   if ((CardState == HAL_SD_CARD_RECEIVING) || (CardState == HAL_SD_CARD_SENDING))
   {
     hsd->ErrorCode = SDMMC_CmdStopTransfer(hsd->Instance);
@@ -4081,6 +4427,400 @@ static uint32_t SD_DDR_Mode(SD_HandleTypeDef *hsd)
 
 #endif /* USE_SD_TRANSCEIVER */
 
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+/**
+  * @brief  Sweep the delay block phases and select the centre of the widest passing window.
+  * @note   On failure, the delay block is set back to its default phase.
+  * @param  hsd: Pointer to SD handle
+  * @retval SD Card error state
+  */
+static uint32_t SD_Tuning(SD_HandleTypeDef *hsd)
+{
+  DLYB_TypeDef *dlyb = SD_GET_DLYB_INSTANCE(hsd->Instance);
+  uint32_t units;
+  uint32_t phase;
+  uint32_t start = 0U;
+  uint32_t length = 0U;
+  uint32_t best_start = 0U;
+  uint32_t best_length = 0U;
+  uint32_t errorstate = HAL_SD_ERROR_NONE;
+
+  /* Measure the delay line for the current kernel clock */
+  if (DelayBlock_Enable(dlyb) != HAL_OK)
+  {
+    return HAL_SD_ERROR_GENERAL_UNKNOWN_ERR;
+  }
+  units = (dlyb->CFGR & DLYB_CFGR_UNIT) >> DLYB_CFGR_UNIT_Pos;
+
+  for (phase = 0U; phase < DLYB_MAX_SELECT; phase++)
+  {
+    (void)DelayBlock_Configure(dlyb, phase, units);
+
+    /* A phase passes when the tuning block is read correctly twice in a row */
+    if ((SD_SendTuningBlock(hsd) == HAL_SD_ERROR_NONE) && (SD_SendTuningBlock(hsd) == HAL_SD_ERROR_NONE))
+    {
+      if (length == 0U)
+      {
+        start = phase;
+      }
+      length++;
+      if (length > best_length)
+      {
+        best_start  = start;
+        best_length = length;
+      }
+    }
+    else
+    {
+      length = 0U;
+    }
+  }
+
+  if (best_length == 0U)
+  {
+    (void)DelayBlock_Enable(dlyb);
+    errorstate = HAL_SD_ERROR_DATA_CRC_FAIL;
+  }
+  else
+  {
+    hsd->TuningPhase = best_start + (best_length / 2U);
+    (void)DelayBlock_Configure(dlyb, hsd->TuningPhase, units);
+  }
+
+  hsd->TuningCrcErrors = 0U;
+
+  return errorstate;
+}
+
+/**
+  * @brief  Read the tuning block (CMD19) and compare it with the expected pattern.
+  * @param  hsd: Pointer to SD handle
+  * @retval SD Card error state
+  */
+static uint32_t SD_SendTuningBlock(SD_HandleTypeDef *hsd)
+{
+  /* Tuning block pattern sent by the card on a 4-bit bus */
+  static const uint8_t tuning_pattern[64] =
+  {
+    0xFFU, 0x0FU, 0xFFU, 0x00U, 0xFFU, 0xCCU, 0xC3U, 0xCCU, 0xC3U, 0x3CU, 0xCCU, 0xFFU, 0xFEU, 0xFFU, 0xFEU, 0xEFU,
+    0xFFU, 0xDFU, 0xFFU, 0xDDU, 0xFFU, 0xFBU, 0xFFU, 0xFBU, 0xBFU, 0xFFU, 0x7FU, 0xFFU, 0x77U, 0xF7U, 0xBDU, 0xEFU,
+    0xFFU, 0xF0U, 0xFFU, 0xF0U, 0x0FU, 0xFCU, 0xCCU, 0x3CU, 0xCCU, 0x33U, 0xCCU, 0xCFU, 0xFFU, 0xEFU, 0xFFU, 0xEEU,
+    0xFFU, 0xFDU, 0xFFU, 0xFDU, 0xDFU, 0xFFU, 0xBFU, 0xFFU, 0xBBU, 0xFFU, 0xF7U, 0xFFU, 0xF7U, 0x7FU, 0x7BU, 0xDEU
+  };
+  SDMMC_DataInitTypeDef config;
+  uint32_t tuning_block[16] = {0};
+  uint32_t errorstate;
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t count;
+  uint32_t index = 0U;
+
+  /* Initialize the Data control register */
+  hsd->Instance->DCTRL = 0U;
+
+  /* Configure the SD DPSM (Data Path State Machine) */
+  config.DataTimeOut   = SD_TUNING_DATATIMEOUT;
+  config.DataLength    = 64U;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_64B;
+  config.TransferDir   = SDMMC_TRANSFER_DIR_TO_SDMMC;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+  config.DPSM          = SDMMC_DPSM_ENABLE;
+  (void)SDMMC_ConfigData(hsd->Instance, &config);
+
+  errorstate = SDMMC_CmdSendTuningBlock(hsd->Instance);
+  if (errorstate != HAL_SD_ERROR_NONE)
+  {
+    __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_FLAGS);
+    return errorstate;
+  }
+
+  while (!__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXOVERR | SDMMC_FLAG_DCRCFAIL | SDMMC_FLAG_DTIMEOUT | SDMMC_FLAG_DATAEND))
+  {
+    if ((__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXFIFOHF)) && (index < 16U))
+    {
+      for (count = 0U; count < 8U; count++)
+      {
+        tuning_block[index] = SDMMC_ReadFIFO(hsd->Instance);
+        index++;
+      }
+    }
+
+    if ((HAL_GetTick() - tickstart) >= SD_TUNING_TIMEOUT)
+    {
+      __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_DATA_FLAGS);
+      return HAL_SD_ERROR_TIMEOUT;
+    }
+  }
+
+  if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DTIMEOUT))
+  {
+    errorstate = HAL_SD_ERROR_DATA_TIMEOUT;
+  }
+  else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DCRCFAIL))
+  {
+    errorstate = HAL_SD_ERROR_DATA_CRC_FAIL;
+  }
+  else if (__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_RXOVERR))
+  {
+    errorstate = HAL_SD_ERROR_RX_OVERRUN;
+  }
+  else
+  {
+    /* Read the data left in the FIFO */
+    while ((__HAL_SD_GET_FLAG(hsd, SDMMC_FLAG_DPSMACT)) && (index < 16U))
+    {
+      tuning_block[index] = SDMMC_ReadFIFO(hsd->Instance);
+      index++;
+    }
+
+    for (count = 0U; (count < 64U) && (errorstate == HAL_SD_ERROR_NONE); count++)
+    {
+      if (((uint8_t *)tuning_block)[count] != tuning_pattern[count])
+      {
+        errorstate = HAL_SD_ERROR_DATA_CRC_FAIL;
+      }
+    }
+  }
+
+  /* Clear all the static flags */
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_DATA_FLAGS);
+
+  return errorstate;
+}
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+
+/**
+  * @brief  Tune the sampling point again when too many data CRC errors have been counted.
+  * @note   Only applies in SDR104 mode. A failed tuning keeps the card usable with the
+  *         default delay block phase; the error counter is cleared in all cases.
+  * @param  hsd: Pointer to SD handle
+  * @retval None
+  */
+static void SD_TuningCheck(SD_HandleTypeDef *hsd)
+{
+#if defined (DLYB_SDMMC1) || defined (DLYB_SDMMC2)
+  if ((SD_RETUNE_CRC_ERRORS != 0U) && (hsd->TuningCrcErrors >= SD_RETUNE_CRC_ERRORS) &&
+      ((hsd->Instance->CLKCR & SDMMC_CLKCR_SELCLKRX) == SDMMC_CLKCR_SELCLKRX_1))
+  {
+    (void)SD_Tuning(hsd);
+  }
+#else
+  UNUSED(hsd);
+#endif /* DLYB_SDMMC1 || DLYB_SDMMC2 */
+}
+
+/**
+  * @brief  Start a data segment covering the buffers queued on the stream.
+  * @note   The first segment is started by the Write Multi Block command, the next ones
+  *         restart the data path inside the same command.
+  * @param  hsd: Pointer to SD handle
+  * @retval SD Card error state
+  */
+static uint32_t SD_StreamStart(SD_HandleTypeDef *hsd)
+{
+  SD_StreamTypeDef *hstream = hsd->pStream;
+  SDMMC_DataInitTypeDef config;
+  uint32_t buffersize = hstream->BufferBlocks * BLOCKSIZE;
+  uint32_t count = hstream->Count;
+  uint32_t second = 0U;
+  uint32_t add;
+  uint32_t errorstate = HAL_SD_ERROR_NONE;
+
+  /* The data length register bounds the number of buffers of a segment */
+  if (count > (SDMMC_DLEN_DATALENGTH / buffersize))
+  {
+    count = SDMMC_DLEN_DATALENGTH / buffersize;
+  }
+  if (count > 1U)
+  {
+    second = 1U;
+  }
+  hstream->SegmentCount = count;
+  hstream->SegmentPending = count - (second + 1U);
+
+  /* Initialize data control register */
+  hsd->Instance->DCTRL = 0U;
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_STATIC_DATA_FLAGS);
+
+  hsd->Instance->IDMABASE0 = (uint32_t)hstream->pQueue[hstream->Head];
+  hsd->Instance->IDMABASE1 = (uint32_t)hstream->pQueue[(hstream->Head + second) % hstream->NbSlots];
+  hsd->Instance->IDMABSIZE = buffersize;
+
+  /* Configure the SD DPSM (Data Path State Machine) */
+  config.DataTimeOut   = SDMMC_DATATIMEOUT;
+  config.DataLength    = count * buffersize;
+  config.DataBlockSize = SDMMC_DATABLOCK_SIZE_512B;
+  config.TransferDir   = SDMMC_TRANSFER_DIR_TO_CARD;
+  config.TransferMode  = SDMMC_TRANSFER_MODE_BLOCK;
+
+  hsd->Instance->IDMACTRL = SDMMC_ENABLE_IDMA_DOUBLE_BUFF0;
+
+  if (hstream->State == SD_STREAM_STATE_OPEN)
+  {
+    config.DPSM = SDMMC_DPSM_DISABLE;
+    (void)SDMMC_ConfigData(hsd->Instance, &config);
+
+    __SDMMC_CMDTRANS_ENABLE(hsd->Instance);
+
+    add = hstream->BlockAdd;
+    if (hsd->SdCard.CardType != CARD_SDHC_SDXC)
+    {
+      add *= 512U;
+    }
+
+    /* Write Multi Block command, left open until the stream is closed */
+    errorstate = SDMMC_CmdWriteMultiBlock(hsd->Instance, add);
+  }
+  else
+  {
+    /* The card is still inside the Write Multi Block command: start the data path alone */
+    config.DPSM = SDMMC_DPSM_ENABLE;
+    (void)SDMMC_ConfigData(hsd->Instance, &config);
+  }
+
+  if (errorstate == HAL_SD_ERROR_NONE)
+  {
+    if (hstream->State != SD_STREAM_STATE_CLOSING)
+    {
+      hstream->State = SD_STREAM_STATE_RUNNING;
+    }
+
+    __HAL_SD_ENABLE_IT(hsd, (SDMMC_IT_DCRCFAIL | SDMMC_IT_DTIMEOUT | SDMMC_IT_TXUNDERR | SDMMC_IT_DATAEND |
+                             SDMMC_IT_IDMABTC));
+  }
+
+  return errorstate;
+}
+
+/**
+  * @brief  Hand the oldest buffer of the stream back to the producer.
+  * @param  hstream: Pointer to the stream structure
+  * @retval None
+  */
+static void SD_StreamRelease(SD_StreamTypeDef *hstream)
+{
+  const uint8_t *pdata = hstream->pQueue[hstream->Head];
+
+  hstream->Head = (hstream->Head + 1U) % hstream->NbSlots;
+  hstream->Count--;
+  hstream->SegmentCount--;
+  hstream->BufferCount++;
+
+  if (hstream->BufferCpltCallback != NULL)
+  {
+    hstream->BufferCpltCallback(hstream, pdata);
+  }
+}
+
+/**
+  * @brief  Internal DMA buffer transfer complete handling of a stream.
+  * @note   The buffer slot just read by the internal DMA is loaded with the next buffer
+  *         of the segment, while the other slot is being read.
+  * @param  hsd: Pointer to SD handle
+  * @retval None
+  */
+static void SD_StreamBufferCplt(SD_HandleTypeDef *hsd)
+{
+  SD_StreamTypeDef *hstream = hsd->pStream;
+  uint32_t next;
+
+  if (hstream->SegmentCount != 0U)
+  {
+    SD_StreamRelease(hstream);
+
+    if (hstream->SegmentPending != 0U)
+    {
+      /* The oldest buffer is now in flight, the one after it goes to the free slot */
+      next = (uint32_t)hstream->pQueue[(hstream->Head + 1U) % hstream->NbSlots];
+      if (READ_BIT(hsd->Instance->IDMACTRL, SDMMC_IDMA_IDMABACT) == 0U)
+      {
+        hsd->Instance->IDMABASE1 = next;
+      }
+      else
+      {
+        hsd->Instance->IDMABASE0 = next;
+      }
+      hstream->SegmentPending--;
+    }
+  }
+}
+
+/**
+  * @brief  Data end handling of a stream: start the next segment or end the stream.
+  * @param  hsd: Pointer to SD handle
+  * @retval None
+  */
+static void SD_StreamDataEnd(SD_HandleTypeDef *hsd)
+{
+  SD_StreamTypeDef *hstream = hsd->pStream;
+  uint32_t errorstate = HAL_SD_ERROR_NONE;
+
+  /* The buffer transfer complete of the last buffers may not have been serviced yet */
+  __HAL_SD_CLEAR_FLAG(hsd, SDMMC_FLAG_IDMABTC);
+  while (hstream->SegmentCount != 0U)
+  {
+    SD_StreamRelease(hstream);
+  }
+
+  hsd->Instance->DLEN = 0U;
+  hsd->Instance->DCTRL = 0U;
+  hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+
+  if (hstream->Count != 0U)
+  {
+    errorstate = SD_StreamStart(hsd);
+  }
+  else if (hstream->State == SD_STREAM_STATE_CLOSING)
+  {
+    errorstate = SDMMC_CmdStopTransfer(hsd->Instance);
+    if (errorstate == HAL_SD_ERROR_NONE)
+    {
+      SD_StreamDetach(hsd, SD_STREAM_STATE_IDLE);
+#if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
+      hsd->TxCpltCallback(hsd);
+#else
+      HAL_SD_TxCpltCallback(hsd);
+#endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+    }
+  }
+  else
+  {
+    /* Producer behind: the card waits inside the open Write Multi Block command */
+    hstream->State = SD_STREAM_STATE_STARVED;
+    hstream->Stalls++;
+  }
+
+  if (errorstate != HAL_SD_ERROR_NONE)
+  {
+    hsd->ErrorCode |= errorstate;
+    hsd->Instance->IDMACTRL = SDMMC_DISABLE_IDMA;
+    __SDMMC_CMDTRANS_DISABLE(hsd->Instance);
+    SD_StreamDetach(hsd, SD_STREAM_STATE_ERROR);
+#if defined (USE_HAL_SD_REGISTER_CALLBACKS) && (USE_HAL_SD_REGISTER_CALLBACKS == 1U)
+    hsd->ErrorCallback(hsd);
+#else
+    HAL_SD_ErrorCallback(hsd);
+#endif /* USE_HAL_SD_REGISTER_CALLBACKS */
+  }
+}
+
+/**
+  * @brief  Detach the stream from the SD handle and make the handle ready again.
+  * @param  hsd: Pointer to SD handle
+  * @param  State: Final state of the stream
+  * @retval None
+  */
+static void SD_StreamDetach(SD_HandleTypeDef *hsd, uint32_t State)
+{
+  if (hsd->pStream != NULL)
+  {
+    hsd->pStream->State = State;
+    hsd->pStream = NULL;
+  }
+
+  hsd->Context = SD_CONTEXT_NONE;
+  hsd->State = HAL_SD_STATE_READY;
+}
+
 /**
   * @brief Read DMA Buffer 0 Transfer completed callbacks
   * @param hsd: SD handle
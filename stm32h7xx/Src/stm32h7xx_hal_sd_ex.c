@@ -27,6 +27,15 @@
    (+) Configure Buffer0 and Buffer1 start address and Buffer size using HAL_SDEx_ConfigDMAMultiBuffer() function.
    (+) Start Read and Write for multibuffer mode using HAL_SDEx_ReadBlocksDMAMultiBuffer()
        and HAL_SDEx_WriteBlocksDMAMultiBuffer() functions.
+   (+) Optionally, put a block cache on top of an initialized SD handle:
+       (++) Fill a SD_CacheTypeDef structure with the SD handle, the line storage and descriptors, the
+            number of lines, the line size in blocks and the transfer timeout, then call HAL_SDEx_CacheInit().
+       (++) Use HAL_SDEx_CacheReadBlocks() and HAL_SDEx_CacheWriteBlocks() instead of the blocking SD
+            read and write functions. A read miss fetches the whole line in one multiple block read, so
+            sequential readers are served from the cache. Writes are kept in the cache and adjacent dirty
+            blocks are written back in one pre-erased (ACMD23) multiple block write.
+       (++) Call HAL_SDEx_CacheFlush() before removing the card or powering down, and whenever the card is
+            accessed outside of the cache.
 
   @endverbatim
   ******************************************************************************
@@ -49,10 +58,40 @@
 
 /* Private typedef -----------------------------------------------------------*/
 /* Private define ------------------------------------------------------------*/
+/** @defgroup SDEx_Private_Defines SDEx Private Defines
+  * @{
+  */
+#define SDEX_CACHE_MAX_LINE_BLOCKS   32U  /* Valid and dirty masks of a cache line are 32-bit wide */
+/**
+  * @}
+  */
+
 /* Private macro -------------------------------------------------------------*/
 /* Private variables ---------------------------------------------------------*/
 /* Private function prototypes -----------------------------------------------*/
 /* Private functions ---------------------------------------------------------*/
+/** @defgroup SDEx_Private_Functions SDEx Private Functions
+  * @{
+  */
+static uint32_t             SDEx_CacheMask(uint32_t Offset, uint32_t Count);
+static uint8_t             *SDEx_CacheLineData(const SD_CacheTypeDef *pCache, const SD_CacheLineTypeDef *pLine);
+static uint32_t             SDEx_CacheLineSize(const SD_CacheTypeDef *pCache, const SD_CacheLineTypeDef *pLine);
+static SD_CacheLineTypeDef *SDEx_CacheLookup(const SD_CacheTypeDef *pCache, uint32_t LineAdd);
+static HAL_StatusTypeDef    SDEx_CacheCheck(const SD_CacheTypeDef *pCache, const uint8_t *pData, uint32_t BlockAdd,
+                                            uint32_t NumberOfBlocks);
+static HAL_StatusTypeDef    SDEx_CacheAllocate(SD_CacheTypeDef *pCache, uint32_t LineAdd,
+                                               SD_CacheLineTypeDef **ppLine);
+static HAL_StatusTypeDef    SDEx_CacheFill(SD_CacheTypeDef *pCache, SD_CacheLineTypeDef *pLine);
+static HAL_StatusTypeDef    SDEx_CacheWriteBack(SD_CacheTypeDef *pCache, SD_CacheLineTypeDef *pLine);
+static HAL_StatusTypeDef    SDEx_CacheRead(const SD_CacheTypeDef *pCache, uint8_t *pData, uint32_t BlockAdd,
+                                           uint32_t NumberOfBlocks);
+static HAL_StatusTypeDef    SDEx_CacheWrite(const SD_CacheTypeDef *pCache, const uint8_t *pData, uint32_t BlockAdd,
+                                            uint32_t NumberOfBlocks);
+static HAL_StatusTypeDef    SDEx_CacheWait(const SD_CacheTypeDef *pCache, uint32_t Tickstart);
+/**
+  * @}
+  */
+
 /* Exported functions --------------------------------------------------------*/
 /** @addtogroup SDEx_Exported_Functions
   * @{
@@ -299,6 +338,649 @@ HAL_StatusTypeDef HAL_SDEx_ChangeDMABuffer(SD_HandleTypeDef *hsd, HAL_SDEx_DMABu
   * @}
   */
 
+/** @addtogroup SDEx_Exported_Functions_Group2
+  *  @brief   Block cache functions
+  *
+@verbatim
+  ==============================================================================
+          ##### Block cache functions #####
+  ==============================================================================
+  [..]
+    This section provides an optional block cache working on top of the SD IDMA transfers.
+    The cache is fully associative with least recently used replacement. Each line covers
+    LineBlocks consecutive blocks aligned on LineBlocks:
+      (+) A read miss fetches every missing block of the line with multiple block reads (CMD18),
+          which reads ahead the blocks following the request.
+      (+) Writes only update the line. Adjacent dirty blocks of a line are written back with
+          a single multiple block write (CMD25) preceded by a pre-erase (ACMD23) when the line
+          is evicted or when HAL_SDEx_CacheFlush() is called.
+      (+) Requests of LineBlocks blocks or more are served directly by the card.
+    [..]
+    The cache functions are blocking: each card transfer is started in DMA mode and waited for,
+    so the SD interrupt must be enabled and serviced by HAL_SD_IRQHandler().
+    The cache must be flushed before the card is accessed through any other function.
+
+@endverbatim
+  * @{
+  */
+
+/**
+  * @brief  Initialize the block cache.
+  * @note   The hsd, pBuffer, pLines, NbLines, LineBlocks and Timeout fields must be filled
+  *         before calling this function. The SD handle must already be initialized.
+  * @note   When the line storage may be held in the data cache, it must be 32-byte aligned.
+  * @param  pCache: Pointer to the block cache structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_CacheInit(SD_CacheTypeDef *pCache)
+{
+  uint32_t i;
+
+  if ((pCache == NULL) || (pCache->hsd == NULL) || (pCache->pBuffer == NULL) || (pCache->pLines == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pCache->NbLines == 0U) || (pCache->LineBlocks == 0U) || (pCache->LineBlocks > SDEX_CACHE_MAX_LINE_BLOCKS))
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; i < pCache->NbLines; i++)
+  {
+    pCache->pLines[i].BlockAdd = 0U;
+    pCache->pLines[i].Valid    = 0U;
+    pCache->pLines[i].Dirty    = 0U;
+    pCache->pLines[i].LastUse  = 0U;
+  }
+
+  pCache->Stamp      = 0U;
+  pCache->Hits       = 0U;
+  pCache->Misses     = 0U;
+  pCache->WriteBacks = 0U;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Read block(s) through the block cache.
+  * @note   Requests of LineBlocks blocks or more are read directly into pData by the IDMA,
+  *         in which case pData follows the same rules as for HAL_SD_ReadBlocks_DMA().
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pData: Pointer to the buffer that will contain the data
+  * @param  BlockAdd: Block Address from where data is to be read
+  * @param  NumberOfBlocks: Number of blocks to read
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_CacheReadBlocks(SD_CacheTypeDef *pCache, uint8_t *pData, uint32_t BlockAdd,
+                                           uint32_t NumberOfBlocks)
+{
+  SD_CacheLineTypeDef *pline = NULL;
+  const uint8_t *psrc;
+  uint8_t *pdst = pData;
+  uint32_t add = BlockAdd;
+  uint32_t remaining = NumberOfBlocks;
+  uint32_t offset;
+  uint32_t count;
+  uint32_t mask;
+  uint32_t i;
+  HAL_StatusTypeDef status;
+
+  status = SDEx_CacheCheck(pCache, pData, BlockAdd, NumberOfBlocks);
+
+  if ((status == HAL_OK) && (NumberOfBlocks >= pCache->LineBlocks))
+  {
+    /* Write back the dirty blocks covered by the request, then read the card directly */
+    for (i = 0U; (i < pCache->NbLines) && (status == HAL_OK); i++)
+    {
+      if ((pCache->pLines[i].Dirty != 0U) && (pCache->pLines[i].BlockAdd < (BlockAdd + NumberOfBlocks)) &&
+          ((pCache->pLines[i].BlockAdd + pCache->LineBlocks) > BlockAdd))
+      {
+        status = SDEx_CacheWriteBack(pCache, &pCache->pLines[i]);
+      }
+    }
+
+    if (status == HAL_OK)
+    {
+      status = SDEx_CacheRead(pCache, pData, BlockAdd, NumberOfBlocks);
+    }
+
+    remaining = 0U;
+  }
+
+  while ((status == HAL_OK) && (remaining > 0U))
+  {
+    offset = add % pCache->LineBlocks;
+    count  = pCache->LineBlocks - offset;
+    if (count > remaining)
+    {
+      count = remaining;
+    }
+    mask = SDEx_CacheMask(offset, count);
+
+    pline = SDEx_CacheLookup(pCache, add - offset);
+    if (pline == NULL)
+    {
+      status = SDEx_CacheAllocate(pCache, add - offset, &pline);
+    }
+
+    if (status == HAL_OK)
+    {
+      if ((pline->Valid & mask) == mask)
+      {
+        pCache->Hits++;
+      }
+      else
+      {
+        pCache->Misses++;
+        status = SDEx_CacheFill(pCache, pline);
+      }
+    }
+
+    if (status == HAL_OK)
+    {
+      pCache->Stamp++;
+      pline->LastUse = pCache->Stamp;
+
+      psrc = &SDEx_CacheLineData(pCache, pline)[offset * BLOCKSIZE];
+      for (i = 0U; i < (count * BLOCKSIZE); i++)
+      {
+        pdst[i] = psrc[i];
+      }
+
+      pdst = &pdst[count * BLOCKSIZE];
+      add += count;
+      remaining -= count;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Write block(s) through the block cache.
+  * @note   The data reach the card when their line is evicted or when HAL_SDEx_CacheFlush() is called.
+  * @note   Requests of LineBlocks blocks or more are written directly from pData by the IDMA,
+  *         in which case pData follows the same rules as for HAL_SD_WriteBlocks_DMA().
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pData: Pointer to the buffer that contains the data to write
+  * @param  BlockAdd: Block Address where data will be written
+  * @param  NumberOfBlocks: Number of blocks to write
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_CacheWriteBlocks(SD_CacheTypeDef *pCache, const uint8_t *pData, uint32_t BlockAdd,
+                                            uint32_t NumberOfBlocks)
+{
+  SD_CacheLineTypeDef *pline = NULL;
+  const uint8_t *psrc = pData;
+  uint8_t *pdst;
+  uint32_t add = BlockAdd;
+  uint32_t remaining = NumberOfBlocks;
+  uint32_t lineadd;
+  uint32_t offset;
+  uint32_t count;
+  uint32_t mask;
+  uint32_t i;
+  HAL_StatusTypeDef status;
+
+  status = SDEx_CacheCheck(pCache, pData, BlockAdd, NumberOfBlocks);
+
+  if ((status == HAL_OK) && (NumberOfBlocks >= pCache->LineBlocks))
+  {
+    status = SDEx_CacheWrite(pCache, pData, BlockAdd, NumberOfBlocks);
+
+    if (status == HAL_OK)
+    {
+      /* Drop the cached copies of the blocks just written, dirty or not */
+      for (i = 0U; i < pCache->NbLines; i++)
+      {
+        lineadd = pCache->pLines[i].BlockAdd;
+        if ((pCache->pLines[i].Valid != 0U) && (lineadd < (BlockAdd + NumberOfBlocks)) &&
+            ((lineadd + pCache->LineBlocks) > BlockAdd))
+        {
+          offset = (lineadd < BlockAdd) ? (BlockAdd - lineadd) : 0U;
+          count  = (BlockAdd + NumberOfBlocks) - (lineadd + offset);
+          if (count > (pCache->LineBlocks - offset))
+          {
+            count = pCache->LineBlocks - offset;
+          }
+          mask = SDEx_CacheMask(offset, count);
+          pCache->pLines[i].Valid &= ~mask;
+          pCache->pLines[i].Dirty &= ~mask;
+        }
+      }
+    }
+
+    remaining = 0U;
+  }
+
+  while ((status == HAL_OK) && (remaining > 0U))
+  {
+    offset = add % pCache->LineBlocks;
+    count  = pCache->LineBlocks - offset;
+    if (count > remaining)
+    {
+      count = remaining;
+    }
+    mask = SDEx_CacheMask(offset, count);
+
+    pline = SDEx_CacheLookup(pCache, add - offset);
+    if (pline == NULL)
+    {
+      status = SDEx_CacheAllocate(pCache, add - offset, &pline);
+    }
+
+    if (status == HAL_OK)
+    {
+      pCache->Stamp++;
+      pline->LastUse = pCache->Stamp;
+
+      pdst = &SDEx_CacheLineData(pCache, pline)[offset * BLOCKSIZE];
+      for (i = 0U; i < (count * BLOCKSIZE); i++)
+      {
+        pdst[i] = psrc[i];
+      }
+      pline->Valid |= mask;
+      pline->Dirty |= mask;
+
+      psrc = &psrc[count * BLOCKSIZE];
+      add += count;
+      remaining -= count;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Write back every dirty block held by the block cache.
+  * @note   The cached data stay valid, so following reads are still served from the cache.
+  * @param  pCache: Pointer to the block cache structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_SDEx_CacheFlush(SD_CacheTypeDef *pCache)
+{
+  uint32_t i;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCache == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  for (i = 0U; (i < pCache->NbLines) && (status == HAL_OK); i++)
+  {
+    if (pCache->pLines[i].Dirty != 0U)
+    {
+      status = SDEx_CacheWriteBack(pCache, &pCache->pLines[i]);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @}
+  */
+
+/**
+  * @}
+  */
+
+/* Private functions ---------------------------------------------------------*/
+/** @addtogroup SDEx_Private_Functions
+  * @{
+  */
+
+/**
+  * @brief  Build the mask of Count blocks starting at block Offset of a cache line.
+  * @param  Offset: First block of the mask
+  * @param  Count: Number of blocks of the mask
+  * @retval Block mask
+  */
+static uint32_t SDEx_CacheMask(uint32_t Offset, uint32_t Count)
+{
+  uint32_t mask;
+
+  if (Count >= SDEX_CACHE_MAX_LINE_BLOCKS)
+  {
+    mask = 0xFFFFFFFFU;
+  }
+  else
+  {
+    mask = ((1UL << Count) - 1U) << Offset;
+  }
+
+  return mask;
+}
+
+/**
+  * @brief  Return the storage of a cache line.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pLine: Pointer to the cache line
+  * @retval Pointer to the first byte of the line
+  */
+static uint8_t *SDEx_CacheLineData(const SD_CacheTypeDef *pCache, const SD_CacheLineTypeDef *pLine)
+{
+  uint32_t index = (uint32_t)(pLine - pCache->pLines);
+
+  return &pCache->pBuffer[index * pCache->LineBlocks * BLOCKSIZE];
+}
+
+/**
+  * @brief  Return the number of blocks of a cache line that exist on the card.
+  * @note   Only the last line of the card can be shorter than LineBlocks.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pLine: Pointer to the cache line
+  * @retval Number of blocks
+  */
+static uint32_t SDEx_CacheLineSize(const SD_CacheTypeDef *pCache, const SD_CacheLineTypeDef *pLine)
+{
+  uint32_t size = pCache->LineBlocks;
+
+  if ((pLine->BlockAdd + size) > pCache->hsd->SdCard.LogBlockNbr)
+  {
+    size = pCache->hsd->SdCard.LogBlockNbr - pLine->BlockAdd;
+  }
+
+  return size;
+}
+
+/**
+  * @brief  Find the cache line holding the given line address.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  LineAdd: First block of the line
+  * @retval Pointer to the cache line, NULL when the line is not cached
+  */
+static SD_CacheLineTypeDef *SDEx_CacheLookup(const SD_CacheTypeDef *pCache, uint32_t LineAdd)
+{
+  SD_CacheLineTypeDef *pline = NULL;
+  uint32_t i;
+
+  for (i = 0U; (i < pCache->NbLines) && (pline == NULL); i++)
+  {
+    /* Dirty blocks are always valid, so a line without valid block is free */
+    if ((pCache->pLines[i].Valid != 0U) && (pCache->pLines[i].BlockAdd == LineAdd))
+    {
+      pline = &pCache->pLines[i];
+    }
+  }
+
+  return pline;
+}
+
+/**
+  * @brief  Check the parameters of a cached transfer.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pData: Pointer to the user buffer
+  * @param  BlockAdd: First block of the transfer
+  * @param  NumberOfBlocks: Number of blocks of the transfer
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDEx_CacheCheck(const SD_CacheTypeDef *pCache, const uint8_t *pData, uint32_t BlockAdd,
+                                         uint32_t NumberOfBlocks)
+{
+  if ((pCache == NULL) || (pData == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  if (pCache->hsd->State != HAL_SD_STATE_READY)
+  {
+    return HAL_BUSY;
+  }
+
+  if ((NumberOfBlocks == 0U) || ((BlockAdd + NumberOfBlocks) > pCache->hsd->SdCard.LogBlockNbr))
+  {
+    pCache->hsd->ErrorCode |= HAL_SD_ERROR_ADDR_OUT_OF_RANGE;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocate a cache line to the given line address.
+  * @note   A free line is used first, else the least recently used line is written back and reused.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  LineAdd: First block of the line
+  * @param  ppLine: Pointer to the allocated line
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDEx_CacheAllocate(SD_CacheTypeDef *pCache, uint32_t LineAdd,
+                                            SD_CacheLineTypeDef **ppLine)
+{
+  SD_CacheLineTypeDef *pline = &pCache->pLines[0];
+  uint32_t i;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  for (i = 1U; (i < pCache->NbLines) && (pline->Valid != 0U); i++)
+  {
+    /* Ages are computed from the running stamp so that its wrap around is harmless */
+    if ((pCache->pLines[i].Valid == 0U) ||
+        ((pCache->Stamp - pCache->pLines[i].LastUse) > (pCache->Stamp - pline->LastUse)))
+    {
+      pline = &pCache->pLines[i];
+    }
+  }
+
+  if (pline->Dirty != 0U)
+  {
+    status = SDEx_CacheWriteBack(pCache, pline);
+  }
+
+  if (status == HAL_OK)
+  {
+    pline->BlockAdd = LineAdd;
+    pline->Valid    = 0U;
+    pline->Dirty    = 0U;
+    *ppLine = pline;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Read every missing block of a cache line from the card.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pLine: Pointer to the cache line
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDEx_CacheFill(SD_CacheTypeDef *pCache, SD_CacheLineTypeDef *pLine)
+{
+  uint8_t *pdata = SDEx_CacheLineData(pCache, pLine);
+  uint32_t size = SDEx_CacheLineSize(pCache, pLine);
+  uint32_t start = 0U;
+  uint32_t count;
+  HAL_StatusTypeDef status = HAL_OK;
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  /* Make sure no dirty data cache line overwrites the line storage while the IDMA fills it */
+  SCB_CleanInvalidateDCache_by_Addr((uint32_t *)pdata, (int32_t)(pCache->LineBlocks * BLOCKSIZE));
+#endif /* __DCACHE_PRESENT */
+
+  /* One multiple block read per run of missing blocks */
+  while ((status == HAL_OK) && (start < size))
+  {
+    if ((pLine->Valid & (1UL << start)) != 0U)
+    {
+      start++;
+    }
+    else
+    {
+      count = 1U;
+      while (((start + count) < size) && ((pLine->Valid & (1UL << (start + count))) == 0U))
+      {
+        count++;
+      }
+
+      status = SDEx_CacheRead(pCache, &pdata[start * BLOCKSIZE], pLine->BlockAdd + start, count);
+      if (status == HAL_OK)
+      {
+        pLine->Valid |= SDEx_CacheMask(start, count);
+      }
+      start += count;
+    }
+  }
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  SCB_InvalidateDCache_by_Addr((uint32_t *)pdata, (int32_t)(pCache->LineBlocks * BLOCKSIZE));
+#endif /* __DCACHE_PRESENT */
+
+  return status;
+}
+
+/**
+  * @brief  Write the dirty blocks of a cache line to the card.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pLine: Pointer to the cache line
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDEx_CacheWriteBack(SD_CacheTypeDef *pCache, SD_CacheLineTypeDef *pLine)
+{
+  uint8_t *pdata = SDEx_CacheLineData(pCache, pLine);
+  uint32_t start = 0U;
+  uint32_t count;
+  HAL_StatusTypeDef status = HAL_OK;
+
+#if defined (__DCACHE_PRESENT) && (__DCACHE_PRESENT == 1U)
+  SCB_CleanDCache_by_Addr((uint32_t *)pdata, (int32_t)(pCache->LineBlocks * BLOCKSIZE));
+#endif /* __DCACHE_PRESENT */
+
+  /* One multiple block write per run of dirty blocks */
+  while ((status == HAL_OK) && (start < pCache->LineBlocks))
+  {
+    if ((pLine->Dirty & (1UL << start)) == 0U)
+    {
+      start++;
+    }
+    else
+    {
+      count = 1U;
+      while (((start + count) < pCache->LineBlocks) && ((pLine->Dirty & (1UL << (start + count))) != 0U))
+      {
+        count++;
+      }
+
+      status = SDEx_CacheWrite(pCache, &pdata[start * BLOCKSIZE], pLine->BlockAdd + start, count);
+      if (status == HAL_OK)
+      {
+        pLine->Dirty &= ~SDEx_CacheMask(start, count);
+        pCache->WriteBacks++;
+      }
+      start += count;
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Read block(s) from the card in DMA mode and wait for the end of the transfer.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pData: Pointer to the destination buffer
+  * @param  BlockAdd: Block Address from where data is to be read
+  * @param  NumberOfBlocks: Number of blocks to read
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDEx_CacheRead(const SD_CacheTypeDef *pCache, uint8_t *pData, uint32_t BlockAdd,
+                                        uint32_t NumberOfBlocks)
+{
+  uint32_t tickstart = HAL_GetTick();
+  HAL_StatusTypeDef status;
+
+  status = HAL_SD_ReadBlocks_DMA(pCache->hsd, pData, BlockAdd, NumberOfBlocks);
+  if (status == HAL_OK)
+  {
+    status = SDEx_CacheWait(pCache, tickstart);
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Write block(s) to the card in DMA mode and wait for the end of the programming.
+  * @note   Multiple block writes are preceded by a pre-erase of the written blocks (ACMD23).
+  * @param  pCache: Pointer to the block cache structure
+  * @param  pData: Pointer to the source buffer
+  * @param  BlockAdd: Block Address where data will be written
+  * @param  NumberOfBlocks: Number of blocks to write
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDEx_CacheWrite(const SD_CacheTypeDef *pCache, const uint8_t *pData, uint32_t BlockAdd,
+                                         uint32_t NumberOfBlocks)
+{
+  SD_HandleTypeDef *hsd = pCache->hsd;
+  uint32_t tickstart = HAL_GetTick();
+  uint32_t errorstate = HAL_SD_ERROR_NONE;
+  HAL_StatusTypeDef status;
+
+  if (NumberOfBlocks > 1U)
+  {
+    errorstate = SDMMC_CmdAppCommand(hsd->Instance, (uint32_t)(hsd->SdCard.RelCardAdd << 16U));
+    if (errorstate == HAL_SD_ERROR_NONE)
+    {
+      errorstate = SDMMC_CmdSetWrBlkEraseCount(hsd->Instance, NumberOfBlocks);
+    }
+  }
+
+  if (errorstate != HAL_SD_ERROR_NONE)
+  {
+    hsd->ErrorCode |= errorstate;
+    status = HAL_ERROR;
+  }
+  else
+  {
+    status = HAL_SD_WriteBlocks_DMA(hsd, pData, BlockAdd, NumberOfBlocks);
+    if (status == HAL_OK)
+    {
+      status = SDEx_CacheWait(pCache, tickstart);
+    }
+  }
+
+  return status;
+}
+
+/**
+  * @brief  Wait for the end of a DMA transfer started by the block cache.
+  * @note   The transfer is aborted when it does not complete within the cache timeout.
+  * @param  pCache: Pointer to the block cache structure
+  * @param  Tickstart: Tick value at the start of the transfer
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef SDEx_CacheWait(const SD_CacheTypeDef *pCache, uint32_t Tickstart)
+{
+  SD_HandleTypeDef *hsd = pCache->hsd;
+
+  /* The SD interrupt handler moves the handle back to the ready state at the end of the transfer */
+  while (hsd->State != HAL_SD_STATE_READY)
+  {
+    if ((HAL_GetTick() - Tickstart) >= pCache->Timeout)
+    {
+      (void)HAL_SD_Abort(hsd);
+      hsd->ErrorCode |= HAL_SD_ERROR_TIMEOUT;
+      return HAL_TIMEOUT;
+    }
+  }
+
+  if (hsd->ErrorCode != HAL_SD_ERROR_NONE)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Wait for the card to complete the programming of written blocks */
+  while (HAL_SD_GetCardState(hsd) != HAL_SD_CARD_TRANSFER)
+  {
+    if ((HAL_GetTick() - Tickstart) >= pCache->Timeout)
+    {
+      hsd->ErrorCode |= HAL_SD_ERROR_TIMEOUT;
+      return HAL_TIMEOUT;
+    }
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @}
   */
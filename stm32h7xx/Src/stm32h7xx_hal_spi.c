@@ -182,6 +182,9 @@ static void SPI_RxISR_32BIT(SPI_HandleTypeDef *hspi);
 static void SPI_AbortTransfer(SPI_HandleTypeDef *hspi);
 static void SPI_CloseTransfer(SPI_HandleTypeDef *hspi);
 static uint32_t SPI_GetPacketSize(const SPI_HandleTypeDef *hspi);
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+static uint32_t SPI_DMABufferSize(const SPI_HandleTypeDef *hspi, uint16_t Size);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 
 
 /**
@@ -2202,6 +2205,11 @@ HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *p
   /* Clear TXDMAEN bit*/
   CLEAR_BIT(hspi->Instance->CFG1, SPI_CFG1_TXDMAEN);
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Write the data to transmit back to memory */
+  HAL_DCACHE_CleanForDMA(hspi->pTxBuffPtr, SPI_DMABufferSize(hspi, Size));
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
   /* Enable the Tx DMA Stream/Channel */
   if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmatx, (uint32_t)hspi->pTxBuffPtr, (uint32_t)&hspi->Instance->TXDR,
                                  hspi->TxXferCount))
@@ -2258,6 +2266,7 @@ HAL_StatusTypeDef HAL_SPI_Transmit_DMA(SPI_HandleTypeDef *hspi, const uint8_t *p
   */
 HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, uint16_t Size)
 {
+  uint8_t *pDmaBuffer = pData;
 
   /* Check Direction parameter */
   assert_param(IS_SPI_DIRECTION_2LINES_OR_1LINE_2LINES_RXONLY(hspi->Init.Direction));
@@ -2349,8 +2358,24 @@ HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, u
   /* Set the DMA AbortCpltCallback */
   hspi->hdmarx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Invalidate the reception buffer, a circular reception cannot use a bounce buffer */
+  if (HAL_OK != HAL_DCACHE_PrepareRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, Size),
+                                        (hspi->hdmarx->Init.Mode != DMA_CIRCULAR) ? &pDmaBuffer : NULL))
+  {
+    /* Update SPI error code */
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->State = HAL_SPI_STATE_READY;
+
+    /* Unlock the process */
+    __HAL_UNLOCK(hspi);
+
+    return HAL_ERROR;
+  }
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
   /* Enable the Rx DMA Stream/Channel  */
-  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->RXDR, (uint32_t)hspi->pRxBuffPtr,
+  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->RXDR, (uint32_t)pDmaBuffer,
                                  hspi->RxXferCount))
   {
     /* Update SPI error code */
@@ -2407,6 +2432,8 @@ HAL_StatusTypeDef HAL_SPI_Receive_DMA(SPI_HandleTypeDef *hspi, uint8_t *pData, u
 HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uint8_t *pTxData, uint8_t *pRxData,
                                               uint16_t Size)
 {
+  uint8_t *pDmaBuffer = pRxData;
+
   /* Check Direction parameter */
   assert_param(IS_SPI_DIRECTION_2LINES(hspi->Init.Direction));
 
@@ -2505,8 +2532,27 @@ HAL_StatusTypeDef HAL_SPI_TransmitReceive_DMA(SPI_HandleTypeDef *hspi, const uin
   /* Set the DMA AbortCallback */
   hspi->hdmarx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Write the data to transmit back to memory */
+  HAL_DCACHE_CleanForDMA(hspi->pTxBuffPtr, SPI_DMABufferSize(hspi, Size));
+
+  /* Invalidate the reception buffer, a circular reception cannot use a bounce buffer */
+  if (HAL_OK != HAL_DCACHE_PrepareRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, Size),
+                                        (hspi->hdmarx->Init.Mode != DMA_CIRCULAR) ? &pDmaBuffer : NULL))
+  {
+    /* Update SPI error code */
+    SET_BIT(hspi->ErrorCode, HAL_SPI_ERROR_DMA);
+    hspi->State = HAL_SPI_STATE_READY;
+
+    /* Unlock the process */
+    __HAL_UNLOCK(hspi);
+
+    return HAL_ERROR;
+  }
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
   /* Enable the Rx DMA Stream/Channel  */
-  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->RXDR, (uint32_t)hspi->pRxBuffPtr,
+  if (HAL_OK != HAL_DMA_Start_IT(hspi->hdmarx, (uint32_t)&hspi->Instance->RXDR, (uint32_t)pDmaBuffer,
                                  hspi->RxXferCount))
   {
     /* Update SPI error code */
@@ -3033,6 +3079,14 @@ void HAL_SPI_IRQHandler(SPI_HandleTypeDef *hspi)
       }
     }
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+    /* Make the data received by DMA visible to the CPU */
+    if (HAL_IS_BIT_SET(hspi->Instance->CFG1, SPI_CFG1_RXDMAEN))
+    {
+      HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize));
+    }
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
     /* Call SPI Standard close procedure */
     SPI_CloseTransfer(hspi);
 
@@ -3413,6 +3467,11 @@ static void SPI_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
   {
     if (hspi->hdmarx->Init.Mode == DMA_CIRCULAR)
     {
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+      /* Make the received data visible to the CPU */
+      HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize));
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
       hspi->RxCpltCallback(hspi);
 #else
@@ -3441,6 +3500,11 @@ static void SPI_DMATransmitReceiveCplt(DMA_HandleTypeDef *hdma)
   {
     if (hspi->hdmatx->Init.Mode == DMA_CIRCULAR)
     {
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+      /* Make the received data visible to the CPU */
+      HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize));
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
       hspi->TxRxCpltCallback(hspi);
 #else
@@ -3484,6 +3548,11 @@ static void SPI_DMAHalfReceiveCplt(DMA_HandleTypeDef *hdma) /* Derogation MISRAC
   SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)
                             ((DMA_HandleTypeDef *)hdma)->Parent; /* Derogation MISRAC2012-Rule-8.13 */
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the first half of the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize / 2U));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
   hspi->RxHalfCpltCallback(hspi);
 #else
@@ -3502,6 +3571,11 @@ static void SPI_DMAHalfTransmitReceiveCplt(DMA_HandleTypeDef *hdma) /* Derogatio
   SPI_HandleTypeDef *hspi = (SPI_HandleTypeDef *)
                             ((DMA_HandleTypeDef *)hdma)->Parent; /* Derogation MISRAC2012-Rule-8.13 */
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the first half of the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(hspi, hspi->pRxBuffPtr, SPI_DMABufferSize(hspi, hspi->RxXferSize / 2U));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 #if (USE_HAL_SPI_REGISTER_CALLBACKS == 1UL)
   hspi->TxRxHalfCpltCallback(hspi);
 #else
@@ -3924,6 +3998,11 @@ static void SPI_AbortTransfer(SPI_HandleTypeDef *hspi)
 
   hspi->TxXferCount = (uint16_t)0UL;
   hspi->RxXferCount = (uint16_t)0UL;
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Release the bounce buffer of the DMA reception */
+  HAL_DCACHE_ReleaseRxDMA(hspi);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 }
 
 
@@ -3999,6 +4078,11 @@ static void SPI_CloseTransfer(SPI_HandleTypeDef *hspi)
 
   hspi->TxXferCount = (uint16_t)0UL;
   hspi->RxXferCount = (uint16_t)0UL;
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Release the bounce buffer of the DMA reception */
+  HAL_DCACHE_ReleaseRxDMA(hspi);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 }
 
 /**
@@ -4043,6 +4127,35 @@ static uint32_t SPI_GetPacketSize(const SPI_HandleTypeDef *hspi)
   return data_size * fifo_threashold;
 }
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Compute the size in bytes of a SPI DMA buffer.
+  * @param  hspi: pointer to a SPI_HandleTypeDef structure that contains
+  *               the configuration information for SPI module.
+  * @param  Size: amount of data frames
+  * @retval Size in bytes
+  */
+static uint32_t SPI_DMABufferSize(const SPI_HandleTypeDef *hspi, uint16_t Size)
+{
+  uint32_t nbytes = Size;
+
+  if (hspi->Init.DataSize > SPI_DATASIZE_16BIT)
+  {
+    nbytes *= sizeof(uint32_t);
+  }
+  else if (hspi->Init.DataSize > SPI_DATASIZE_8BIT)
+  {
+    nbytes *= sizeof(uint16_t);
+  }
+  else
+  {
+    /* One byte per data frame */
+  }
+
+  return nbytes;
+}
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 /**
   * @}
   */
@@ -128,6 +128,8 @@
     [..]
     For specific callback RxEventCallback, use dedicated registration/reset functions:
     respectively HAL_UART_RegisterRxEventCallback() , HAL_UART_UnRegisterRxEventCallback().
+    For specific callback TxBufferCpltCallback, use dedicated registration/reset functions:
+    respectively HAL_UART_RegisterTxBufferCpltCallback() , HAL_UART_UnRegisterTxBufferCpltCallback().
 
     [..]
     By default, after the HAL_UART_Init() and when the state is HAL_UART_STATE_RESET
@@ -200,8 +202,12 @@
 static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef UART_TxQueueNext(UART_HandleTypeDef *huart);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+static uint32_t UART_DMABufferSize(const UART_HandleTypeDef *huart, uint16_t Size);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMAError(DMA_HandleTypeDef *hdma);
 static void UART_DMAAbortOnError(DMA_HandleTypeDef *hdma);
@@ -328,6 +334,10 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -395,6 +405,10 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -483,6 +497,10 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -569,6 +587,10 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -662,6 +684,7 @@ HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
   huart->gState = HAL_UART_STATE_RESET;
   huart->RxState = HAL_UART_STATE_RESET;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
   huart->RxEventType = HAL_UART_RXEVENT_TC;
 
   __HAL_UNLOCK(huart);
@@ -1007,6 +1030,64 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
   return status;
 }
 
+/**
+  * @brief  Register a User UART Tx Queue Buffer Complete Callback
+  *         To be used instead of the weak predefined callback
+  * @param  huart     Uart handle
+  * @param  pCallback Pointer to the Tx Queue Buffer Complete Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_RegisterTxBufferCpltCallback(UART_HandleTypeDef *huart,
+                                                        pUART_TxBufferCpltCallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    return HAL_ERROR;
+  }
+
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    huart->TxBufferCpltCallback = pCallback;
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  UnRegister the UART Tx Queue Buffer Complete Callback
+  *         UART Tx Queue Buffer Complete Callback is redirected to the weak HAL_UARTEx_TxBufferCpltCallback()
+  *         predefined callback
+  * @param  huart     Uart handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_UnRegisterTxBufferCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    huart->TxBufferCpltCallback = HAL_UARTEx_TxBufferCpltCallback; /* Legacy weak UART Tx Buffer Complete Callback */
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -1077,6 +1158,9 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
         reception services:
         (++) HAL_UARTEx_RxEventCallback()
 
+    (#) A Tx buffer completion Callback is available for the queued transmission services:
+        (++) HAL_UARTEx_TxBufferCpltCallback()
+
     (#) Wakeup from Stop mode Callback:
         (++) HAL_UARTEx_WakeupCallback()
 
@@ -1446,6 +1530,11 @@ HAL_StatusTypeDef HAL_UART_Transmit_DMA(UART_HandleTypeDef *huart, const uint8_t
       /* Set the DMA abort callback */
       huart->hdmatx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+      /* Write the data to transmit back to memory */
+      HAL_DCACHE_CleanForDMA(huart->pTxBuffPtr, UART_DMABufferSize(huart, Size));
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
       /* Enable the UART transmit DMA channel */
       if (HAL_DMA_Start_IT(huart->hdmatx, (uint32_t)huart->pTxBuffPtr, (uint32_t)&huart->Instance->TDR, Size) != HAL_OK)
       {
@@ -1497,6 +1586,7 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
 
     /* Set Reception type to Standard reception */
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     if (!(IS_LPUART_INSTANCE(huart->Instance)))
     {
@@ -1738,6 +1828,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   huart->ErrorCode = HAL_UART_ERROR_NONE;
 
@@ -1859,6 +1950,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   return HAL_OK;
 }
@@ -1998,6 +2090,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2158,6 +2251,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
       /* Restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
       huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      huart->pRxStream = NULL;
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2180,6 +2274,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     /* Restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2385,6 +2480,14 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
         /* Reception is not complete */
         huart->RxXferCount = nb_remaining_rx_data;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+        /* Make the received data visible to the CPU, a circular buffer may have wrapped */
+        HAL_DCACHE_SyncRxDMA(huart, huart->pRxBuffPtr,
+                             UART_DMABufferSize(huart, (huart->hdmarx->Init.Mode != DMA_CIRCULAR) ?
+                                                (huart->RxXferSize - huart->RxXferCount) :
+                                                huart->RxXferSize));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
         /* In Normal mode, end DMA xfer and HAL UART Rx process*/
         if (huart->hdmarx->Init.Mode != DMA_CIRCULAR)
         {
@@ -2404,6 +2507,11 @@ void HAL_UART_IRQHandler(UART_HandleTypeDef *huart)
 
           /* Last bytes received, so no need as the abort is immediate */
           (void)HAL_DMA_Abort(huart->hdmarx);
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+          /* Release the bounce buffer of the reception */
+          HAL_DCACHE_ReleaseRxDMA(huart);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
         }
 
         /* Initialize type of RxEvent that correspond to RxEvent callback execution;
@@ -2684,6 +2792,26 @@ __weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
    */
 }
 
+/**
+  * @brief  Tx queue buffer completion callback.
+  * @note   Called once the DMA has read all the data of a buffer enqueued with
+  *         HAL_UARTEx_TxQueue_Enqueue(): the buffer can be reused, while its last data may
+  *         still be in transmission.
+  * @param  huart    UART handle.
+  * @param  pContext Application cookie given with the buffer.
+  * @retval None
+  */
+__weak void HAL_UARTEx_TxBufferCpltCallback(UART_HandleTypeDef *huart, void *pContext)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(pContext);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_TxBufferCpltCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -3007,6 +3135,7 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart)
   huart->RxFifoFullCallback        = HAL_UARTEx_RxFifoFullCallback;      /* Legacy weak RxFifoFullCallback        */
   huart->TxFifoEmptyCallback       = HAL_UARTEx_TxFifoEmptyCallback;     /* Legacy weak TxFifoEmptyCallback       */
   huart->RxEventCallback           = HAL_UARTEx_RxEventCallback;         /* Legacy weak RxEventCallback           */
+  huart->TxBufferCpltCallback      = HAL_UARTEx_TxBufferCpltCallback;    /* Legacy weak TxBufferCpltCallback      */
 
 }
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
@@ -3565,6 +3694,8 @@ HAL_StatusTypeDef UART_Start_Receive_IT(UART_HandleTypeDef *huart, uint8_t *pDat
   */
 HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData, uint16_t Size)
 {
+  uint8_t *pDmaBuffer = pData;
+
   huart->pRxBuffPtr = pData;
   huart->RxXferSize = Size;
 
@@ -3585,8 +3716,23 @@ HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pDa
     /* Set the DMA abort callback */
     huart->hdmarx->XferAbortCallback = NULL;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+    /* Invalidate the reception buffer, a circular reception cannot use a bounce buffer */
+    if (HAL_DCACHE_PrepareRxDMA(huart, pData, UART_DMABufferSize(huart, Size),
+                                (huart->hdmarx->Init.Mode != DMA_CIRCULAR) ? &pDmaBuffer : NULL) != HAL_OK)
+    {
+      /* Set error code to DMA */
+      huart->ErrorCode = HAL_UART_ERROR_DMA;
+
+      /* Restore huart->RxState to ready */
+      huart->RxState = HAL_UART_STATE_READY;
+
+      return HAL_ERROR;
+    }
+
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
     /* Enable the DMA channel */
-    if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, (uint32_t)huart->pRxBuffPtr, Size) != HAL_OK)
+    if (HAL_DMA_Start_IT(huart->hdmarx, (uint32_t)&huart->Instance->RDR, (uint32_t)pDmaBuffer, Size) != HAL_OK)
     {
       /* Set error code to DMA */
       huart->ErrorCode = HAL_UART_ERROR_DMA;
@@ -3614,6 +3760,83 @@ HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pDa
   return HAL_OK;
 }
 
+/**
+  * @brief  Start the transmission of the next buffer of the UART Tx queue.
+  * @note   Nothing is done when a Tx process is ongoing or when the queue is empty.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UART_TxQueueStart(UART_HandleTypeDef *huart)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  const UART_TxBufferTypeDef *pbuffer;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  /* Buffers may be enqueued from interrupts of any priority */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((huart->gState == HAL_UART_STATE_READY) && (pqueue->PutCount != pqueue->GetCount))
+  {
+    pbuffer = &pqueue->pBuffers[pqueue->GetCount % pqueue->BufferNumber];
+
+    pqueue->Active = 1U;
+    status = HAL_UART_Transmit_DMA(huart, pbuffer->pData, pbuffer->Size);
+    if (status != HAL_OK)
+    {
+      pqueue->Active = 0U;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Release the buffer of the UART Tx queue read by the DMA and chain the next one.
+  * @note   The next buffer is started while the last data of the previous one is still
+  *         being shifted out, so that no idle time is inserted between queued buffers.
+  * @param  huart UART handle.
+  * @retval HAL_OK when the next buffer is being sent, HAL_ERROR otherwise
+  */
+static HAL_StatusTypeDef UART_TxQueueNext(UART_HandleTypeDef *huart)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  HAL_StatusTypeDef status = HAL_ERROR;
+  void *pcontext;
+
+  if ((pqueue != NULL) && (pqueue->Active != 0U))
+  {
+    pcontext = pqueue->pBuffers[pqueue->GetCount % pqueue->BufferNumber].pContext;
+    pqueue->GetCount++;
+    pqueue->Active = 0U;
+
+    huart->gState = HAL_UART_STATE_READY;
+    if ((UART_TxQueueStart(huart) == HAL_OK) && (pqueue->Active != 0U))
+    {
+      status = HAL_OK;
+    }
+    else
+    {
+      /* No buffer left: end the transmission on the UART Transmit Complete event */
+      huart->gState = HAL_UART_STATE_BUSY_TX;
+    }
+
+    /* The buffer has been read by the DMA and can be reused by the application */
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+    /* Call registered Tx Buffer Complete Callback */
+    huart->TxBufferCpltCallback(huart, pcontext);
+#else
+    /* Call legacy weak Tx Buffer Complete Callback */
+    HAL_UARTEx_TxBufferCpltCallback(huart, pcontext);
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+  }
+
+  return status;
+}
+
 
 /**
   * @brief  End ongoing Tx transfer on UART peripheral (following error detection or Transmit completion).
@@ -3651,9 +3874,15 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Reset RxIsr function pointer */
   huart->RxISR = NULL;
+
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Release the bounce buffer of an interrupted DMA reception */
+  HAL_DCACHE_ReleaseRxDMA(huart);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
 }
 
 
@@ -3671,12 +3900,16 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   {
     huart->TxXferCount = 0U;
 
-    /* Disable the DMA transfer for transmit request by resetting the DMAT bit
-       in the UART CR3 register */
-    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+    /* Chain the next buffer of the Tx queue, if any */
+    if (UART_TxQueueNext(huart) != HAL_OK)
+    {
+      /* Disable the DMA transfer for transmit request by resetting the DMAT bit
+         in the UART CR3 register */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
-    /* Enable the UART Transmit Complete Interrupt */
-    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+      /* Enable the UART Transmit Complete Interrupt */
+      ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+    }
   }
   /* DMA Circular mode */
   else
@@ -3718,6 +3951,11 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
 {
   UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(huart, huart->pRxBuffPtr, UART_DMABufferSize(huart, huart->RxXferSize));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* DMA Normal mode */
   if (hdma->Init.Mode != DMA_CIRCULAR)
   {
@@ -3734,6 +3972,11 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     /* At end of Rx process, restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+    /* Release the bounce buffer of the reception */
+    HAL_DCACHE_ReleaseRxDMA(huart);
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
     /* If Reception till IDLE event has been selected, Disable IDLE Interrupt */
     if (huart->ReceptionType == HAL_UART_RECEPTION_TOIDLE)
     {
@@ -3741,6 +3984,12 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     }
   }
 
+  /* Count the Rx stream buffer wraps, the consumer derives the write position from them */
+  if (huart->pRxStream != NULL)
+  {
+    huart->pRxStream->WrapCount++;
+  }
+
   /* Initialize type of RxEvent that correspond to RxEvent callback execution;
      In this case, Rx Event type is Transfer Complete */
   huart->RxEventType = HAL_UART_RXEVENT_TC;
@@ -3791,6 +4040,11 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
 {
   UART_HandleTypeDef *huart = (UART_HandleTypeDef *)(hdma->Parent);
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+  /* Make the first half of the received data visible to the CPU */
+  HAL_DCACHE_SyncRxDMA(huart, huart->pRxBuffPtr, UART_DMABufferSize(huart, huart->RxXferSize / 2U));
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
   /* Initialize type of RxEvent that correspond to RxEvent callback execution;
      In this case, Rx Event type is Half Transfer */
   huart->RxEventType = HAL_UART_RXEVENT_HT;
@@ -3830,6 +4084,27 @@ static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma)
   }
 }
 
+#if (USE_HAL_DMA_DCACHE_MAINTENANCE == 1U)
+/**
+  * @brief  Compute the size in bytes of a UART DMA buffer.
+  * @param  huart UART handle.
+  * @param  Size Amount of data elements (u8 or u16).
+  * @retval Size in bytes
+  */
+static uint32_t UART_DMABufferSize(const UART_HandleTypeDef *huart, uint16_t Size)
+{
+  uint32_t nbytes = Size;
+
+  /* 9-bit data without parity are handled as a set of u16 */
+  if ((huart->Init.WordLength == UART_WORDLENGTH_9B) && (huart->Init.Parity == UART_PARITY_NONE))
+  {
+    nbytes = 2U * (uint32_t)Size;
+  }
+
+  return nbytes;
+}
+#endif /* USE_HAL_DMA_DCACHE_MAINTENANCE */
+
 /**
   * @brief DMA UART communication error callback.
   * @param hdma DMA handle.
@@ -3925,6 +4200,7 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -3973,6 +4249,7 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -4037,6 +4314,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -4215,6 +4493,12 @@ static void UART_EndTransmit_IT(UART_HandleTypeDef *huart)
   /*Call legacy weak Tx complete callback*/
   HAL_UART_TxCpltCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+
+  /* Start the buffers enqueued while the previous transmission was ending */
+  if (huart->pTxQueue != NULL)
+  {
+    (void)UART_TxQueueStart(huart);
+  }
 }
 
 /**
@@ -1078,6 +1078,8 @@ HAL_StatusTypeDef USB_EPClearStall(const USB_OTG_GlobalTypeDef *USBx, const USB_
 /**
   * @brief  USB_WritePacket : Writes a packet into the Tx FIFO associated
   *         with the EP/channel
+  * @note   Word aligned source buffers are pushed four words per loop iteration,
+  *         unaligned ones fall back to the byte-wise unaligned word access.
   * @param  USBx  Selected device
   * @param  src   pointer to source buffer
   * @param  ch_ep_num  endpoint or host channel number
@@ -1093,19 +1095,44 @@ HAL_StatusTypeDef USB_WritePacket(const USB_OTG_GlobalTypeDef *USBx, uint8_t *sr
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
   uint8_t *pSrc = src;
+  const uint32_t *pSrc32;
   uint32_t count32b;
   uint32_t i;
 
   if (dma == 0U)
   {
     count32b = ((uint32_t)len + 3U) / 4U;
-    for (i = 0U; i < count32b; i++)
+
+    if (((uint32_t)pSrc & 0x3U) == 0U)
     {
-      USBx_DFIFO((uint32_t)ch_ep_num) = __UNALIGNED_UINT32_READ(pSrc);
-      pSrc++;
-      pSrc++;
-      pSrc++;
-      pSrc++;
+      /* Word aligned buffer: unrolled word copies */
+      pSrc32 = (const uint32_t *)(void *)pSrc;
+
+      for (i = count32b >> 2U; i != 0U; i--)
+      {
+        USBx_DFIFO((uint32_t)ch_ep_num) = pSrc32[0];
+        USBx_DFIFO((uint32_t)ch_ep_num) = pSrc32[1];
+        USBx_DFIFO((uint32_t)ch_ep_num) = pSrc32[2];
+        USBx_DFIFO((uint32_t)ch_ep_num) = pSrc32[3];
+        pSrc32 = &pSrc32[4];
+      }
+
+      for (i = count32b & 0x3U; i != 0U; i--)
+      {
+        USBx_DFIFO((uint32_t)ch_ep_num) = *pSrc32;
+        pSrc32++;
+      }
+    }
+    else
+    {
+      for (i = 0U; i < count32b; i++)
+      {
+        USBx_DFIFO((uint32_t)ch_ep_num) = __UNALIGNED_UINT32_READ(pSrc);
+        pSrc++;
+        pSrc++;
+        pSrc++;
+        pSrc++;
+      }
     }
   }
 
@@ -1114,6 +1141,8 @@ HAL_StatusTypeDef USB_WritePacket(const USB_OTG_GlobalTypeDef *USBx, uint8_t *sr
 
 /**
   * @brief  USB_ReadPacket : read a packet from the RX FIFO
+  * @note   Word aligned destination buffers are filled four words per loop iteration,
+  *         unaligned ones fall back to the byte-wise unaligned word access.
   * @param  USBx  Selected device
   * @param  dest  source pointer
   * @param  len  Number of bytes to read
@@ -1123,18 +1152,44 @@ void *USB_ReadPacket(const USB_OTG_GlobalTypeDef *USBx, uint8_t *dest, uint16_t
 {
   uint32_t USBx_BASE = (uint32_t)USBx;
   uint8_t *pDest = dest;
+  uint32_t *pDest32;
   uint32_t pData;
   uint32_t i;
   uint32_t count32b = (uint32_t)len >> 2U;
   uint16_t remaining_bytes = len % 4U;
 
-  for (i = 0U; i < count32b; i++)
+  if (((uint32_t)pDest & 0x3U) == 0U)
+  {
+    /* Word aligned buffer: unrolled word copies */
+    pDest32 = (uint32_t *)(void *)pDest;
+
+    for (i = count32b >> 2U; i != 0U; i--)
+    {
+      pDest32[0] = USBx_DFIFO(0U);
+      pDest32[1] = USBx_DFIFO(0U);
+      pDest32[2] = USBx_DFIFO(0U);
+      pDest32[3] = USBx_DFIFO(0U);
+      pDest32 = &pDest32[4];
+    }
+
+    for (i = count32b & 0x3U; i != 0U; i--)
+    {
+      *pDest32 = USBx_DFIFO(0U);
+      pDest32++;
+    }
+
+    pDest = (uint8_t *)(void *)pDest32;
+  }
+  else
   {
-    __UNALIGNED_UINT32_WRITE(pDest, USBx_DFIFO(0U));
-    pDest++;
-    pDest++;
-    pDest++;
-    pDest++;
+    for (i = 0U; i < count32b; i++)
+    {
+      __UNALIGNED_UINT32_WRITE(pDest, USBx_DFIFO(0U));
+      pDest++;
+      pDest++;
+      pDest++;
+      pDest++;
+    }
   }
 
   /* When Number of data is not word aligned, read the remaining byte */
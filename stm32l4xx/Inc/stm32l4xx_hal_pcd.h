@@ -94,6 +94,31 @@ typedef USB_CfgTypeDef     PCD_InitTypeDef;
 typedef USB_EPTypeDef      PCD_EPTypeDef;
 #endif /* defined (USB) */
 
+/**
+  * @brief  PCD isochronous stream structure definition
+  */
+typedef struct __PCD_IsoStreamTypeDef
+{
+  uint8_t   ep_addr;        /*!< Isochronous data endpoint address, bit 7 set for an IN stream          */
+  uint8_t   fb_ep_addr;     /*!< Isochronous feedback IN endpoint address, 0 when not used               */
+  uint8_t   fb_size;        /*!< Feedback packet size: 3 (full speed 10.14) or 4 (high speed 16.16)      */
+  uint8_t   fb_interval;    /*!< Number of SOF between two feedback packets                              */
+  uint8_t   *buff;          /*!< Ring storage of depth * maxpacket bytes                                 */
+  uint16_t  *length;        /*!< Length of each packet of the ring, depth entries                        */
+  uint32_t  maxpacket;      /*!< Size of a ring slot, at least the endpoint Max Packet size              */
+  uint32_t  depth;          /*!< Number of packets in the ring                                           */
+  __IO uint32_t head;       /*!< Packets produced, by the application (IN) or the endpoint (OUT)         */
+  __IO uint32_t tail;       /*!< Packets consumed, by the endpoint (IN) or the application (OUT)         */
+  uint32_t  pending;        /*!< A ring slot was submitted on the last SOF                               */
+  __IO uint32_t fb_value;   /*!< Current feedback value                                                  */
+  uint32_t  fb_buff;        /*!< Feedback packet buffer                                                  */
+  uint32_t  fb_count;       /*!< SOF counter of the feedback interval                                    */
+  __IO uint32_t underruns;  /*!< IN: SOF with no queued packet, a zero length packet was sent            */
+  __IO uint32_t overruns;   /*!< OUT: SOF with a full ring, the received packet was dropped              */
+  __IO uint32_t incomplete; /*!< Incomplete isochronous transfers reported by the controller             */
+  struct __PCD_IsoStreamTypeDef *next; /*!< Next stream served on SOF                                    */
+} PCD_IsoStreamTypeDef;
+
 /**
   * @brief  PCD Handle Structure definition
   */
@@ -129,6 +154,7 @@ typedef struct
   uint32_t battery_charging_active;    /*!< Enable or disable Battery charging.
                                        This parameter can be set to ENABLE or DISABLE        */
   void                    *pData;      /*!< Pointer to upper stack Handler */
+  PCD_IsoStreamTypeDef    *pIsoStream; /*!< Isochronous streams served on SOF */
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
   void (* SOFCallback)(struct __PCD_HandleTypeDef *hpcd);                              /*!< USB OTG PCD SOF callback                */
@@ -369,6 +395,11 @@ HAL_StatusTypeDef HAL_PCD_EP_Abort(PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
 HAL_StatusTypeDef HAL_PCD_ActivateRemoteWakeup(PCD_HandleTypeDef *hpcd);
 HAL_StatusTypeDef HAL_PCD_DeActivateRemoteWakeup(PCD_HandleTypeDef *hpcd);
 uint32_t          HAL_PCD_EP_GetRxCount(PCD_HandleTypeDef const *hpcd, uint8_t ep_addr);
+HAL_StatusTypeDef HAL_PCD_ISO_StreamStart(PCD_HandleTypeDef *hpcd, PCD_IsoStreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_PCD_ISO_StreamStop(PCD_HandleTypeDef *hpcd, PCD_IsoStreamTypeDef *pStream);
+HAL_StatusTypeDef HAL_PCD_ISO_StreamWrite(PCD_IsoStreamTypeDef *pStream, const uint8_t *pBuf, uint32_t len);
+HAL_StatusTypeDef HAL_PCD_ISO_StreamRead(PCD_IsoStreamTypeDef *pStream, uint8_t *pBuf, uint32_t *pLen);
+void              HAL_PCD_ISO_StreamSetFeedback(PCD_IsoStreamTypeDef *pStream, uint32_t feedback);
 /**
   * @}
   */
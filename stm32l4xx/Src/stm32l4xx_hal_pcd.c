@@ -50,6 +50,16 @@
      (#)Enable PCD transmission and reception:
          (##) HAL_PCD_Start();
 
+     (#)Isochronous streaming: open the isochronous endpoint(s) with HAL_PCD_EP_Open(),
+        fill a PCD_IsoStreamTypeDef with a ring of packet buffers and call
+        HAL_PCD_ISO_StreamStart(). One packet is then submitted or armed on each SOF:
+         (##) IN stream: queue packets with HAL_PCD_ISO_StreamWrite(), a zero length
+              packet is sent and the underruns counter incremented when the ring is empty.
+         (##) OUT stream: fetch packets with HAL_PCD_ISO_StreamRead(), the overruns
+              counter is incremented when the ring is full.
+         (##) Feedback endpoint: update the value with HAL_PCD_ISO_StreamSetFeedback(),
+              it is sent every fb_interval SOF.
+
      (#)NOTE: For applications not using double buffer mode, define the symbol
                'USE_USB_DOUBLE_BUFFER' as 0 to reduce the driver's memory footprint.
 
@@ -103,6 +113,8 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd, PCD_EPT
 static uint16_t HAL_PCD_EP_DB_Receive(PCD_HandleTypeDef *hpcd, PCD_EPTypeDef *ep, uint16_t wEPVal);
 #endif /* (USE_USB_DOUBLE_BUFFER == 1U) */
 #endif /* defined (USB) */
+static void PCD_ISO_StreamSOF(PCD_HandleTypeDef *hpcd);
+static void PCD_ISO_StreamIncomplete(const PCD_HandleTypeDef *hpcd, uint8_t ep_addr);
 /**
   * @}
   */
@@ -179,6 +191,9 @@ HAL_StatusTypeDef HAL_PCD_Init(PCD_HandleTypeDef *hpcd)
 
   hpcd->State = HAL_PCD_STATE_BUSY;
 
+  /* No isochronous stream attached */
+  hpcd->pIsoStream = NULL;
+
   /* Disable DMA mode for FS instance */
   hpcd->Init.dma_enable = 0U;
 
@@ -1173,6 +1188,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
             if (ep->is_iso_incomplete == 1U)
             {
               ep->is_iso_incomplete = 0U;
+              PCD_ISO_StreamIncomplete(hpcd, (uint8_t)epnum);
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
               hpcd->ISOOUTIncompleteCallback(hpcd, (uint8_t)epnum);
@@ -1248,6 +1264,7 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
             if (ep->is_iso_incomplete == 1U)
             {
               ep->is_iso_incomplete = 0U;
+              PCD_ISO_StreamIncomplete(hpcd, (uint8_t)(epnum | 0x80U));
 
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
               hpcd->ISOINIncompleteCallback(hpcd, (uint8_t)epnum);
@@ -1407,6 +1424,8 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
     /* Handle SOF Interrupt */
     if (__HAL_PCD_GET_FLAG(hpcd, USB_OTG_GINTSTS_SOF))
     {
+      PCD_ISO_StreamSOF(hpcd);
+
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
       hpcd->SOFCallback(hpcd);
 #else
@@ -1636,6 +1655,8 @@ void HAL_PCD_IRQHandler(PCD_HandleTypeDef *hpcd)
   {
     __HAL_PCD_CLEAR_FLAG(hpcd, USB_ISTR_SOF);
 
+    PCD_ISO_StreamSOF(hpcd);
+
 #if (USE_HAL_PCD_REGISTER_CALLBACKS == 1U)
     hpcd->SOFCallback(hpcd);
 #else
@@ -2209,6 +2230,199 @@ HAL_StatusTypeDef HAL_PCD_DeActivateRemoteWakeup(PCD_HandleTypeDef *hpcd)
   return (USB_DeActivateRemoteWakeup(hpcd->Instance));
 }
 
+/**
+  * @brief  Start an isochronous stream served on each SOF.
+  * @note   One packet is submitted (IN) or armed (OUT) per (micro)frame, the
+  *         endpoint must have been opened as EP_TYPE_ISOC with a bInterval of 1.
+  *         The data endpoint must not be handled by the DataIn/DataOut stage
+  *         callbacks while the stream is running.
+  * @param  hpcd PCD handle
+  * @param  pStream stream structure, ep_addr, fb_* and ring fields filled by the caller
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamStart(PCD_HandleTypeDef *hpcd, PCD_IsoStreamTypeDef *pStream)
+{
+  PCD_EPTypeDef *ep;
+
+  if ((pStream == NULL) || (pStream->buff == NULL) || (pStream->length == NULL) ||
+      (pStream->depth == 0U) || (pStream->maxpacket == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pStream->fb_ep_addr != 0U) &&
+      (((pStream->fb_ep_addr & 0x80U) == 0U) || (pStream->fb_interval == 0U) ||
+       ((pStream->fb_size != 3U) && (pStream->fb_size != 4U))))
+  {
+    return HAL_ERROR;
+  }
+
+#if defined (USB_OTG_FS)
+  /* SOF interrupt is needed to serve the stream, and the DMA needs word aligned slots */
+  if ((hpcd->Init.Sof_enable == 0U) ||
+      ((hpcd->Init.dma_enable == 1U) && ((((uint32_t)pStream->buff | pStream->maxpacket) & 0x3U) != 0U)))
+  {
+    return HAL_ERROR;
+  }
+#endif /* defined (USB_OTG_FS) */
+
+  if ((0x80U & pStream->ep_addr) == 0x80U)
+  {
+    ep = &hpcd->IN_ep[pStream->ep_addr & EP_ADDR_MSK];
+  }
+  else
+  {
+    ep = &hpcd->OUT_ep[pStream->ep_addr & EP_ADDR_MSK];
+  }
+
+  if ((ep->type != EP_TYPE_ISOC) || (pStream->maxpacket < ep->maxpacket))
+  {
+    return HAL_ERROR;
+  }
+
+  __HAL_LOCK(hpcd);
+
+  pStream->head = 0U;
+  pStream->tail = 0U;
+  pStream->pending = 0U;
+  pStream->fb_count = 0U;
+  pStream->underruns = 0U;
+  pStream->overruns = 0U;
+  pStream->incomplete = 0U;
+
+  /* Attach the stream, it is served from the next SOF */
+  pStream->next = hpcd->pIsoStream;
+  hpcd->pIsoStream = pStream;
+
+  __HAL_UNLOCK(hpcd);
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Stop an isochronous stream.
+  * @note   The endpoint is left open, a packet already submitted may still complete.
+  * @param  hpcd PCD handle
+  * @param  pStream stream structure
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamStop(PCD_HandleTypeDef *hpcd, PCD_IsoStreamTypeDef *pStream)
+{
+  PCD_IsoStreamTypeDef **pLink;
+  HAL_StatusTypeDef ret = HAL_ERROR;
+
+  __HAL_LOCK(hpcd);
+
+  pLink = &hpcd->pIsoStream;
+
+  while ((*pLink != NULL) && (ret != HAL_OK))
+  {
+    if (*pLink == pStream)
+    {
+      /* Detach the stream */
+      *pLink = pStream->next;
+      ret = HAL_OK;
+    }
+    else
+    {
+      pLink = &(*pLink)->next;
+    }
+  }
+
+  __HAL_UNLOCK(hpcd);
+
+  return ret;
+}
+
+/**
+  * @brief  Queue a packet on an isochronous IN stream.
+  * @param  pStream stream structure
+  * @param  pBuf pointer to the packet data
+  * @param  len packet length, at most maxpacket
+  * @retval HAL status, HAL_BUSY when the ring is full
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamWrite(PCD_IsoStreamTypeDef *pStream, const uint8_t *pBuf, uint32_t len)
+{
+  uint8_t *pSlot;
+  uint32_t slot;
+  uint32_t count;
+
+  if (((pStream->ep_addr & 0x80U) == 0U) || (len > pStream->maxpacket))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((pStream->head - pStream->tail) >= pStream->depth)
+  {
+    return HAL_BUSY;
+  }
+
+  slot = pStream->head % pStream->depth;
+  pSlot = &pStream->buff[slot * pStream->maxpacket];
+
+  for (count = 0U; count < len; count++)
+  {
+    pSlot[count] = pBuf[count];
+  }
+
+  pStream->length[slot] = (uint16_t)len;
+
+  /* Publish the packet to the SOF handler */
+  pStream->head++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Fetch the oldest packet received on an isochronous OUT stream.
+  * @param  pStream stream structure
+  * @param  pBuf pointer to a buffer of at least maxpacket bytes
+  * @param  pLen returned packet length
+  * @retval HAL status, HAL_BUSY when the ring is empty
+  */
+HAL_StatusTypeDef HAL_PCD_ISO_StreamRead(PCD_IsoStreamTypeDef *pStream, uint8_t *pBuf, uint32_t *pLen)
+{
+  const uint8_t *pSlot;
+  uint32_t slot;
+  uint32_t count;
+
+  if ((pStream->ep_addr & 0x80U) == 0x80U)
+  {
+    return HAL_ERROR;
+  }
+
+  if (pStream->head == pStream->tail)
+  {
+    return HAL_BUSY;
+  }
+
+  slot = pStream->tail % pStream->depth;
+  pSlot = &pStream->buff[slot * pStream->maxpacket];
+
+  for (count = 0U; count < (uint32_t)pStream->length[slot]; count++)
+  {
+    pBuf[count] = pSlot[count];
+  }
+
+  *pLen = (uint32_t)pStream->length[slot];
+
+  /* Give the slot back to the SOF handler */
+  pStream->tail++;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Update the value sent on the feedback endpoint of a stream.
+  * @param  pStream stream structure
+  * @param  feedback feedback value, 10.14 (full speed) or 16.16 (high speed) format
+  * @retval None
+  */
+void HAL_PCD_ISO_StreamSetFeedback(PCD_IsoStreamTypeDef *pStream, uint32_t feedback)
+{
+  pStream->fb_value = feedback;
+}
+
 /**
   * @}
   */
@@ -2943,6 +3157,113 @@ static HAL_StatusTypeDef HAL_PCD_EP_DB_Transmit(PCD_HandleTypeDef *hpcd,
 #endif /* (USE_USB_DOUBLE_BUFFER == 1U) */
 #endif /* defined (USB) */
 
+
+/**
+  * @brief  Serve the isochronous streams on SOF.
+  * @param  hpcd PCD handle
+  * @retval None
+  */
+static void PCD_ISO_StreamSOF(PCD_HandleTypeDef *hpcd)
+{
+  PCD_IsoStreamTypeDef *pStream = hpcd->pIsoStream;
+  uint32_t slot;
+  uint32_t len;
+
+  while (pStream != NULL)
+  {
+    if ((pStream->ep_addr & 0x80U) == 0x80U)
+    {
+      /* The packet submitted on the previous SOF went out during the last frame */
+      if (pStream->pending != 0U)
+      {
+        pStream->pending = 0U;
+        pStream->tail++;
+      }
+
+      if (pStream->head != pStream->tail)
+      {
+        slot = pStream->tail % pStream->depth;
+        pStream->pending = 1U;
+
+        (void)HAL_PCD_EP_Transmit(hpcd, pStream->ep_addr, &pStream->buff[slot * pStream->maxpacket],
+                                  (uint32_t)pStream->length[slot]);
+      }
+      else
+      {
+        /* Nothing queued, keep the stream running with a zero length packet */
+        pStream->underruns++;
+        (void)HAL_PCD_EP_Transmit(hpcd, pStream->ep_addr, NULL, 0U);
+      }
+    }
+    else
+    {
+      /* Commit the packet received during the last frame, if any */
+      if (pStream->pending != 0U)
+      {
+        pStream->pending = 0U;
+        len = HAL_PCD_EP_GetRxCount(hpcd, pStream->ep_addr);
+
+        if (len != 0U)
+        {
+          pStream->length[pStream->head % pStream->depth] = (uint16_t)len;
+          pStream->head++;
+        }
+      }
+
+      if ((pStream->head - pStream->tail) < pStream->depth)
+      {
+        slot = pStream->head % pStream->depth;
+        pStream->pending = 1U;
+
+        (void)HAL_PCD_EP_Receive(hpcd, pStream->ep_addr, &pStream->buff[slot * pStream->maxpacket],
+                                 pStream->maxpacket);
+      }
+      else
+      {
+        /* Ring full, the packet of this frame is dropped */
+        pStream->overruns++;
+      }
+    }
+
+    if (pStream->fb_ep_addr != 0U)
+    {
+      pStream->fb_count++;
+
+      if (pStream->fb_count >= (uint32_t)pStream->fb_interval)
+      {
+        pStream->fb_count = 0U;
+        pStream->fb_buff = pStream->fb_value;
+
+        (void)HAL_PCD_EP_Transmit(hpcd, pStream->fb_ep_addr, (uint8_t *)&pStream->fb_buff,
+                                  (uint32_t)pStream->fb_size);
+      }
+    }
+
+    pStream = pStream->next;
+  }
+}
+
+/**
+  * @brief  Account an incomplete isochronous transfer on the matching stream.
+  * @param  hpcd PCD handle
+  * @param  ep_addr endpoint address
+  * @retval None
+  */
+static void PCD_ISO_StreamIncomplete(const PCD_HandleTypeDef *hpcd, uint8_t ep_addr)
+{
+  PCD_IsoStreamTypeDef *pStream = hpcd->pIsoStream;
+
+  while (pStream != NULL)
+  {
+    if (pStream->ep_addr == ep_addr)
+    {
+      pStream->incomplete++;
+    }
+
+    pStream = pStream->next;
+  }
+}
+
 /**
   * @}
   */
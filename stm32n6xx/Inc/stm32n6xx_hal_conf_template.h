@@ -165,6 +165,7 @@
 #define  VDD_VALUE                  3300UL /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY          15U  /*!< tick interrupt priority (lowest by default) */
 #define  USE_RTOS                   0U
+#define  USE_HAL_ATOMIC_LOCK        0U
 
 /* ########################## Assert Selection ############################## */
 /**
@@ -580,6 +580,8 @@ static void DMA_List_FormatNode(DMA_NodeTypeDef *const pNode,
 static void DMA_List_ClearUnusedFields(DMA_NodeTypeDef *const pNode,
                                        uint32_t FirstUnusedField);
 static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList);
+static DMA_NodeTypeDef *DMA_List_GetTailNode(DMA_QListTypeDef *const pQList,
+                                             uint32_t cllr_offset);
 
 /* Exported functions ------------------------------------------------------------------------------------------------*/
 
@@ -981,6 +983,7 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
       (+) Convert dynamic linked-list queue to static format.
       (+) Link linked-list queue to DMA channel.
       (+) Unlink linked-list queue from DMA channel.
+      (+) Allocate and free linked-list nodes from a node pool.
 
     [..]
       (+) The HAL_DMAEx_List_BuildNode() function allows to build linked-list node.
@@ -1038,6 +1041,17 @@ HAL_StatusTypeDef HAL_DMAEx_List_Start_IT(DMA_HandleTypeDef *const hdma)
       (+) The HAL_DMAEx_List_UnLinkQ() function allows to unlink the (Dynamic / Static) linked-list queue from DMA
           channel when execution is completed.
 
+      (+) The HAL_DMAEx_List_InitNodePool() function allows to initialize a pool of linked-list nodes from a node
+          array statically allocated by the application (ALIGN_32BYTES() can be used to align it on a cache
+          line). Calling it again returns all the pool nodes to the pool.
+
+      (+) The HAL_DMAEx_List_AllocNode() and HAL_DMAEx_List_FreeNode() functions allow to take a node from
+          (respectively to give back a node to) the node pool in constant time.
+
+      (+) The queue keeps track of its tail node: HAL_DMAEx_List_InsertNode_Head(),
+          HAL_DMAEx_List_InsertNode_Tail() and HAL_DMAEx_List_RemoveNode_Head() execute in constant time, except
+          the first tail insertion after a queue operation that cannot update the tail node.
+
 @endverbatim
   * @{
   */
@@ -1220,6 +1234,7 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *const pQList,
     if (pPrevNode == NULL)
     {
       pQList->Head       = pNewNode;
+      pQList->Tail       = pNewNode;
       pQList->NodeNumber = 1U;
     }
     /* Add previous node then new node to queue */
@@ -1227,6 +1242,7 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *const pQList,
     {
       pQList->Head                          = pPrevNode;
       pPrevNode->LinkRegisters[cllr_offset] = ((uint32_t)pNewNode & DMA_CLLR_LA) | cllr_mask;
+      pQList->Tail                          = pNewNode;
       pQList->NodeNumber                    = 2U;
     }
   }
@@ -1256,6 +1272,7 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode(DMA_QListTypeDef *const pQList,
           }
 
           pPrevNode->LinkRegisters[cllr_offset] = ((uint32_t)pNewNode & DMA_CLLR_LA) | cllr_mask;
+          pQList->Tail                          = pNewNode;
         }
         /* Selected node is not the last queue node */
         else
@@ -1342,6 +1359,7 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Head(DMA_QListTypeDef *const pQList,
   if (pQList->Head == NULL)
   {
     pQList->Head = pNewNode;
+    pQList->Tail = pNewNode;
   }
   /* Not empty queue */
   else
@@ -1377,7 +1395,6 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList,
 {
   uint32_t cllr_mask;
   uint32_t cllr_offset;
-  DMA_NodeInQInfoTypeDef node_info;
 
   /* Check the queue and the new node parameters */
   if ((pQList == NULL) || (pNewNode == NULL))
@@ -1423,20 +1440,19 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList,
     /* Get CLLR register mask and offset */
     DMA_List_GetCLLRNodeInfo(pNewNode, &cllr_mask, &cllr_offset);
 
-    /* Find node and get its position in selected queue */
-    node_info.cllr_offset = cllr_offset;
-    (void)DMA_List_FindNode(pQList, NULL, &node_info);
-
     /* Check if queue is circular */
     if (pQList->FirstCircularNode != NULL)
     {
       pNewNode->LinkRegisters[cllr_offset] = ((uint32_t)pQList->FirstCircularNode & DMA_CLLR_LA) | cllr_mask;
     }
 
-    ((DMA_NodeTypeDef *)node_info.currentnode_addr)->LinkRegisters[cllr_offset] =
+    DMA_List_GetTailNode(pQList, cllr_offset)->LinkRegisters[cllr_offset] =
       ((uint32_t)pNewNode & DMA_CLLR_LA) | cllr_mask;
   }
 
+  /* Update the queue tail node */
+  pQList->Tail = pNewNode;
+
   /* Increment queue node number */
   pQList->NodeNumber++;
 
@@ -1446,9 +1462,6 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertNode_Tail(DMA_QListTypeDef *const pQList,
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_READY;
 
-  /* Prevent MISRA-C2012-Rule-2.2_b */
-  UNUSED(node_info);
-
   return HAL_OK;
 }
 
@@ -1493,6 +1506,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode(DMA_QListTypeDef *const pQList,
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -1604,7 +1620,6 @@ HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode_Head(DMA_QListTypeDef *const pQList)
 {
   uint32_t cllr_offset;
   uint32_t current_addr;
-  DMA_NodeInQInfoTypeDef node_info;
 
   /* Check the queue parameter */
   if (pQList == NULL)
@@ -1652,12 +1667,8 @@ HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode_Head(DMA_QListTypeDef *const pQList)
     /* Check if first circular node queue is the first node */
     if (pQList->FirstCircularNode == pQList->Head)
     {
-      /* Find last queue node */
-      node_info.cllr_offset = cllr_offset;
-      (void)DMA_List_FindNode(pQList, NULL, &node_info);
-
       /* Clear last node link */
-      ((DMA_NodeTypeDef *)(node_info.currentnode_addr))->LinkRegisters[cllr_offset] = 0U;
+      DMA_List_GetTailNode(pQList, cllr_offset)->LinkRegisters[cllr_offset] = 0U;
 
       /* Clear first circular node */
       pQList->FirstCircularNode = NULL;
@@ -1686,9 +1697,6 @@ HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode_Head(DMA_QListTypeDef *const pQList)
     pQList->State = HAL_DMA_QUEUE_STATE_READY;
   }
 
-  /* Prevent MISRA-C2012-Rule-2.2_b */
-  UNUSED(node_info);
-
   return HAL_OK;
 }
 
@@ -1729,6 +1737,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_RemoveNode_Tail(DMA_QListTypeDef *const pQList)
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -1845,6 +1856,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ReplaceNode(DMA_QListTypeDef *const pQList,
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2007,6 +2021,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ReplaceNode_Head(DMA_QListTypeDef *const pQList
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2086,6 +2103,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ReplaceNode_Tail(DMA_QListTypeDef *const pQList
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2175,6 +2195,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_ResetQ(DMA_QListTypeDef *const pQList)
   /* Update the queue state */
   pQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pQList->Tail = NULL;
+
   /* Update the queue error code */
   pQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2299,6 +2322,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertQ(DMA_QListTypeDef *const pSrcQList,
   /* Update the destination queue state */
   pDestQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pDestQList->Tail = NULL;
+
   /* Update the destination queue error code */
   pDestQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2497,6 +2523,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertQ_Head(DMA_QListTypeDef *const pSrcQList,
   /* Update the destination queue state */
   pDestQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pDestQList->Tail = NULL;
+
   /* Update the destination queue error code */
   pDestQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -2634,6 +2663,9 @@ HAL_StatusTypeDef HAL_DMAEx_List_InsertQ_Tail(DMA_QListTypeDef *const pSrcQList,
   /* Update the destination queue state */
   pDestQList->State = HAL_DMA_QUEUE_STATE_BUSY;
 
+  /* The tail node is found again on the next tail insertion */
+  pDestQList->Tail = NULL;
+
   /* Update the destination queue error code */
   pDestQList->ErrorCode = HAL_DMA_QUEUE_ERROR_NONE;
 
@@ -3235,6 +3267,126 @@ HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *const hdma)
 
   return HAL_OK;
 }
+/**
+  * @brief  Initialize a pool of linked-list nodes.
+  * @param  pPool      : Pointer to a DMA_NodePoolTypeDef structure that contains the node pool information.
+  * @param  pNodes     : Pointer to the array of DMA_NodeTypeDef structures managed by the pool.
+  * @param  NodeNumber : Number of nodes in the array.
+  * @note   The node array should be statically allocated, 32bit aligned, and should not cross a 64 KByte boundary as
+  *         all the nodes of a queue must be in the same addressable space.
+  * @note   Calling this function on an already initialized pool gives back all the pool nodes to the pool. This must
+  *         only be done when no queue uses the pool nodes anymore.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_InitNodePool(DMA_NodePoolTypeDef *const pPool,
+                                              DMA_NodeTypeDef *const pNodes,
+                                              uint32_t NodeNumber)
+{
+  uint32_t node_idx;
+
+  /* Check the pool and the node array parameters */
+  if ((pPool == NULL) || (pNodes == NULL) || (NodeNumber == 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check the node array alignment and addressable space */
+  if ((((uint32_t)pNodes & 0x3U) != 0U) ||
+      (((uint32_t)pNodes & DMA_CLBAR_LBA) != ((uint32_t)&pNodes[NodeNumber - 1U] & DMA_CLBAR_LBA)))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Chain all the nodes in the free node list */
+  for (node_idx = 0U; node_idx < (NodeNumber - 1U); node_idx++)
+  {
+    pNodes[node_idx].LinkRegisters[0U] = (uint32_t)&pNodes[node_idx + 1U];
+  }
+  pNodes[NodeNumber - 1U].LinkRegisters[0U] = 0U;
+
+  /* Initialize the pool information */
+  pPool->pNodes         = pNodes;
+  pPool->NodeNumber     = NodeNumber;
+  pPool->pFreeNode      = pNodes;
+  pPool->FreeNodeNumber = NodeNumber;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Allocate a linked-list node from a node pool.
+  * @param  pPool  : Pointer to a DMA_NodePoolTypeDef structure that contains the node pool information.
+  * @param  ppNode : Pointer to the allocated node address.
+  * @note   The allocated node content is undefined until HAL_DMAEx_List_BuildNode() is called.
+  * @note   This function is not reentrant: a pool shared between thread and interrupt contexts must be protected by
+  *         the application.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_AllocNode(DMA_NodePoolTypeDef *const pPool,
+                                           DMA_NodeTypeDef **const ppNode)
+{
+  DMA_NodeTypeDef *pnode;
+
+  /* Check the pool and the node parameters */
+  if ((pPool == NULL) || (ppNode == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check that the pool is not empty */
+  if (pPool->pFreeNode == NULL)
+  {
+    *ppNode = NULL;
+
+    return HAL_ERROR;
+  }
+
+  /* Take the first free node */
+  pnode                 = pPool->pFreeNode;
+  pPool->pFreeNode      = (DMA_NodeTypeDef *)pnode->LinkRegisters[0U];
+  pPool->FreeNodeNumber--;
+
+  /* Clear the free node link */
+  pnode->LinkRegisters[0U] = 0U;
+
+  *ppNode = pnode;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Free a linked-list node to its node pool.
+  * @param  pPool : Pointer to a DMA_NodePoolTypeDef structure that contains the node pool information.
+  * @param  pNode : Pointer to a DMA_NodeTypeDef structure allocated from the pool.
+  * @note   The node must have been removed from its queue before being freed.
+  * @note   This function is not reentrant: a pool shared between thread and interrupt contexts must be protected by
+  *         the application.
+  * @retval HAL status.
+  */
+HAL_StatusTypeDef HAL_DMAEx_List_FreeNode(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNode)
+{
+  /* Check the pool and the node parameters */
+  if ((pPool == NULL) || (pNode == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Check that the node belongs to the pool */
+  if (((uint32_t)pNode < (uint32_t)pPool->pNodes) ||
+      ((uint32_t)pNode > (uint32_t)&pPool->pNodes[pPool->NodeNumber - 1U]) ||
+      ((((uint32_t)pNode - (uint32_t)pPool->pNodes) % sizeof(DMA_NodeTypeDef)) != 0U))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Give back the node at the head of the free node list */
+  pNode->LinkRegisters[0U] = (uint32_t)pPool->pFreeNode;
+  pPool->pFreeNode         = pNode;
+  pPool->FreeNodeNumber++;
+
+  return HAL_OK;
+}
 /**
   * @}
   */
@@ -4723,6 +4875,9 @@ static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList)
   /* Clear head node */
   pQList->Head = NULL;
 
+  /* Clear tail node */
+  pQList->Tail = NULL;
+
   /* Clear first circular queue node */
   pQList->FirstCircularNode = NULL;
 
@@ -4738,6 +4893,29 @@ static void DMA_List_CleanQueue(DMA_QListTypeDef *const pQList)
   /* Reset queue type */
   pQList->Type = QUEUE_TYPE_STATIC;
 }
+
+/**
+  * @brief  Get the tail node of a not empty queue.
+  * @param  pQList      : Pointer to a DMA_QListTypeDef structure that contains queue information.
+  * @param  cllr_offset : Offset of the CLLR register in the queue nodes.
+  * @retval Pointer to the queue tail node.
+  */
+static DMA_NodeTypeDef *DMA_List_GetTailNode(DMA_QListTypeDef *const pQList,
+                                             uint32_t cllr_offset)
+{
+  DMA_NodeInQInfoTypeDef node_info;
+
+  /* Find the tail node when it is not known */
+  if (pQList->Tail == NULL)
+  {
+    node_info.cllr_offset = cllr_offset;
+    (void)DMA_List_FindNode(pQList, NULL, &node_info);
+
+    pQList->Tail = (DMA_NodeTypeDef *)node_info.currentnode_addr;
+  }
+
+  return pQList->Tail;
+}
 /**
   * @}
   */
@@ -58,11 +58,18 @@
 
       (#) When data is received user can call the following API to get received data:
           (##) HAL_ETH_ReadData(): Read a received packet
+          (##) HAL_ETH_ReadDataBurst(): Read several received packets in one pass,
+               the consumed Rx descriptors are refilled once at the end
 
-      (#) For transmission path, two APIs are available:
+      (#) For transmission path, three APIs are available:
          (##) HAL_ETH_Transmit(): Transmit an ETH frame in blocking mode
          (##) HAL_ETH_Transmit_IT(): Transmit an ETH frame in interrupt mode,
               HAL_ETH_TxCpltCallback() will be executed when end of transfer occur
+         (##) HAL_ETH_TransmitBurst_IT(): Transmit several ETH frames in interrupt mode
+              with a single start of the Tx DMA
+      (#) The transmitted buffers are given back with HAL_ETH_ReleaseTxPacket(), one
+          HAL_ETH_TxFreeCallback() per packet, or with HAL_ETH_ReleaseTxPacketBurst(),
+          a single HAL_ETH_TxFreeBurstCallback() for all the completed packets
 
       (#) Communication with an external PHY device:
          (##) HAL_ETH_ReadPHYRegister(): Read a register from an external PHY
@@ -75,6 +82,11 @@
       (#) Configure the Ethernet DMA after ETH peripheral initialization
           (##) HAL_ETH_GetDMAConfig(): Get DMA actual configuration into ETH_DMAConfigTypeDef
           (##) HAL_ETH_SetDMAConfig(): Set DMA configuration based on ETH_DMAConfigTypeDef
+          (##) HAL_ETH_GetItCoalescingConfig(): Get the interrupt coalescing configuration
+               into ETH_ItCoalescingConfigTypeDef
+          (##) HAL_ETH_SetItCoalescingConfig(): Set the interrupt coalescing configuration
+               based on ETH_ItCoalescingConfigTypeDef, one Rx/Tx complete interrupt per
+               descriptor or packet is used by default
 
       (#) Configure the Ethernet PTP after ETH peripheral initialization
           (##) Define HAL_ETH_USE_PTP to use PTP APIs.
@@ -87,6 +99,10 @@
           (##) HAL_ETH_PTP_InsertTxTimestamp(): Insert Timestamp in transmission
           (##) HAL_ETH_PTP_GetTxTimestamp(): Get transmission timestamp
           (##) HAL_ETH_PTP_GetRxTimestamp(): Get reception timestamp
+          (##) HAL_ETH_PTP_ServoInit(): Initialize a fixed-point PI clock servo
+          (##) HAL_ETH_PTP_ServoUpdate(): Feed the servo with a measured offset from the master,
+               the PTP time is stepped or its frequency slewed through the Addend register
+          (##) HAL_ETH_PTP_ServoCompute(): Servo math only, without any register access
 
       -@- The ARP offload feature is not supported in this driver.
 
@@ -121,6 +137,9 @@
   For specific callbacks TxFreeCallback use dedicated register callbacks:
   respectively HAL_ETH_RegisterTxFreeCallback().
 
+  For specific callbacks TxFreeBurstCallback use dedicated register callbacks:
+  respectively HAL_ETH_RegisterTxFreeBurstCallback().
+
   For specific callbacks TxPtpCallback use dedicated register callbacks:
   respectively HAL_ETH_RegisterTxPtpCallback().
 
@@ -147,6 +166,9 @@
   For specific callbacks TxFreeCallback use dedicated unregister callbacks:
   respectively HAL_ETH_UnRegisterTxFreeCallback().
 
+  For specific callbacks TxFreeBurstCallback use dedicated unregister callbacks:
+  respectively HAL_ETH_UnRegisterTxFreeBurstCallback().
+
   For specific callbacks TxPtpCallback use dedicated unregister callbacks:
   respectively HAL_ETH_UnRegisterTxPtpCallback().
 
@@ -264,6 +286,9 @@ static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth);
 static void ETH_DMARxDescListInit(ETH_HandleTypeDef *heth);
 static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_TxPacketConfigTypeDef *pTxConfig,
                                            uint32_t ItMode);
+static void ETH_RequestTxCompleteIT(ETH_TxDescListTypeDef *dmatxdesclist);
+static uint32_t ETH_ReleaseTxDescriptors(ETH_HandleTypeDef *heth, uint32_t **pBuff);
+static uint8_t ETH_GetRxPacket(ETH_HandleTypeDef *heth);
 static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth);
 
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
@@ -1057,6 +1082,9 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
     /* Incr current tx desc for Ch index */
     INCR_TX_DESC_INDEX(heth->TxDescList[ch].CurTxDesc, 1U);
 
+    /* The packet ends the transmission: it raises the Tx complete interrupt */
+    ETH_RequestTxCompleteIT(&heth->TxDescList[ch]);
+
     /* Ensure completion of descriptor preparation before transmission start */
     __DSB();
 
@@ -1072,6 +1100,92 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
   }
 }
 
+/**
+  * @brief  Sends up to Count Ethernet packets in interrupt mode in one pass.
+  * @note   The packets are queued back to back in the Tx descriptor ring and the
+  *         Tx DMA is started once for the whole burst.
+  * @note   All the packets of the burst must use the same Tx DMA channel.
+  * @note   Queuing stops at the first packet that does not fit in the Tx descriptor
+  *         ring, pTxCount then holds the number of packets actually queued.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pTxConfig: Pointer to an array of Count packet configurations.
+  * @param  Count: Number of packets to transmit.
+  * @param  pTxCount: Pointer to the number of packets actually queued.
+  * @retval HAL status, HAL_ERROR if not all the packets could be queued
+  */
+HAL_StatusTypeDef HAL_ETH_TransmitBurst_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfigTypeDef *pTxConfig,
+                                           uint32_t Count, uint32_t *pTxCount)
+{
+  uint32_t ch;
+  uint32_t idx;
+  uint32_t txcount = 0U;
+  uint32_t txstatus = HAL_ETH_ERROR_NONE;
+
+  if ((pTxConfig == NULL) || (pTxCount == NULL) || (Count == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  ch = pTxConfig[0].TxDMACh;
+
+  for (idx = 1U; idx < Count; idx++)
+  {
+    /* All the packets of a burst go through the same Tx DMA channel */
+    if (pTxConfig[idx].TxDMACh != ch)
+    {
+      heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+      return HAL_ERROR;
+    }
+  }
+
+  while ((txcount < Count) && (txstatus == HAL_ETH_ERROR_NONE))
+  {
+    /* Save the packet pointer to release.  */
+    heth->TxDescList[ch].CurrentPacketAddress = (uint32_t *)pTxConfig[txcount].pData;
+
+    /* Config DMA Tx descriptor by Tx Packet info */
+    txstatus = ETH_Prepare_Tx_Descriptors(heth, &pTxConfig[txcount], 1U);
+
+    if (txstatus == HAL_ETH_ERROR_NONE)
+    {
+      /* Incr current tx desc index */
+      INCR_TX_DESC_INDEX(heth->TxDescList[ch].CurTxDesc, 1U);
+      txcount++;
+    }
+  }
+
+  if (txcount != 0U)
+  {
+    /* The last queued packet ends the burst: it raises the Tx complete interrupt */
+    ETH_RequestTxCompleteIT(&heth->TxDescList[ch]);
+
+    /* Ensure completion of descriptor preparation before transmission start */
+    __DSB();
+
+    /* Start transmission */
+    /* issue a poll command to Tx DMA by writing address of next immediate free descriptor */
+    WRITE_REG(heth->Instance->DMA_CH[ch].DMACTXDTPR,
+              (uint32_t)(heth->TxDescList[ch].TxDesc[heth->TxDescList[ch].CurTxDesc]));
+  }
+
+  *pTxCount = txcount;
+
+  if (txstatus != HAL_ETH_ERROR_NONE)
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_BUSY;
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Read a received packet.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1082,14 +1196,7 @@ HAL_StatusTypeDef HAL_ETH_Transmit_IT(ETH_HandleTypeDef *heth, ETH_TxPacketConfi
 HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
 {
   uint32_t ch = heth->RxOpCH;
-  uint32_t descidx;
-  uint32_t descidx_next;
-  ETH_DMADescTypeDef *dmarxdesc;
-  ETH_DMADescTypeDef *dmarxdesc_next;
-  uint32_t desccnt = 0U;
-  uint32_t desccntmax;
-  uint32_t bufflength;
-  uint8_t rxdataready = 0U;
+  uint8_t rxdataready;
 
   if (pAppBuff == NULL)
   {
@@ -1102,6 +1209,123 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
     return HAL_ERROR;
   }
 
+  /* Get the next received packet */
+  rxdataready = ETH_GetRxPacket(heth);
+
+  if ((heth->RxDescList[ch].RxBuildDescCnt) != 0U)
+  {
+    /* Update Descriptors */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  if (rxdataready == 1U)
+  {
+    /* Return received packet */
+    *pAppBuff = heth->RxDescList[ch].pRxStart;
+    /* Reset first element */
+    heth->RxDescList[ch].pRxStart = NULL;
+
+    return HAL_OK;
+  }
+
+  /* Packet not ready */
+  return HAL_ERROR;
+}
+
+/**
+  * @brief  Read up to Count received packets in one pass.
+  * @note   The Rx descriptors consumed by the whole burst are given back to
+  *         the DMA at the end, with a single update of the Rx tail pointer.
+  * @note   HAL_ETH_GetRxDataErrorCode() returns the error state of the last
+  *         packet of the burst.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pAppBuff: Pointer to an array of Count application buffer pointers
+  *         to receive the packets.
+  * @param  Count: Maximum number of packets to read.
+  * @param  pRxCount: Pointer to the number of packets actually read.
+  * @param  pTimeStamps: Pointer to an array of Count timestamps receiving the Rx timestamp of
+  *         each packet, as HAL_ETH_PTP_GetRxTimestamp() would return it after HAL_ETH_ReadData().
+  *         Can be NULL when the timestamps are not needed.
+  * @retval HAL status, HAL_ERROR if no packet is ready
+  */
+HAL_StatusTypeDef HAL_ETH_ReadDataBurst(ETH_HandleTypeDef *heth, void **pAppBuff, uint32_t Count,
+                                        uint32_t *pRxCount, ETH_TimeStampTypeDef *pTimeStamps)
+{
+  uint32_t ch = heth->RxOpCH;
+  uint32_t rxcount = 0U;
+  uint8_t rxdataready = 1U;
+
+  if ((pAppBuff == NULL) || (pRxCount == NULL) || (Count == 0U))
+  {
+    heth->ErrorCode |= HAL_ETH_ERROR_PARAM;
+    return HAL_ERROR;
+  }
+
+  if (heth->gState != HAL_ETH_STATE_STARTED)
+  {
+    return HAL_ERROR;
+  }
+
+  while ((rxcount < Count) && (rxdataready != 0U))
+  {
+    rxdataready = ETH_GetRxPacket(heth);
+
+    if (rxdataready != 0U)
+    {
+      /* Return received packet */
+      pAppBuff[rxcount] = heth->RxDescList[ch].pRxStart;
+      /* Reset first element */
+      heth->RxDescList[ch].pRxStart = NULL;
+
+      if (pTimeStamps != NULL)
+      {
+        /* Return the timestamp before the next packet overwrites it */
+        pTimeStamps[rxcount].TimeStampLow = heth->RxDescList[ch].TimeStamp.TimeStampLow;
+        pTimeStamps[rxcount].TimeStampHigh = heth->RxDescList[ch].TimeStamp.TimeStampHigh;
+      }
+      rxcount++;
+    }
+  }
+
+  if ((heth->RxDescList[ch].RxBuildDescCnt) != 0U)
+  {
+    /* Update Descriptors */
+    ETH_UpdateDescriptor(heth);
+  }
+
+  *pRxCount = rxcount;
+
+  if (rxcount == 0U)
+  {
+    /* Packet not ready */
+    return HAL_ERROR;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Walk the Rx descriptors owned by the application and link the
+  *         buffers of the next received packet.
+  * @note   The consumed descriptors are only accounted in RxBuildDescCnt,
+  *         they are given back to the DMA by ETH_UpdateDescriptor().
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval 1 if a complete packet is linked in pRxStart, 0 otherwise
+  */
+static uint8_t ETH_GetRxPacket(ETH_HandleTypeDef *heth)
+{
+  uint32_t ch = heth->RxOpCH;
+  uint32_t descidx;
+  uint32_t descidx_next;
+  ETH_DMADescTypeDef *dmarxdesc;
+  ETH_DMADescTypeDef *dmarxdesc_next;
+  uint32_t desccnt = 0U;
+  uint32_t desccntmax;
+  uint32_t bufflength;
+  uint8_t rxdataready = 0U;
+
   descidx = heth->RxDescList[ch].RxDescIdx;
   dmarxdesc = (ETH_DMADescTypeDef *)heth->RxDescList[ch].RxDesc[descidx];
   desccntmax = ETH_RX_DESC_CNT - heth->RxDescList[ch].RxBuildDescCnt;
@@ -1174,26 +1398,9 @@ HAL_StatusTypeDef HAL_ETH_ReadData(ETH_HandleTypeDef *heth, void **pAppBuff)
   }
 
   heth->RxDescList[ch].RxBuildDescCnt += desccnt;
-  if ((heth->RxDescList[ch].RxBuildDescCnt) != 0U)
-  {
-    /* Update Descriptors */
-    ETH_UpdateDescriptor(heth);
-  }
-
   heth->RxDescList[ch].RxDescIdx = descidx;
 
-  if (rxdataready == 1U)
-  {
-    /* Return received packet */
-    *pAppBuff = heth->RxDescList[ch].pRxStart;
-    /* Reset first element */
-    heth->RxDescList[ch].pRxStart = NULL;
-
-    return HAL_OK;
-  }
-
-  /* Packet not ready */
-  return HAL_ERROR;
+  return rxdataready;
 }
 
 /**
@@ -1249,8 +1456,10 @@ static void ETH_UpdateDescriptor(ETH_HandleTypeDef *heth)
 
     if (allocStatus != 0U)
     {
-
-      if (heth->RxDescList[ch].ItMode != 0U)
+      /* Only request the Rx complete interrupt on every Nth descriptor when coalescing is enabled,
+         the Rx interrupt watchdog raises it for the descriptors in between */
+      if ((heth->RxDescList[ch].ItMode != 0U) &&
+          ((heth->RxDescList[ch].ItCoalescing <= 1U) || (((descidx + 1U) % heth->RxDescList[ch].ItCoalescing) == 0U)))
       {
         WRITE_REG(dmarxdesc->DESC3, ETH_DMARXNDESCRF_OWN | ETH_DMARXNDESCRF_BUF1V | ETH_DMARXNDESCRF_IOC);
       }
@@ -1453,6 +1662,58 @@ __weak void HAL_ETH_TxFreeCallback(uint32_t *buff)
   */
 }
 
+/**
+  * @brief  Set the Tx free burst function.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  txFreeBurstCallback: pointer to function to release a burst of packets
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_RegisterTxFreeBurstCallback(ETH_HandleTypeDef *heth,
+                                                     pETH_txFreeBurstCallbackTypeDef txFreeBurstCallback)
+{
+  if (txFreeBurstCallback == NULL)
+  {
+    /* No callback to save */
+    return HAL_ERROR;
+  }
+
+  /* Set function to free a burst of transmitted packets */
+  heth->txFreeBurstCallback = txFreeBurstCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Unregister the Tx free burst callback.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_UnRegisterTxFreeBurstCallback(ETH_HandleTypeDef *heth)
+{
+  /* Set function to free a burst of transmitted packets */
+  heth->txFreeBurstCallback = HAL_ETH_TxFreeBurstCallback;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Tx Free Burst callback.
+  * @param  buff: pointer to an array of Count buffers to free, in transmission order
+  * @param  Count: number of buffers to free
+  * @retval None
+  */
+__weak void HAL_ETH_TxFreeBurstCallback(uint32_t **buff, uint32_t Count)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(buff);
+  UNUSED(Count);
+  /* NOTE : This function Should not be modified, when the callback is needed,
+  the HAL_ETH_TxFreeBurstCallback could be implemented in the user file
+  */
+}
+
 /**
   * @brief  Release transmitted Tx packets.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -1461,92 +1722,37 @@ __weak void HAL_ETH_TxFreeCallback(uint32_t *buff)
   */
 HAL_StatusTypeDef HAL_ETH_ReleaseTxPacket(ETH_HandleTypeDef *heth)
 {
-  uint32_t ch = heth->TxOpCH;
-  ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList[ch];
-  uint32_t numOfBuf =  dmatxdesclist->BuffersInUse;
-  uint32_t idx =       dmatxdesclist->releaseIndex;
-  uint8_t pktTxStatus = 1U;
-  uint8_t pktInUse;
-#ifdef HAL_ETH_USE_PTP
-  ETH_TimeStampTypeDef *timestamp = &heth->TxTimestamp;
-#endif /* HAL_ETH_USE_PTP */
-
-  /* Loop through buffers in use.  */
-  while ((numOfBuf != 0U) && (pktTxStatus != 0U))
-  {
-    pktInUse = 1U;
-    numOfBuf--;
-    /* If no packet, just examine the next packet.  */
-    if (dmatxdesclist->PacketAddress[idx] == NULL)
-    {
-      /* No packet in use, skip to next.  */
-      INCR_TX_DESC_INDEX(idx, 1U);
-      pktInUse = 0U;
-    }
+  (void)ETH_ReleaseTxDescriptors(heth, NULL);
 
-    if (pktInUse != 0U)
-    {
-      /* Determine if the packet has been transmitted.  */
-      if ((heth->Init.TxDesc[ch][idx].DESC3 & ETH_DMATXNDESCRF_OWN) == 0U)
-      {
-#ifdef HAL_ETH_USE_PTP
-        /* Disable Ptp transmission */
-        CLEAR_BIT(heth->Init.TxDesc[ch][idx].DESC2, ETH_DMATXNDESCRF_TTSE);
+  return HAL_OK;
+}
 
-        if ((heth->Init.TxDesc[ch][idx].DESC3 & ETH_DMATXNDESCWBF_LD)
-            && (heth->Init.TxDesc[ch][idx].DESC3 & ETH_DMATXNDESCWBF_TTSS))
-        {
-          /* Get timestamp low */
-          timestamp->TimeStampLow = heth->Init.TxDesc[ch][idx].DESC0;
-          /* Get timestamp high */
-          timestamp->TimeStampHigh = heth->Init.TxDesc[ch][idx].DESC1;
-        }
-        else
-        {
-          timestamp->TimeStampHigh = timestamp->TimeStampLow = UINT32_MAX;
-        }
+/**
+  * @brief  Release transmitted Tx packets with a single callback.
+  * @note   All the completed packets are handed in one call to
+  *         HAL_ETH_TxFreeBurstCallback(), in transmission order.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_ReleaseTxPacketBurst(ETH_HandleTypeDef *heth)
+{
+  uint32_t *txbuff[ETH_TX_DESC_CNT];
+  uint32_t txcount;
 
-#endif /* HAL_ETH_USE_PTP */
+  txcount = ETH_ReleaseTxDescriptors(heth, txbuff);
 
+  if (txcount != 0U)
+  {
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
-        /*Call registered callbacks*/
-#ifdef HAL_ETH_USE_PTP
-        /* Handle Ptp  */
-        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
-        {
-          heth->txPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
-        }
-#endif  /* HAL_ETH_USE_PTP */
-        /* Release the packet.  */
-        heth->txFreeCallback(dmatxdesclist->PacketAddress[idx]);
+    /*Call registered Tx free burst callback*/
+    heth->txFreeBurstCallback(txbuff, txcount);
 #else
-        /* Call callbacks */
-#ifdef HAL_ETH_USE_PTP
-        /* Handle Ptp  */
-        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
-        {
-          HAL_ETH_TxPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
-        }
-#endif  /* HAL_ETH_USE_PTP */
-        /* Release the packet.  */
-        HAL_ETH_TxFreeCallback(dmatxdesclist->PacketAddress[idx]);
+    /* Tx free burst callback */
+    HAL_ETH_TxFreeBurstCallback(txbuff, txcount);
 #endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
-
-        /* Clear the entry in the in-use array.  */
-        dmatxdesclist->PacketAddress[idx] = NULL;
-
-        /* Update the transmit relesae index and number of buffers in use.  */
-        INCR_TX_DESC_INDEX(idx, 1U);
-        dmatxdesclist->BuffersInUse = numOfBuf;
-        dmatxdesclist->releaseIndex = idx;
-      }
-      else
-      {
-        /* Get out of the loop!  */
-        pktTxStatus = 0U;
-      }
-    }
   }
+
   return HAL_OK;
 }
 
@@ -1915,6 +2121,153 @@ HAL_StatusTypeDef HAL_ETH_PTP_GetRxTimestamp(ETH_HandleTypeDef *heth, ETH_TimeSt
   }
 }
 
+/**
+  * @brief  Initialize a PTP clock servo.
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure holding the servo state
+  * @param  pConfig: pointer to a ETH_PTP_ServoConfigTypeDef structure that contains
+  *         the servo gains and thresholds
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ServoInit(ETH_PTP_ServoTypeDef *pServo, const ETH_PTP_ServoConfigTypeDef *pConfig)
+{
+  uint64_t maxaddend;
+
+  if ((pServo == NULL) || (pConfig == NULL))
+  {
+    return HAL_ERROR;
+  }
+
+  /* The fastest corrected frequency must still fit in the Addend register */
+  maxaddend = (uint64_t)pConfig->BaseAddend +
+              (((uint64_t)pConfig->BaseAddend * pConfig->MaxFreqAdj) / 1000000000U);
+
+  if ((pConfig->BaseAddend == 0U) || (pConfig->MaxFreqAdj >= 1000000000U) || (maxaddend > 0xFFFFFFFFU) ||
+      (pConfig->StepThreshold == 0U) || (pConfig->StepThreshold > 1000000000U))
+  {
+    return HAL_ERROR;
+  }
+
+  pServo->Init = *pConfig;
+  pServo->Integral = 0;
+  pServo->FreqAdj = 0;
+  pServo->Addend = pConfig->BaseAddend;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Run one iteration of the PTP clock servo.
+  * @note   This function only updates the servo state, it has no register access.
+  *         The PI output, in ppb, is Kp * Offset plus the integral of Ki * Offset,
+  *         both gains in Q16 fixed point, clamped to MaxFreqAdj.
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure holding the servo state
+  * @param  Offset: offset of the local clock from the master in ns, once the mean
+  *         path delay has been removed. Positive when the local clock is ahead.
+  * @retval Action to apply, a value of @ref ETH_PTP_Servo_Action
+  */
+uint32_t HAL_ETH_PTP_ServoCompute(ETH_PTP_ServoTypeDef *pServo, int64_t Offset)
+{
+  int64_t maxadj = (int64_t)pServo->Init.MaxFreqAdj;
+  int64_t ppb;
+
+  if ((Offset > (int64_t)pServo->Init.StepThreshold) || (Offset < -(int64_t)pServo->Init.StepThreshold))
+  {
+    /* Too far from the master: step the time and keep the current frequency correction */
+    return HAL_ETH_PTP_SERVO_STEP;
+  }
+
+  /* Integral term, clamped to the correction range to avoid windup */
+  pServo->Integral += (int64_t)pServo->Init.Ki * Offset;
+  if (pServo->Integral > (maxadj * 65536))
+  {
+    pServo->Integral = maxadj * 65536;
+  }
+  else if (pServo->Integral < -(maxadj * 65536))
+  {
+    pServo->Integral = -(maxadj * 65536);
+  }
+  else
+  {
+    /* Integral term within range */
+  }
+
+  ppb = (((int64_t)pServo->Init.Kp * Offset) + pServo->Integral) / 65536;
+  if (ppb > maxadj)
+  {
+    ppb = maxadj;
+  }
+  else if (ppb < -maxadj)
+  {
+    ppb = -maxadj;
+  }
+  else
+  {
+    /* Correction within range */
+  }
+
+  /* A local clock ahead of the master is slowed down */
+  pServo->FreqAdj = (int32_t)(-ppb);
+  pServo->Addend = (uint32_t)((int64_t)pServo->Init.BaseAddend +
+                              (((int64_t)pServo->Init.BaseAddend * pServo->FreqAdj) / 1000000000));
+
+  return HAL_ETH_PTP_SERVO_SLEW;
+}
+
+/**
+  * @brief  Discipline the PTP clock with a measured offset from the master.
+  * @note   Offsets above StepThreshold are removed with HAL_ETH_PTP_AddTimeOffset(),
+  *         smaller ones are slewed by writing the servo addend.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pServo: pointer to a ETH_PTP_ServoTypeDef structure holding the servo state
+  * @param  Offset: offset of the local clock from the master in ns, once the mean
+  *         path delay has been removed. Positive when the local clock is ahead.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_PTP_ServoUpdate(ETH_HandleTypeDef *heth, ETH_PTP_ServoTypeDef *pServo, int64_t Offset)
+{
+  ETH_TimeTypeDef timeoffset;
+  uint64_t absoffset;
+
+  if (pServo == NULL)
+  {
+    return HAL_ERROR;
+  }
+
+  if (heth->IsPtpConfigured != HAL_ETH_PTP_CONFIGURED)
+  {
+    return HAL_ERROR;
+  }
+
+  if (HAL_ETH_PTP_ServoCompute(pServo, Offset) == HAL_ETH_PTP_SERVO_STEP)
+  {
+    absoffset = (Offset < 0) ? (uint64_t)(-Offset) : (uint64_t)Offset;
+    timeoffset.Seconds = (uint32_t)(absoffset / 1000000000U);
+    timeoffset.NanoSeconds = (uint32_t)(absoffset % 1000000000U);
+
+    /* Move the local time back when it is ahead of the master */
+    (void)HAL_ETH_PTP_AddTimeOffset(heth, (Offset > 0) ? HAL_ETH_PTP_NEGATIVE_UPDATE : HAL_ETH_PTP_POSITIVE_UPDATE,
+                                    &timeoffset);
+
+    /* Wait for the time update to complete */
+    while ((heth->Instance->MACTSCR & ETH_MACTSCR_TSUPDT) != 0U)
+    {
+
+    }
+  }
+
+  /* Write the servo addend, the time offset update also altered the register */
+  WRITE_REG(heth->Instance->MACTSAR, pServo->Addend);
+
+  SET_BIT(heth->Instance->MACTSCR, ETH_MACTSCR_TSADDREG);
+  while ((heth->Instance->MACTSCR & ETH_MACTSCR_TSADDREG) != 0U)
+  {
+
+  }
+
+  return HAL_OK;
+}
+
 /**
   * @brief  Register the Tx Ptp callback.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -2593,6 +2946,76 @@ HAL_StatusTypeDef HAL_ETH_SetDMAConfig(ETH_HandleTypeDef *heth,  ETH_DMAConfigTy
   }
 }
 
+/**
+  * @brief  Get the interrupt coalescing configuration of a DMA channel.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  Channel: DMA channel index, from 0 to ETH_DMA_CH_CNT - 1
+  * @param  pItConfig: pointer to a ETH_ItCoalescingConfigTypeDef structure that will hold
+  *         the interrupt coalescing configuration of the channel.
+  * @retval HAL Status
+  */
+HAL_StatusTypeDef HAL_ETH_GetItCoalescingConfig(const ETH_HandleTypeDef *heth, uint32_t Channel,
+                                                ETH_ItCoalescingConfigTypeDef *pItConfig)
+{
+  if ((pItConfig == NULL) || (Channel >= ETH_DMA_CH_CNT))
+  {
+    return HAL_ERROR;
+  }
+
+  pItConfig->RxInterruptWatchdog = READ_BIT(heth->Instance->DMA_CH[Channel].DMACRXIWTR, ETH_DMACxRXIWTR_RWT);
+  pItConfig->RxInterruptCoalescing = heth->RxDescList[Channel].ItCoalescing;
+  pItConfig->TxInterruptCoalescing = heth->TxDescList[Channel].ItCoalescing;
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Set the interrupt coalescing configuration of a DMA channel.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  Channel: DMA channel index, from 0 to ETH_DMA_CH_CNT - 1
+  * @param  pItConfig: pointer to a ETH_ItCoalescingConfigTypeDef structure that contains
+  *         the interrupt coalescing configuration of the channel.
+  * @note   The Rx threshold applies to the descriptors given back to the DMA after this call.
+  * @note   The Tx threshold applies within a call to HAL_ETH_TransmitBurst_IT(): the last packet
+  *         queued by HAL_ETH_Transmit_IT() or HAL_ETH_TransmitBurst_IT() always raises the
+  *         Tx complete interrupt, so that its buffers are reclaimed without waiting for more traffic.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_ETH_SetItCoalescingConfig(ETH_HandleTypeDef *heth, uint32_t Channel,
+                                                const ETH_ItCoalescingConfigTypeDef *pItConfig)
+{
+  if ((pItConfig == NULL) || (Channel >= ETH_DMA_CH_CNT))
+  {
+    return HAL_ERROR;
+  }
+
+  /* Rx interrupt coalescing needs the Rx interrupt watchdog to bound the reception latency */
+  if ((pItConfig->RxInterruptCoalescing == 0U) || (pItConfig->RxInterruptCoalescing > ETH_RX_DESC_CNT) ||
+      (pItConfig->TxInterruptCoalescing == 0U) || (pItConfig->TxInterruptCoalescing > ETH_TX_DESC_CNT) ||
+      (pItConfig->RxInterruptWatchdog > 0xFFU) ||
+      ((pItConfig->RxInterruptCoalescing > 1U) && (pItConfig->RxInterruptWatchdog == 0U)))
+  {
+    return HAL_ERROR;
+  }
+
+  if ((heth->gState == HAL_ETH_STATE_READY) || (heth->gState == HAL_ETH_STATE_STARTED))
+  {
+    MODIFY_REG(heth->Instance->DMA_CH[Channel].DMACRXIWTR, ETH_DMACxRXIWTR_RWT, pItConfig->RxInterruptWatchdog);
+
+    /* Thresholds used when (re)building the descriptors */
+    heth->RxDescList[Channel].ItCoalescing = pItConfig->RxInterruptCoalescing;
+    heth->TxDescList[Channel].ItCoalescing = pItConfig->TxInterruptCoalescing;
+
+    return HAL_OK;
+  }
+  else
+  {
+    return HAL_ERROR;
+  }
+}
+
 /**
   * @brief  Configures the Clock range of ETH MDIO interface.
   * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
@@ -3220,6 +3643,14 @@ static void ETH_MACDMAConfig(ETH_HandleTypeDef *heth)
   }
   /* DMA default configuration */
   ETH_SetDMAConfig(heth, &dmaDefaultConf);
+
+  /* No interrupt coalescing: one Rx/Tx complete interrupt per descriptor or packet */
+  for (ch = 0; ch < ETH_DMA_CH_CNT; ch++)
+  {
+    CLEAR_BIT(heth->Instance->DMA_CH[ch].DMACRXIWTR, ETH_DMACxRXIWTR_RWT);
+    heth->RxDescList[ch].ItCoalescing = 1U;
+    heth->TxDescList[ch].ItCoalescing = 1U;
+  }
 }
 
 
@@ -3252,6 +3683,7 @@ static void ETH_DMATxDescListInit(ETH_HandleTypeDef *heth)
     }
 
     heth->TxDescList[ch].CurTxDesc = 0;
+    heth->TxDescList[ch].ItPacketCnt = 0U;
   }
 
   for (ch = 0; ch < ETH_DMA_CH_CNT; ch++)
@@ -3587,6 +4019,13 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
 
   if (ItMode != ((uint32_t)RESET))
   {
+    /* Count the packet towards the Tx interrupt coalescing threshold */
+    dmatxdesclist->ItPacketCnt++;
+  }
+
+  if ((ItMode != ((uint32_t)RESET)) && (dmatxdesclist->ItPacketCnt >= dmatxdesclist->ItCoalescing))
+  {
+    dmatxdesclist->ItPacketCnt = 0U;
     /* Set Interrupt on completion bit */
     SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_IOC);
   }
@@ -3616,6 +4055,141 @@ static uint32_t ETH_Prepare_Tx_Descriptors(ETH_HandleTypeDef *heth, const ETH_Tx
   return HAL_ETH_ERROR_NONE;
 }
 
+/**
+  * @brief  Request the Tx complete interrupt on the last packet queued in the Tx descriptor list.
+  * @note   Called before the Tx DMA tail pointer is moved past the packet, so that the last packet
+  *         of each transmission always raises the interrupt: Tx interrupt coalescing then only
+  *         groups the packets of a burst and never delays the reclaim of the last ones.
+  * @param  dmatxdesclist: pointer to the Tx descriptor list
+  * @retval None
+  */
+static void ETH_RequestTxCompleteIT(ETH_TxDescListTypeDef *dmatxdesclist)
+{
+  uint32_t descidx = ((dmatxdesclist->CurTxDesc + ETH_TX_DESC_CNT - 1U) % ETH_TX_DESC_CNT);
+  ETH_DMADescTypeDef *dmatxdesc = (ETH_DMADescTypeDef *)dmatxdesclist->TxDesc[descidx];
+
+  /* The interrupt is already requested when the packet reached the coalescing threshold */
+  if (dmatxdesclist->ItPacketCnt != 0U)
+  {
+    dmatxdesclist->ItPacketCnt = 0U;
+    /* Set Interrupt on completion bit */
+    SET_BIT(dmatxdesc->DESC2, ETH_DMATXNDESCRF_IOC);
+  }
+}
+
+/**
+  * @brief  Walk the Tx descriptors in use and release the transmitted packets.
+  * @param  heth: pointer to a ETH_HandleTypeDef structure that contains
+  *         the configuration information for ETHERNET module
+  * @param  pBuff: NULL to release each packet through the Tx free callback, otherwise
+  *         array of ETH_TX_DESC_CNT entries collecting the released packets
+  * @retval Number of released packets
+  */
+static uint32_t ETH_ReleaseTxDescriptors(ETH_HandleTypeDef *heth, uint32_t **pBuff)
+{
+  uint32_t ch = heth->TxOpCH;
+  ETH_TxDescListTypeDef *dmatxdesclist = &heth->TxDescList[ch];
+  uint32_t numOfBuf =  dmatxdesclist->BuffersInUse;
+  uint32_t idx =       dmatxdesclist->releaseIndex;
+  uint8_t pktTxStatus = 1U;
+  uint8_t pktInUse;
+  uint32_t pktcount = 0U;
+#ifdef HAL_ETH_USE_PTP
+  ETH_TimeStampTypeDef *timestamp = &heth->TxTimestamp;
+#endif /* HAL_ETH_USE_PTP */
+
+  /* Loop through buffers in use.  */
+  while ((numOfBuf != 0U) && (pktTxStatus != 0U))
+  {
+    pktInUse = 1U;
+    numOfBuf--;
+    /* If no packet, just examine the next packet.  */
+    if (dmatxdesclist->PacketAddress[idx] == NULL)
+    {
+      /* No packet in use, skip to next.  */
+      INCR_TX_DESC_INDEX(idx, 1U);
+      pktInUse = 0U;
+    }
+
+    if (pktInUse != 0U)
+    {
+      /* Determine if the packet has been transmitted.  */
+      if ((heth->Init.TxDesc[ch][idx].DESC3 & ETH_DMATXNDESCRF_OWN) == 0U)
+      {
+#ifdef HAL_ETH_USE_PTP
+        /* Disable Ptp transmission */
+        CLEAR_BIT(heth->Init.TxDesc[ch][idx].DESC2, ETH_DMATXNDESCRF_TTSE);
+
+        if ((heth->Init.TxDesc[ch][idx].DESC3 & ETH_DMATXNDESCWBF_LD)
+            && (heth->Init.TxDesc[ch][idx].DESC3 & ETH_DMATXNDESCWBF_TTSS))
+        {
+          /* Get timestamp low */
+          timestamp->TimeStampLow = heth->Init.TxDesc[ch][idx].DESC0;
+          /* Get timestamp high */
+          timestamp->TimeStampHigh = heth->Init.TxDesc[ch][idx].DESC1;
+        }
+        else
+        {
+          timestamp->TimeStampHigh = timestamp->TimeStampLow = UINT32_MAX;
+        }
+
+#endif /* HAL_ETH_USE_PTP */
+
+#if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
+        /*Call registered callbacks*/
+#ifdef HAL_ETH_USE_PTP
+        /* Handle Ptp  */
+        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
+        {
+          heth->txPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
+        }
+#endif  /* HAL_ETH_USE_PTP */
+        if (pBuff == NULL)
+        {
+          /* Release the packet.  */
+          heth->txFreeCallback(dmatxdesclist->PacketAddress[idx]);
+        }
+#else
+        /* Call callbacks */
+#ifdef HAL_ETH_USE_PTP
+        /* Handle Ptp  */
+        if (timestamp->TimeStampHigh != UINT32_MAX && timestamp->TimeStampLow != UINT32_MAX)
+        {
+          HAL_ETH_TxPtpCallback(dmatxdesclist->PacketAddress[idx], timestamp);
+        }
+#endif  /* HAL_ETH_USE_PTP */
+        if (pBuff == NULL)
+        {
+          /* Release the packet.  */
+          HAL_ETH_TxFreeCallback(dmatxdesclist->PacketAddress[idx]);
+        }
+#endif  /* USE_HAL_ETH_REGISTER_CALLBACKS */
+
+        if (pBuff != NULL)
+        {
+          /* Collect the packet, the whole burst is released at once */
+          pBuff[pktcount] = dmatxdesclist->PacketAddress[idx];
+        }
+        pktcount++;
+
+        /* Clear the entry in the in-use array.  */
+        dmatxdesclist->PacketAddress[idx] = NULL;
+
+        /* Update the transmit relesae index and number of buffers in use.  */
+        INCR_TX_DESC_INDEX(idx, 1U);
+        dmatxdesclist->BuffersInUse = numOfBuf;
+        dmatxdesclist->releaseIndex = idx;
+      }
+      else
+      {
+        /* Get out of the loop!  */
+        pktTxStatus = 0U;
+      }
+    }
+  }
+  return pktcount;
+}
+
 #if (USE_HAL_ETH_REGISTER_CALLBACKS == 1)
 static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth)
 {
@@ -3628,6 +4202,7 @@ static void ETH_InitCallbacksToDefault(ETH_HandleTypeDef *heth)
   heth->WakeUpCallback   = HAL_ETH_WakeUpCallback;    /* Legacy weak WakeUpCallback   */
   heth->rxLinkCallback   = HAL_ETH_RxLinkCallback;    /* Legacy weak RxLinkCallback   */
   heth->txFreeCallback   = HAL_ETH_TxFreeCallback;    /* Legacy weak TxFreeCallback   */
+  heth->txFreeBurstCallback = HAL_ETH_TxFreeBurstCallback; /* Legacy weak TxFreeBurstCallback */
 #ifdef HAL_ETH_USE_PTP
   heth->txPtpCallback    = HAL_ETH_TxPtpCallback;     /* Legacy weak TxPtpCallback   */
 #endif /* HAL_ETH_USE_PTP */
@@ -149,6 +149,7 @@ The real value may vary depending on the variations in voltage and temperature.*
 #define  VDD_VALUE                    3300U                            /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY            ((1U<<__NVIC_PRIO_BITS) - 1U)    /*!< tick interrupt priority */
 #define  USE_RTOS                     0U
+#define  USE_HAL_ATOMIC_LOCK          0U
 #define  PREFETCH_ENABLE              0U
 #define  INSTRUCTION_CACHE_ENABLE     1U
 
@@ -181,7 +181,24 @@ typedef struct __DMA_QListTypeDef
 
   __IO uint32_t                  Type;               /*!< Specifies whether the queue is static or dynamic */
 
+  DMA_NodeTypeDef                *Tail;              /*!< Specifies the queue tail node (NULL if unknown) */
+
 } DMA_QListTypeDef;
+
+/**
+  * @brief DMAEx Linked-List Node Pool Structure Definition.
+  */
+typedef struct
+{
+  DMA_NodeTypeDef                *pNodes;            /*!< Specifies the pool node array                    */
+
+  uint32_t                       NodeNumber;         /*!< Specifies the pool node number                   */
+
+  DMA_NodeTypeDef                *pFreeNode;         /*!< Specifies the first free pool node               */
+
+  uint32_t                       FreeNodeNumber;     /*!< Specifies the free pool node number              */
+
+} DMA_NodePoolTypeDef;
 /**
   * @}
   */
@@ -523,6 +540,14 @@ HAL_StatusTypeDef HAL_DMAEx_List_ConvertQToStatic(DMA_QListTypeDef *const pQList
 HAL_StatusTypeDef HAL_DMAEx_List_LinkQ(DMA_HandleTypeDef *const hdma,
                                        DMA_QListTypeDef *const pQList);
 HAL_StatusTypeDef HAL_DMAEx_List_UnLinkQ(DMA_HandleTypeDef *const hdma);
+
+HAL_StatusTypeDef HAL_DMAEx_List_InitNodePool(DMA_NodePoolTypeDef *const pPool,
+                                              DMA_NodeTypeDef *const pNodes,
+                                              uint32_t NodeNumber);
+HAL_StatusTypeDef HAL_DMAEx_List_AllocNode(DMA_NodePoolTypeDef *const pPool,
+                                           DMA_NodeTypeDef **const ppNode);
+HAL_StatusTypeDef HAL_DMAEx_List_FreeNode(DMA_NodePoolTypeDef *const pPool,
+                                          DMA_NodeTypeDef *const pNode);
 /**
   * @}
   */
@@ -55,6 +55,44 @@ extern "C" {
 /* ----------------- Linked Aliases ------------------------------------------*/
 #define HAL_SDEx_DMALinkedList_WriteCpltCallback HAL_SD_TxCpltCallback
 #define HAL_SDEx_DMALinkedList_ReadCpltCallback  HAL_SD_RxCpltCallback
+/**
+  * @}
+  */
+/** @defgroup SDEx_Exported_Types_Group2 SD Card block cache structures
+  * @{
+  */
+typedef struct
+{
+  uint32_t BlockAdd;           /*!< First card block held by the line, multiple of LineBlocks       */
+  uint32_t Valid;              /*!< Bit n set when block n of the line holds up to date data         */
+  uint32_t Dirty;              /*!< Bit n set when block n of the line must be written to the card   */
+  uint32_t LastUse;            /*!< Access stamp used for the least recently used replacement        */
+} SD_CacheLineTypeDef;
+
+typedef struct
+{
+  SD_HandleTypeDef    *hsd;        /*!< SD handle the cache sits on, set before HAL_SDEx_CacheInit()     */
+
+  uint8_t             *pBuffer;    /*!< Line storage of NbLines * LineBlocks * BLOCKSIZE bytes.
+                                        Must be accessible by the SDMMC IDMA and 32-byte aligned           */
+
+  SD_CacheLineTypeDef *pLines;     /*!< Array of NbLines line descriptors                                */
+
+  uint32_t            NbLines;     /*!< Number of cache lines                                            */
+
+  uint32_t            LineBlocks;  /*!< Number of blocks per line, between 1 and 32. Requests of at least
+                                        LineBlocks blocks bypass the cache                                 */
+
+  uint32_t            Timeout;     /*!< Timeout in ms of each card transfer issued by the cache          */
+
+  uint32_t            Stamp;       /*!< Running access stamp                                             */
+
+  uint32_t            Hits;        /*!< Number of line accesses served from the cache                    */
+
+  uint32_t            Misses;      /*!< Number of line accesses that required a card read                */
+
+  uint32_t            WriteBacks;  /*!< Number of multiple block writes issued to flush dirty lines      */
+} SD_CacheTypeDef;
 /**
   * @}
   */
@@ -87,6 +125,20 @@ void HAL_SDEx_Read_DMALnkLstBufCpltCallback(SD_HandleTypeDef *hsd);
 void HAL_SDEx_Write_DMALnkLstBufCpltCallback(SD_HandleTypeDef *hsd);
 
 
+/**
+  * @}
+  */
+
+/** @defgroup SDEx_Exported_Functions_Group2 Block cache functions
+  * @{
+  */
+HAL_StatusTypeDef HAL_SDEx_CacheInit(SD_CacheTypeDef *pCache);
+HAL_StatusTypeDef HAL_SDEx_CacheReadBlocks(SD_CacheTypeDef *pCache, uint8_t *pData, uint32_t BlockAdd,
+                                           uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_SDEx_CacheWriteBlocks(SD_CacheTypeDef *pCache, const uint8_t *pData, uint32_t BlockAdd,
+                                            uint32_t NumberOfBlocks);
+HAL_StatusTypeDef HAL_SDEx_CacheFlush(SD_CacheTypeDef *pCache);
+
 /**
   * @}
   */
@@ -31,6 +31,7 @@
       (#) If needed , configure the reception filters and optional features using
           the following configuration functions:
             (++) HAL_FDCAN_ConfigFilter
+            (++) HAL_FDCAN_ConfigSoftwareFilter
             (++) HAL_FDCAN_ConfigGlobalFilter
             (++) HAL_FDCAN_ConfigExtendedIdMask
             (++) HAL_FDCAN_ConfigRxFifoOverwrite
@@ -55,6 +56,7 @@
       (#) The following Tx control functions can only be called when the FDCAN
           module is started:
             (++) HAL_FDCAN_AddMessageToTxFifoQ
+            (++) HAL_FDCAN_AddMessagesToTxFifoQ
             (++) HAL_FDCAN_AbortTxRequest
 
       (#) After having submitted a Tx request in Tx Fifo or Queue, it is possible to
@@ -107,6 +109,7 @@
     (+) TimestampWraparoundCallback  : Timestamp Wraparound Callback.
     (+) TimeoutOccurredCallback      : Timeout Occurred Callback.
     (+) ErrorCallback                : Error Callback.
+    (+) TxBatchCompleteCallback      : Tx Batch Complete Callback.
     (+) MspInitCallback              : FDCAN MspInit.
     (+) MspDeInitCallback            : FDCAN MspDeInit.
   This function takes as parameters the HAL peripheral handle, the Callback ID
@@ -129,6 +132,7 @@
     (+) TimestampWraparoundCallback  : Timestamp Wraparound Callback.
     (+) TimeoutOccurredCallback      : Timeout Occurred Callback.
     (+) ErrorCallback                : Error Callback.
+    (+) TxBatchCompleteCallback      : Tx Batch Complete Callback.
     (+) MspInitCallback              : FDCAN MspInit.
     (+) MspDeInitCallback            : FDCAN MspDeInit.
 
@@ -208,6 +212,13 @@
 #define FDCAN_ELEMENT_MASK_ANMF  ((uint32_t)0x80000000U) /* Accepted Non-matching Frame */
 #define FDCAN_ELEMENT_MASK_ET    ((uint32_t)0x00C00000U) /* Event type                  */
 
+#define FDCAN_SW_FILTER_FREE_KEY  ((uint32_t)0xFFFFFFFFU) /* Unused software filter hash table entry */
+#define FDCAN_SW_FILTER_EXT_MASKS (8U)                    /* Size of FDCAN_SwFilterTypeDef.ExtMasks */
+#define FDCAN_SW_FILTER_STD_SET(FILTER, ID) \
+  ((FILTER)->StdBitmap[(ID) >> 5U] |= ((uint32_t)1 << ((ID) & 0x1FU)))
+#define FDCAN_SW_FILTER_HASH(KEY, GROUP, SHIFT) \
+  ((((KEY) ^ ((GROUP) << 29U)) * 0x9E3779B1U) >> (SHIFT))
+
 #define SRAMCAN_FLS_NBR                  (28U)         /* Max. Filter List Standard Number      */
 #define SRAMCAN_FLE_NBR                  ( 8U)         /* Max. Filter List Extended Number      */
 #define SRAMCAN_RF0_NBR                  ( 3U)         /* RX FIFO 0 Elements Number             */
@@ -255,6 +266,18 @@ static const uint8_t DLCtoBytes[] = {0, 1, 2, 3, 4, 5, 6, 7, 8, 12, 16, 20, 24,
 static void FDCAN_CalcultateRamBlockAddresses(FDCAN_HandleTypeDef *hfdcan);
 static void FDCAN_CopyMessageToRAM(const FDCAN_HandleTypeDef *hfdcan, const FDCAN_TxHeaderTypeDef *pTxHeader,
                                    const uint8_t *pTxData, uint32_t BufferIndex);
+static HAL_StatusTypeDef FDCAN_GetRxElementAddress(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                                                   uint32_t **pRxAddress, uint32_t *pGetIndex);
+static void FDCAN_GetRxHeader(const uint32_t *RxAddress, FDCAN_RxHeaderTypeDef *pRxHeader);
+static void FDCAN_CopyMessageFromRAM(const uint32_t *RxAddress, uint8_t *pRxData, uint32_t DataLength);
+static void FDCAN_AcknowledgeRxElement(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t GetIndex);
+static void FDCAN_CheckTxBatchComplete(FDCAN_HandleTypeDef *hfdcan);
+static HAL_StatusTypeDef FDCAN_AddSoftwareFilterRule(FDCAN_HandleTypeDef *hfdcan,
+                                                     const FDCAN_FilterTypeDef *sFilterConfig);
+static HAL_StatusTypeDef FDCAN_AddSoftwareFilterKey(FDCAN_SwFilterTypeDef *pSwFilter, uint32_t Identifier,
+                                                    uint32_t Mask);
+static uint32_t FDCAN_IsRxMessageFiltered(const FDCAN_HandleTypeDef *hfdcan,
+                                          const FDCAN_RxHeaderTypeDef *pRxHeader);
 /**
   * @}
   */
@@ -336,6 +359,7 @@ HAL_StatusTypeDef HAL_FDCAN_Init(FDCAN_HandleTypeDef *hfdcan)
     hfdcan->TxFifoEmptyCallback         = HAL_FDCAN_TxFifoEmptyCallback;         /* TxFifoEmptyCallback */
     hfdcan->TxBufferCompleteCallback    = HAL_FDCAN_TxBufferCompleteCallback;    /* TxBufferCompleteCallback        */
     hfdcan->TxBufferAbortCallback       = HAL_FDCAN_TxBufferAbortCallback;       /* TxBufferAbortCallback           */
+    hfdcan->TxBatchCompleteCallback     = HAL_FDCAN_TxBatchCompleteCallback;     /* TxBatchCompleteCallback         */
     hfdcan->HighPriorityMessageCallback = HAL_FDCAN_HighPriorityMessageCallback; /* HighPriorityMessageCallback     */
     hfdcan->TimestampWraparoundCallback = HAL_FDCAN_TimestampWraparoundCallback; /* TimestampWraparoundCallback     */
     hfdcan->TimeoutOccurredCallback     = HAL_FDCAN_TimeoutOccurredCallback;     /* TimeoutOccurredCallback         */
@@ -510,6 +534,12 @@ HAL_StatusTypeDef HAL_FDCAN_Init(FDCAN_HandleTypeDef *hfdcan)
   /* Initialize the Latest Tx request buffer index */
   hfdcan->LatestTxFifoQRequest = 0U;
 
+  /* No pending Tx batch */
+  hfdcan->TxBatchPending = 0U;
+
+  /* Detach the software filter */
+  hfdcan->pSwFilter = NULL;
+
   /* Initialize the error code */
   hfdcan->ErrorCode = HAL_FDCAN_ERROR_NONE;
 
@@ -682,6 +712,7 @@ HAL_StatusTypeDef HAL_FDCAN_ExitPowerDownMode(FDCAN_HandleTypeDef *hfdcan)
   *           @arg @ref HAL_FDCAN_TIMESTAMP_WRAPAROUND_CB_ID Timestamp wraparound callback ID
   *           @arg @ref HAL_FDCAN_TIMEOUT_OCCURRED_CB_ID Timeout occurred callback ID
   *           @arg @ref HAL_FDCAN_ERROR_CALLBACK_CB_ID Error callback ID
+  *           @arg @ref HAL_FDCAN_TX_BATCH_COMPLETE_CB_ID Tx batch complete callback ID
   *           @arg @ref HAL_FDCAN_MSPINIT_CB_ID MspInit callback ID
   *           @arg @ref HAL_FDCAN_MSPDEINIT_CB_ID MspDeInit callback ID
   * @param  pCallback pointer to the Callback function
@@ -724,6 +755,10 @@ HAL_StatusTypeDef HAL_FDCAN_RegisterCallback(FDCAN_HandleTypeDef *hfdcan, HAL_FD
         hfdcan->ErrorCallback = pCallback;
         break;
 
+      case HAL_FDCAN_TX_BATCH_COMPLETE_CB_ID :
+        hfdcan->TxBatchCompleteCallback = pCallback;
+        break;
+
       case HAL_FDCAN_MSPINIT_CB_ID :
         hfdcan->MspInitCallback = pCallback;
         break;
@@ -786,6 +821,7 @@ HAL_StatusTypeDef HAL_FDCAN_RegisterCallback(FDCAN_HandleTypeDef *hfdcan, HAL_FD
   *           @arg @ref HAL_FDCAN_TIMESTAMP_WRAPAROUND_CB_ID Timestamp wraparound callback ID
   *           @arg @ref HAL_FDCAN_TIMEOUT_OCCURRED_CB_ID Timeout occurred callback ID
   *           @arg @ref HAL_FDCAN_ERROR_CALLBACK_CB_ID Error callback ID
+  *           @arg @ref HAL_FDCAN_TX_BATCH_COMPLETE_CB_ID Tx batch complete callback ID
   *           @arg @ref HAL_FDCAN_MSPINIT_CB_ID MspInit callback ID
   *           @arg @ref HAL_FDCAN_MSPDEINIT_CB_ID MspDeInit callback ID
   * @retval HAL status
@@ -818,6 +854,10 @@ HAL_StatusTypeDef HAL_FDCAN_UnRegisterCallback(FDCAN_HandleTypeDef *hfdcan, HAL_
         hfdcan->ErrorCallback = HAL_FDCAN_ErrorCallback;
         break;
 
+      case HAL_FDCAN_TX_BATCH_COMPLETE_CB_ID :
+        hfdcan->TxBatchCompleteCallback = HAL_FDCAN_TxBatchCompleteCallback;
+        break;
+
       case HAL_FDCAN_MSPINIT_CB_ID :
         hfdcan->MspInitCallback = HAL_FDCAN_MspInit;
         break;
@@ -1251,6 +1291,9 @@ HAL_StatusTypeDef HAL_FDCAN_UnRegisterErrorStatusCallback(FDCAN_HandleTypeDef *h
   ==============================================================================
     [..]  This section provides functions allowing to:
       (+) HAL_FDCAN_ConfigFilter                  : Configure the FDCAN reception filters
+      (+) HAL_FDCAN_ConfigSoftwareFilter          : Configure the software filter used beyond the
+                                                    hardware filter list
+      (+) HAL_FDCAN_IsSoftwareFilterMatching      : Check an identifier against the software filter
       (+) HAL_FDCAN_ConfigGlobalFilter            : Configure the FDCAN global filter
       (+) HAL_FDCAN_ConfigExtendedIdMask          : Configure the extended ID mask
       (+) HAL_FDCAN_ConfigRxFifoOverwrite         : Configure the Rx FIFO operation mode
@@ -1295,6 +1338,14 @@ HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef *hfdcan, const FDCA
 
   if ((state == HAL_FDCAN_STATE_READY) || (state == HAL_FDCAN_STATE_BUSY))
   {
+    /* Rules beyond the hardware filter list are compiled into the software filter */
+    if ((hfdcan->pSwFilter != NULL) &&
+        (((sFilterConfig->IdType == FDCAN_STANDARD_ID) && (sFilterConfig->FilterIndex >= hfdcan->Init.StdFiltersNbr)) ||
+         ((sFilterConfig->IdType == FDCAN_EXTENDED_ID) && (sFilterConfig->FilterIndex >= hfdcan->Init.ExtFiltersNbr))))
+    {
+      return FDCAN_AddSoftwareFilterRule(hfdcan, sFilterConfig);
+    }
+
     /* Check function parameters */
     assert_param(IS_FDCAN_ID_TYPE(sFilterConfig->IdType));
     assert_param(IS_FDCAN_FILTER_CFG(sFilterConfig->FilterConfig));
@@ -1354,6 +1405,160 @@ HAL_StatusTypeDef HAL_FDCAN_ConfigFilter(FDCAN_HandleTypeDef *hfdcan, const FDCA
   }
 }
 
+/**
+  * @brief  Configure the software filter extending the FDCAN reception filters.
+  * @note   Once configured, HAL_FDCAN_ConfigFilter compiles the rules whose
+  *         FilterIndex is beyond the hardware filter list (StdFiltersNbr or
+  *         ExtFiltersNbr) into the software filter: standard identifier rules
+  *         into a 2048-bit bitmap, extended identifier mask and dual rules into
+  *         a hash table with one group per distinct mask (up to 8 masks).
+  *         Range rules are not supported for extended identifiers.
+  * @note   The frames must reach an Rx FIFO through the global filter, so
+  *         HAL_FDCAN_ConfigGlobalFilter must be called before adding rules:
+  *         a rule is rejected unless it stores the frame into the Rx FIFO
+  *         receiving the non-matching frames of its identifier type, and the
+  *         high priority rules are rejected. HAL_FDCAN_GetRxMessage and
+  *         HAL_FDCAN_GetRxMessages then discard the non-matching frames which
+  *         are rejected by the software filter.
+  * @note   HAL_FDCAN_Init detaches the software filter, so this function must
+  *         be called after it.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pSwFilter pointer to an FDCAN_SwFilterTypeDef structure that stays
+  *         in use until detached, or NULL to detach the software filter.
+  * @param  pExtTable pointer to the hash table of the extended identifier rules.
+  * @param  ExtTableSize number of entries of pExtTable. This parameter must be 0
+  *         or a power of 2 greater than the number of extended identifier keys;
+  *         about twice that number keeps lookups short.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_ConfigSoftwareFilter(FDCAN_HandleTypeDef *hfdcan, FDCAN_SwFilterTypeDef *pSwFilter,
+                                                 FDCAN_SwFilterEntryTypeDef *pExtTable, uint32_t ExtTableSize)
+{
+  uint32_t Index;
+  HAL_FDCAN_StateTypeDef state = hfdcan->State;
+
+  if ((state == HAL_FDCAN_STATE_READY) || (state == HAL_FDCAN_STATE_BUSY))
+  {
+    if (pSwFilter == NULL)
+    {
+      /* Detach the software filter */
+      hfdcan->pSwFilter = NULL;
+
+      return HAL_OK;
+    }
+
+    /* Check that the hash table size is 0 or a power of 2 */
+    if ((ExtTableSize == 1U) || ((ExtTableSize & (ExtTableSize - 1U)) != 0U) ||
+        ((ExtTableSize != 0U) && (pExtTable == NULL)))
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    /* Clear all the rules */
+    for (Index = 0U; Index < 64U; Index++)
+    {
+      pSwFilter->StdBitmap[Index] = 0U;
+    }
+    for (Index = 0U; Index < ExtTableSize; Index++)
+    {
+      pExtTable[Index].Key = FDCAN_SW_FILTER_FREE_KEY;
+      pExtTable[Index].Group = 0U;
+    }
+    pSwFilter->ExtMasksNbr = 0U;
+    pSwFilter->ExtRulesNbr = 0U;
+    pSwFilter->pExtTable = pExtTable;
+    pSwFilter->ExtTableSize = ExtTableSize;
+
+    /* The hash keeps the log2(ExtTableSize) upper bits of the product */
+    pSwFilter->ExtTableShift = 32U;
+    for (Index = ExtTableSize; Index > 1U; Index >>= 1U)
+    {
+      pSwFilter->ExtTableShift--;
+    }
+
+    /* Attach the software filter */
+    hfdcan->pSwFilter = pSwFilter;
+
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_INITIALIZED;
+
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Check whether an identifier is accepted by the software filter.
+  * @note   The lookup costs one bitmap test for a standard identifier, and one
+  *         hash probe per distinct mask for an extended identifier. As for the
+  *         hardware filters, an extended identifier is first ANDed with the
+  *         mask set by HAL_FDCAN_ConfigExtendedIdMask.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  IdType identifier type.
+  *         This parameter can be a value of @ref FDCAN_id_type.
+  * @param  Identifier identifier to check.
+  * @retval Match status
+  *          - 0 : the identifier does not match any software filter rule, or no
+  *                software filter is configured
+  *          - 1 : the identifier matches a software filter rule
+  */
+uint32_t HAL_FDCAN_IsSoftwareFilterMatching(const FDCAN_HandleTypeDef *hfdcan, uint32_t IdType,
+                                            uint32_t Identifier)
+{
+  const FDCAN_SwFilterTypeDef *pSwFilter = hfdcan->pSwFilter;
+  const FDCAN_SwFilterEntryTypeDef *pEntry;
+  uint32_t Group;
+  uint32_t Key;
+  uint32_t Index;
+  uint32_t Match = 0U;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_ID_TYPE(IdType));
+
+  if (pSwFilter != NULL)
+  {
+    if (IdType == FDCAN_STANDARD_ID)
+    {
+      Match = ((pSwFilter->StdBitmap[(Identifier >> 5U) & 0x3FU] >> (Identifier & 0x1FU)) & 1U);
+    }
+    else /* IdType == FDCAN_EXTENDED_ID */
+    {
+      /* Probe the hash table once per distinct rule mask */
+      for (Group = 0U; (Group < pSwFilter->ExtMasksNbr) && (Match == 0U); Group++)
+      {
+        Key = (Identifier & hfdcan->Instance->XIDAM & pSwFilter->ExtMasks[Group]);
+        Index = FDCAN_SW_FILTER_HASH(Key, Group, pSwFilter->ExtTableShift);
+        pEntry = &pSwFilter->pExtTable[Index];
+
+        while ((Match == 0U) && (pEntry->Key != FDCAN_SW_FILTER_FREE_KEY))
+        {
+          if ((pEntry->Key == Key) && (pEntry->Group == Group))
+          {
+            Match = 1U;
+          }
+          else
+          {
+            Index = ((Index + 1U) & (pSwFilter->ExtTableSize - 1U));
+            pEntry = &pSwFilter->pExtTable[Index];
+          }
+        }
+      }
+    }
+  }
+
+  /* Return match status */
+  return Match;
+}
+
 /**
   * @brief  Configure the FDCAN global filter.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -1959,9 +2164,16 @@ HAL_StatusTypeDef HAL_FDCAN_DisableEdgeFiltering(FDCAN_HandleTypeDef *hfdcan)
       (+) HAL_FDCAN_Stop                          : Stop the FDCAN module and enable access to configuration registers
       (+) HAL_FDCAN_AddMessageToTxFifoQ           : Add a message to the Tx FIFO/Queue and activate the corresponding
                                                     transmission request
+      (+) HAL_FDCAN_AddMessagesToTxFifoQ          : Add several messages to the Tx FIFO/Queue and activate all the
+                                                    corresponding transmission requests at once
       (+) HAL_FDCAN_GetLatestTxFifoQRequestBuffer : Get Tx buffer index of latest Tx FIFO/Queue request
       (+) HAL_FDCAN_AbortTxRequest                : Abort transmission request
       (+) HAL_FDCAN_GetRxMessage                  : Get an FDCAN frame from the Rx FIFO zone into the message RAM
+      (+) HAL_FDCAN_PeekRxMessage                 : Get an FDCAN frame header and the address of its payload
+                                                    in the message RAM
+      (+) HAL_FDCAN_ReleaseRxMessage              : Release an FDCAN frame obtained by HAL_FDCAN_PeekRxMessage
+      (+) HAL_FDCAN_GetRxMessages                 : Get several FDCAN frames from an Rx FIFO zone with a single
+                                                    acknowledge
       (+) HAL_FDCAN_GetTxEvent                    : Get an FDCAN Tx event from the Tx Event FIFO zone
                                                     into the message RAM
       (+) HAL_FDCAN_GetHighPriorityMessageStatus  : Get high priority message status
@@ -2071,6 +2283,9 @@ HAL_StatusTypeDef HAL_FDCAN_Stop(FDCAN_HandleTypeDef *hfdcan)
     /* Reset Latest Tx FIFO/Queue Request Buffer Index */
     hfdcan->LatestTxFifoQRequest = 0U;
 
+    /* Forget the pending Tx batches */
+    hfdcan->TxBatchPending = 0U;
+
     /* Change FDCAN peripheral state */
     hfdcan->State = HAL_FDCAN_STATE_READY;
 
@@ -2154,6 +2369,161 @@ HAL_StatusTypeDef HAL_FDCAN_AddMessageToTxFifoQ(FDCAN_HandleTypeDef *hfdcan, con
   }
 }
 
+/**
+  * @brief  Add several messages to the Tx FIFO/Queue and activate all the
+  *         corresponding transmission requests with a single register write.
+  * @note   The batch is either fully accepted or rejected: when the Tx FIFO/Queue
+  *         does not have Count free elements, nothing is written and the function
+  *         returns HAL_ERROR with HAL_FDCAN_ERROR_FIFO_FULL.
+  * @note   In Tx FIFO mode the messages are sent in array order.
+  * @note   HAL_FDCAN_TxBatchCompleteCallback is called once all the messages of the
+  *         pending batches are transmitted or cancelled. This requires FDCAN_IT_TX_COMPLETE
+  *         (and FDCAN_IT_TX_ABORT_COMPLETE for cancellations) to be activated on all the
+  *         Tx FIFO/Queue buffers.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pTxMessages pointer to an array of Count FDCAN_TxMessageTypeDef structures.
+  * @param  Count number of messages to add.
+  * @param  pBufferIndexes pointer to the Tx buffers used by the batch:
+  *         bit n is set when Tx buffer n holds one of the messages.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_AddMessagesToTxFifoQ(FDCAN_HandleTypeDef *hfdcan,
+                                                 const FDCAN_TxMessageTypeDef *pTxMessages, uint32_t Count,
+                                                 uint32_t *pBufferIndexes)
+{
+  const FDCAN_TxHeaderTypeDef *pTxHeader;
+  uint32_t TxBufferConfig;
+  uint32_t TxFifoQStatus;
+  uint32_t TxPending = 0U;
+  uint32_t FifoStart;
+  uint32_t FifoEnd;
+  uint32_t FreeLevel;
+  uint32_t PutIndex;
+  uint32_t LastIndex = 0U;
+  uint32_t BufferIndexes = 0U;
+  uint32_t TxIndex;
+  uint32_t primask_bit;
+
+  if (hfdcan->State == HAL_FDCAN_STATE_BUSY)
+  {
+    /* Check that there is at least one message to add and where to report the buffers used */
+    if ((pTxMessages == NULL) || (Count == 0U) || (pBufferIndexes == NULL))
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+      return HAL_ERROR;
+    }
+
+    TxBufferConfig = hfdcan->Instance->TXBC;
+
+    FifoStart = 0U;
+    FifoEnd = SRAMCAN_TFQ_NBR;
+
+    /* Read the Tx FIFO/Queue status once */
+    TxFifoQStatus = hfdcan->Instance->TXFQS;
+    PutIndex = ((TxFifoQStatus & FDCAN_TXFQS_TFQPI) >> FDCAN_TXFQS_TFQPI_Pos);
+
+    if ((TxBufferConfig & FDCAN_TXBC_TFQM) == 0U)
+    {
+      /* Tx FIFO: the free elements are the consecutive ones starting at the put index */
+      FreeLevel = ((TxFifoQStatus & FDCAN_TXFQS_TFFL) >> FDCAN_TXFQS_TFFL_Pos);
+    }
+    else
+    {
+      /* Tx Queue: any element without pending transmission request is free */
+      TxPending = hfdcan->Instance->TXBRP;
+      FreeLevel = 0U;
+      for (TxIndex = FifoStart; TxIndex < FifoEnd; TxIndex++)
+      {
+        if ((TxPending & ((uint32_t)1 << TxIndex)) == 0U)
+        {
+          FreeLevel++;
+        }
+      }
+    }
+
+    /* Check that the Tx FIFO/Queue can hold the whole batch */
+    if (Count > FreeLevel)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_FULL;
+
+      return HAL_ERROR;
+    }
+
+    for (TxIndex = 0U; TxIndex < Count; TxIndex++)
+    {
+      pTxHeader = &pTxMessages[TxIndex].Header;
+
+      /* Check message parameters */
+      assert_param(IS_FDCAN_ID_TYPE(pTxHeader->IdType));
+      if (pTxHeader->IdType == FDCAN_STANDARD_ID)
+      {
+        assert_param(IS_FDCAN_MAX_VALUE(pTxHeader->Identifier, 0x7FFU));
+      }
+      else /* pTxHeader->IdType == FDCAN_EXTENDED_ID */
+      {
+        assert_param(IS_FDCAN_MAX_VALUE(pTxHeader->Identifier, 0x1FFFFFFFU));
+      }
+      assert_param(IS_FDCAN_FRAME_TYPE(pTxHeader->TxFrameType));
+      assert_param(IS_FDCAN_DLC(pTxHeader->DataLength));
+      assert_param(IS_FDCAN_ESI(pTxHeader->ErrorStateIndicator));
+      assert_param(IS_FDCAN_BRS(pTxHeader->BitRateSwitch));
+      assert_param(IS_FDCAN_FDF(pTxHeader->FDFormat));
+      assert_param(IS_FDCAN_EFC(pTxHeader->TxEventFifoControl));
+      assert_param(IS_FDCAN_MAX_VALUE(pTxHeader->MessageMarker, 0xFFU));
+
+      /* In Tx Queue mode, skip the elements still holding a pending request */
+      while ((TxPending & ((uint32_t)1 << PutIndex)) != 0U)
+      {
+        PutIndex++;
+        if (PutIndex == FifoEnd)
+        {
+          PutIndex = FifoStart;
+        }
+      }
+
+      /* Add the message to the Tx FIFO/Queue */
+      FDCAN_CopyMessageToRAM(hfdcan, pTxHeader, pTxMessages[TxIndex].pData, PutIndex);
+      BufferIndexes |= ((uint32_t)1 << PutIndex);
+      LastIndex = PutIndex;
+
+      /* Move to the next element, wrapping at the end of the Tx FIFO/Queue */
+      PutIndex++;
+      if (PutIndex == FifoEnd)
+      {
+        PutIndex = FifoStart;
+      }
+    }
+
+    /* Activate all the corresponding transmission requests at once. The batch is recorded
+       as pending in the same critical section, so that the Tx complete interrupt neither
+       sees it before the requests reset its TXBTO/TXBCF bits nor misses its completion */
+    primask_bit = __get_PRIMASK();
+    __disable_irq();
+    hfdcan->Instance->TXBAR = BufferIndexes;
+    hfdcan->TxBatchPending |= BufferIndexes;
+    __set_PRIMASK(primask_bit);
+
+    /* Store the Latest Tx FIFO/Queue Request Buffer Index */
+    hfdcan->LatestTxFifoQRequest = ((uint32_t)1 << LastIndex);
+
+    *pBufferIndexes = BufferIndexes;
+
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+}
+
 /**
   * @brief  Get Tx buffer index of latest Tx FIFO/Queue request
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -2212,8 +2582,6 @@ HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t R
                                          FDCAN_RxHeaderTypeDef *pRxHeader, uint8_t *pRxData)
 {
   uint32_t *RxAddress;
-  uint8_t  *pData;
-  uint32_t ByteCounter;
   uint32_t GetIndex;
   HAL_FDCAN_StateTypeDef state = hfdcan->State;
 
@@ -2222,127 +2590,88 @@ HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t R
 
   if (state == HAL_FDCAN_STATE_BUSY)
   {
-    if (RxLocation == FDCAN_RX_FIFO0) /* Rx element is assigned to the Rx FIFO 0 */
+    /* Get the Rx element address */
+    if (FDCAN_GetRxElementAddress(hfdcan, RxLocation, &RxAddress, &GetIndex) != HAL_OK)
     {
-      /* Check that the Rx FIFO 0 is not empty */
-      if ((hfdcan->Instance->RXF0S & FDCAN_RXF0S_F0FL) == 0U)
-      {
-        /* Update error code */
-        hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
-
-        return HAL_ERROR;
-      }
-      else
-      {
-        /* Calculate Rx FIFO 0 element index */
-        GetIndex = ((hfdcan->Instance->RXF0S & FDCAN_RXF0S_F0GI) >> FDCAN_RXF0S_F0GI_Pos);
+      return HAL_ERROR;
+    }
 
-        /* Check that the Rx FIFO 0 is full & overwrite mode is on */
-        if (((hfdcan->Instance->RXF0S & FDCAN_RXF0S_F0F) >> FDCAN_RXF0S_F0F_Pos) == 1U)
-        {
-          if (((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F0OM) >> FDCAN_RXGFC_F0OM_Pos) == FDCAN_RX_FIFO_OVERWRITE)
-          {
-            /* When overwrite status is on discard first message in FIFO */
-            /* GetIndex is incremented by one and wraps to 0 in case it overflows the FIFO size */
-            GetIndex = (GetIndex + 1U) % SRAMCAN_RF0_NBR;
-          }
-        }
+    /* Retrieve Rx header */
+    FDCAN_GetRxHeader(RxAddress, pRxHeader);
 
-        /* Calculate Rx FIFO 0 element address */
-        RxAddress = (uint32_t *)(hfdcan->msgRam.RxFIFO0SA + (GetIndex * SRAMCAN_RF0_SIZE));
-      }
-    }
-    else /* Rx element is assigned to the Rx FIFO 1 */
+    /* Discard the non-matching frames rejected by the software filter */
+    while (FDCAN_IsRxMessageFiltered(hfdcan, pRxHeader) != 0U)
     {
-      /* Check that the Rx FIFO 1 is not empty */
-      if ((hfdcan->Instance->RXF1S & FDCAN_RXF1S_F1FL) == 0U)
-      {
-        /* Update error code */
-        hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
+      FDCAN_AcknowledgeRxElement(hfdcan, RxLocation, GetIndex);
 
-        return HAL_ERROR;
-      }
-      else
+      if (FDCAN_GetRxElementAddress(hfdcan, RxLocation, &RxAddress, &GetIndex) != HAL_OK)
       {
-        /* Calculate Rx FIFO 1 element index */
-        GetIndex = ((hfdcan->Instance->RXF1S & FDCAN_RXF1S_F1GI) >> FDCAN_RXF1S_F1GI_Pos);
-
-        /* Check that the Rx FIFO 1 is full & overwrite mode is on */
-        if (((hfdcan->Instance->RXF1S & FDCAN_RXF1S_F1F) >> FDCAN_RXF1S_F1F_Pos) == 1U)
-        {
-          if (((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F1OM) >> FDCAN_RXGFC_F1OM_Pos) == FDCAN_RX_FIFO_OVERWRITE)
-          {
-            /* When overwrite status is on discard first message in FIFO */
-            /* GetIndex is incremented by one and wraps to 0 in case it overflows the FIFO size */
-            GetIndex = (GetIndex + 1U) % SRAMCAN_RF1_NBR;
-          }
-        }
-
-        /* Calculate Rx FIFO 1 element address */
-        RxAddress = (uint32_t *)(hfdcan->msgRam.RxFIFO1SA + (GetIndex * SRAMCAN_RF1_SIZE));
+        return HAL_ERROR;
       }
-    }
-
-    /* Retrieve IdType */
-    pRxHeader->IdType = *RxAddress & FDCAN_ELEMENT_MASK_XTD;
 
-    /* Retrieve Identifier */
-    if (pRxHeader->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
-    {
-      pRxHeader->Identifier = ((*RxAddress & FDCAN_ELEMENT_MASK_STDID) >> 18U);
-    }
-    else /* Extended ID element */
-    {
-      pRxHeader->Identifier = (*RxAddress & FDCAN_ELEMENT_MASK_EXTID);
+      FDCAN_GetRxHeader(RxAddress, pRxHeader);
     }
 
-    /* Retrieve RxFrameType */
-    pRxHeader->RxFrameType = (*RxAddress & FDCAN_ELEMENT_MASK_RTR);
-
-    /* Retrieve ErrorStateIndicator */
-    pRxHeader->ErrorStateIndicator = (*RxAddress & FDCAN_ELEMENT_MASK_ESI);
-
-    /* Increment RxAddress pointer to second word of Rx FIFO element */
-    RxAddress++;
-
-    /* Retrieve RxTimestamp */
-    pRxHeader->RxTimestamp = (*RxAddress & FDCAN_ELEMENT_MASK_TS);
-
-    /* Retrieve DataLength */
-    pRxHeader->DataLength = ((*RxAddress & FDCAN_ELEMENT_MASK_DLC) >> 16U);
+    /* Retrieve Rx payload */
+    FDCAN_CopyMessageFromRAM(&RxAddress[2], pRxData, pRxHeader->DataLength);
 
-    /* Retrieve BitRateSwitch */
-    pRxHeader->BitRateSwitch = (*RxAddress & FDCAN_ELEMENT_MASK_BRS);
+    /* Acknowledge the Rx element */
+    FDCAN_AcknowledgeRxElement(hfdcan, RxLocation, GetIndex);
 
-    /* Retrieve FDFormat */
-    pRxHeader->FDFormat = (*RxAddress & FDCAN_ELEMENT_MASK_FDF);
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
 
-    /* Retrieve FilterIndex */
-    pRxHeader->FilterIndex = ((*RxAddress & FDCAN_ELEMENT_MASK_FIDX) >> 24U);
+    return HAL_ERROR;
+  }
+}
 
-    /* Retrieve NonMatchingFrame */
-    pRxHeader->IsFilterMatchingFrame = ((*RxAddress & FDCAN_ELEMENT_MASK_ANMF) >> 31U);
+/**
+  * @brief  Get an FDCAN frame from the Rx FIFO zone without copying its payload.
+  * @note   pRxData points to the payload in the message RAM, the element is not
+  *         acknowledged so that the caller can parse it in place. HAL_FDCAN_ReleaseRxMessage
+  *         must be called with the returned index once the frame has been processed.
+  * @note   In Rx FIFO overwrite mode, the element may be overwritten by a new frame
+  *         until it has been released.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxLocation Location of the received message to be read.
+  *         This parameter can be a value of @arg FDCAN_Rx_location.
+  * @param  pRxHeader pointer to a FDCAN_RxHeaderTypeDef structure.
+  * @param  pRxData pointer to the payload of the Rx frame in the message RAM.
+  * @param  pRxIndex pointer to the Rx FIFO element index of the frame, to be given
+  *         to HAL_FDCAN_ReleaseRxMessage.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_PeekRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                                          FDCAN_RxHeaderTypeDef *pRxHeader, const uint8_t **pRxData,
+                                          uint32_t *pRxIndex)
+{
+  uint32_t *RxAddress;
+  uint32_t GetIndex;
+  HAL_FDCAN_StateTypeDef state = hfdcan->State;
 
-    /* Increment RxAddress pointer to payload of Rx FIFO element */
-    RxAddress++;
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxLocation));
 
-    /* Retrieve Rx payload */
-    pData = (uint8_t *)RxAddress;
-    for (ByteCounter = 0; ByteCounter < DLCtoBytes[pRxHeader->DataLength]; ByteCounter++)
+  if (state == HAL_FDCAN_STATE_BUSY)
+  {
+    /* Get the Rx element address */
+    if (FDCAN_GetRxElementAddress(hfdcan, RxLocation, &RxAddress, &GetIndex) != HAL_OK)
     {
-      pRxData[ByteCounter] = pData[ByteCounter];
+      return HAL_ERROR;
     }
 
-    if (RxLocation == FDCAN_RX_FIFO0) /* Rx element is assigned to the Rx FIFO 0 */
-    {
-      /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
-      hfdcan->Instance->RXF0A = GetIndex;
-    }
-    else /* Rx element is assigned to the Rx FIFO 1 */
-    {
-      /* Acknowledge the Rx FIFO 1 that the oldest element is read so that it increments the GetIndex */
-      hfdcan->Instance->RXF1A = GetIndex;
-    }
+    /* Retrieve Rx header */
+    FDCAN_GetRxHeader(RxAddress, pRxHeader);
+
+    /* Return the address of the Rx payload and the element to release */
+    *pRxData = (const uint8_t *)&RxAddress[2];
+    *pRxIndex = GetIndex;
 
     /* Return function status */
     return HAL_OK;
@@ -2357,45 +2686,224 @@ HAL_StatusTypeDef HAL_FDCAN_GetRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t R
 }
 
 /**
-  * @brief  Get an FDCAN Tx event from the Tx Event FIFO zone into the message RAM.
+  * @brief  Release an FDCAN frame previously returned by HAL_FDCAN_PeekRxMessage.
+  * @note   The element given by RxIndex is acknowledged, and not the current get index
+  *         which the hardware may have moved in Rx FIFO overwrite mode.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
   *         the configuration information for the specified FDCAN.
-  * @param  pTxEvent pointer to a FDCAN_TxEventFifoTypeDef structure.
+  * @param  RxLocation Location of the received message to be released.
+  *         This parameter can be a value of @arg FDCAN_Rx_location.
+  * @param  RxIndex Rx FIFO element index returned by HAL_FDCAN_PeekRxMessage.
   * @retval HAL status
   */
-HAL_StatusTypeDef HAL_FDCAN_GetTxEvent(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxEventFifoTypeDef *pTxEvent)
+HAL_StatusTypeDef HAL_FDCAN_ReleaseRxMessage(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t RxIndex)
 {
-  uint32_t *TxEventAddress;
-  uint32_t GetIndex;
   HAL_FDCAN_StateTypeDef state = hfdcan->State;
 
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxLocation));
+
   if (state == HAL_FDCAN_STATE_BUSY)
   {
-    /* Check that the Tx event FIFO is not empty */
-    if ((hfdcan->Instance->TXEFS & FDCAN_TXEFS_EFFL) == 0U)
+    /* Check that the Rx element exists */
+    if (((RxLocation == FDCAN_RX_FIFO0) && (RxIndex >= SRAMCAN_RF0_NBR)) ||
+        ((RxLocation == FDCAN_RX_FIFO1) && (RxIndex >= SRAMCAN_RF1_NBR)))
     {
       /* Update error code */
-      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
 
       return HAL_ERROR;
     }
 
-    /* Calculate Tx event FIFO element address */
-    GetIndex = ((hfdcan->Instance->TXEFS & FDCAN_TXEFS_EFGI) >> FDCAN_TXEFS_EFGI_Pos);
-    TxEventAddress = (uint32_t *)(hfdcan->msgRam.TxEventFIFOSA + (GetIndex * SRAMCAN_TEF_SIZE));
-
-    /* Retrieve IdType */
-    pTxEvent->IdType = *TxEventAddress & FDCAN_ELEMENT_MASK_XTD;
+    /* Acknowledge the Rx element returned by HAL_FDCAN_PeekRxMessage */
+    FDCAN_AcknowledgeRxElement(hfdcan, RxLocation, RxIndex);
 
-    /* Retrieve Identifier */
-    if (pTxEvent->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
-    {
-      pTxEvent->Identifier = ((*TxEventAddress & FDCAN_ELEMENT_MASK_STDID) >> 18U);
-    }
-    else /* Extended ID element */
-    {
-      pTxEvent->Identifier = (*TxEventAddress & FDCAN_ELEMENT_MASK_EXTID);
-    }
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Get up to Count FDCAN frames from an Rx FIFO with a single acknowledge.
+  * @note   The Rx FIFO fill level is read once and the frames are copied in
+  *         reception order. Only the get index of the last copied element is
+  *         acknowledged, which releases all the preceding elements as well.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxFifo Rx FIFO.
+  *         This parameter can be one of the following values:
+  *           @arg FDCAN_RX_FIFO0: Rx FIFO 0
+  *           @arg FDCAN_RX_FIFO1: Rx FIFO 1
+  * @param  pRxMessages pointer to an array of Count FDCAN_RxMessageTypeDef structures.
+  * @param  Count maximum number of frames to read.
+  * @param  pRxCount pointer to the number of frames actually read.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_GetRxMessages(FDCAN_HandleTypeDef *hfdcan, uint32_t RxFifo,
+                                          FDCAN_RxMessageTypeDef *pRxMessages, uint32_t Count,
+                                          uint32_t *pRxCount)
+{
+  uint32_t *RxAddress;
+  uint32_t RxFifoStatus;
+  uint32_t RxFifoSA;
+  uint32_t ElementSize;
+  uint32_t FifoSize;
+  uint32_t FifoFull;
+  uint32_t OverwriteMode;
+  uint32_t FillLevel;
+  uint32_t GetIndex;
+  uint32_t AckIndex = 0U;
+  uint32_t RxCount;
+  uint32_t ElementCount;
+  HAL_FDCAN_StateTypeDef state = hfdcan->State;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_RX_FIFO(RxFifo));
+
+  if ((pRxMessages == NULL) || (pRxCount == NULL))
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+
+    return HAL_ERROR;
+  }
+
+  if (state == HAL_FDCAN_STATE_BUSY)
+  {
+    if (RxFifo == FDCAN_RX_FIFO0) /* Rx elements are read from the Rx FIFO 0 */
+    {
+      /* Read the Rx FIFO 0 status once */
+      RxFifoStatus = hfdcan->Instance->RXF0S;
+
+      FifoSize = SRAMCAN_RF0_NBR;
+      OverwriteMode = ((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F0OM) >> FDCAN_RXGFC_F0OM_Pos);
+      FillLevel = (RxFifoStatus & FDCAN_RXF0S_F0FL);
+      GetIndex = ((RxFifoStatus & FDCAN_RXF0S_F0GI) >> FDCAN_RXF0S_F0GI_Pos);
+      FifoFull = ((RxFifoStatus & FDCAN_RXF0S_F0F) >> FDCAN_RXF0S_F0F_Pos);
+      RxFifoSA = hfdcan->msgRam.RxFIFO0SA;
+      ElementSize = SRAMCAN_RF0_SIZE;
+    }
+    else /* Rx elements are read from the Rx FIFO 1 */
+    {
+      /* Read the Rx FIFO 1 status once */
+      RxFifoStatus = hfdcan->Instance->RXF1S;
+
+      FifoSize = SRAMCAN_RF1_NBR;
+      OverwriteMode = ((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F1OM) >> FDCAN_RXGFC_F1OM_Pos);
+      FillLevel = (RxFifoStatus & FDCAN_RXF1S_F1FL);
+      GetIndex = ((RxFifoStatus & FDCAN_RXF1S_F1GI) >> FDCAN_RXF1S_F1GI_Pos);
+      FifoFull = ((RxFifoStatus & FDCAN_RXF1S_F1F) >> FDCAN_RXF1S_F1F_Pos);
+      RxFifoSA = hfdcan->msgRam.RxFIFO1SA;
+      ElementSize = SRAMCAN_RF1_SIZE;
+    }
+
+    /* Check that the Rx FIFO is full & overwrite mode is on */
+    if ((FifoFull == 1U) && (OverwriteMode == FDCAN_RX_FIFO_OVERWRITE))
+    {
+      /* When overwrite status is on discard first message in FIFO */
+      GetIndex = (GetIndex + 1U) % FifoSize;
+      FillLevel--;
+    }
+
+    /* Check that the Rx FIFO is not empty, once the overwritten element is discarded */
+    if (FillLevel == 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
+
+      return HAL_ERROR;
+    }
+
+    RxCount = 0U;
+    for (ElementCount = 0U; (RxCount < Count) && (ElementCount < FillLevel); ElementCount++)
+    {
+      /* Calculate Rx FIFO element address */
+      RxAddress = (uint32_t *)(RxFifoSA + (GetIndex * ElementSize));
+
+      /* Retrieve Rx header, and payload unless the software filter rejects the frame */
+      FDCAN_GetRxHeader(RxAddress, &pRxMessages[RxCount].Header);
+      if (FDCAN_IsRxMessageFiltered(hfdcan, &pRxMessages[RxCount].Header) == 0U)
+      {
+        FDCAN_CopyMessageFromRAM(&RxAddress[2], pRxMessages[RxCount].Data, pRxMessages[RxCount].Header.DataLength);
+        RxCount++;
+      }
+
+      /* Move to the next Rx FIFO element */
+      AckIndex = GetIndex;
+      GetIndex++;
+      if (GetIndex == FifoSize)
+      {
+        GetIndex = 0U;
+      }
+    }
+
+    if (ElementCount != 0U)
+    {
+      /* Acknowledge the last element read, the Rx FIFO get index moves past all the read elements */
+      FDCAN_AcknowledgeRxElement(hfdcan, RxFifo, AckIndex);
+    }
+
+    *pRxCount = RxCount;
+
+    /* Return function status */
+    return HAL_OK;
+  }
+  else
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_NOT_STARTED;
+
+    return HAL_ERROR;
+  }
+}
+
+/**
+  * @brief  Get an FDCAN Tx event from the Tx Event FIFO zone into the message RAM.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pTxEvent pointer to a FDCAN_TxEventFifoTypeDef structure.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_FDCAN_GetTxEvent(FDCAN_HandleTypeDef *hfdcan, FDCAN_TxEventFifoTypeDef *pTxEvent)
+{
+  uint32_t *TxEventAddress;
+  uint32_t GetIndex;
+  HAL_FDCAN_StateTypeDef state = hfdcan->State;
+
+  if (state == HAL_FDCAN_STATE_BUSY)
+  {
+    /* Check that the Tx event FIFO is not empty */
+    if ((hfdcan->Instance->TXEFS & FDCAN_TXEFS_EFFL) == 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
+
+      return HAL_ERROR;
+    }
+
+    /* Calculate Tx event FIFO element address */
+    GetIndex = ((hfdcan->Instance->TXEFS & FDCAN_TXEFS_EFGI) >> FDCAN_TXEFS_EFGI_Pos);
+    TxEventAddress = (uint32_t *)(hfdcan->msgRam.TxEventFIFOSA + (GetIndex * SRAMCAN_TEF_SIZE));
+
+    /* Retrieve IdType */
+    pTxEvent->IdType = *TxEventAddress & FDCAN_ELEMENT_MASK_XTD;
+
+    /* Retrieve Identifier */
+    if (pTxEvent->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
+    {
+      pTxEvent->Identifier = ((*TxEventAddress & FDCAN_ELEMENT_MASK_STDID) >> 18U);
+    }
+    else /* Extended ID element */
+    {
+      pTxEvent->Identifier = (*TxEventAddress & FDCAN_ELEMENT_MASK_EXTID);
+    }
 
     /* Retrieve TxFrameType */
     pTxEvent->TxFrameType = (*TxEventAddress & FDCAN_ELEMENT_MASK_RTR);
@@ -2957,6 +3465,9 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
       /* Transmission Cancellation Callback */
       HAL_FDCAN_TxBufferAbortCallback(hfdcan, AbortedBuffers);
 #endif /* USE_HAL_FDCAN_REGISTER_CALLBACKS */
+
+      /* Signal the completion of the pending Tx batches */
+      FDCAN_CheckTxBatchComplete(hfdcan);
     }
   }
 
@@ -3042,6 +3553,9 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
       /* Transmission Complete Callback */
       HAL_FDCAN_TxBufferCompleteCallback(hfdcan, TransmittedBuffers);
 #endif /* USE_HAL_FDCAN_REGISTER_CALLBACKS */
+
+      /* Signal the completion of the pending Tx batches */
+      FDCAN_CheckTxBatchComplete(hfdcan);
     }
   }
 
@@ -3150,6 +3664,7 @@ void HAL_FDCAN_IRQHandler(FDCAN_HandleTypeDef *hfdcan)
       (+) HAL_FDCAN_TxFifoEmptyCallback
       (+) HAL_FDCAN_TxBufferCompleteCallback
       (+) HAL_FDCAN_TxBufferAbortCallback
+      (+) HAL_FDCAN_TxBatchCompleteCallback
       (+) HAL_FDCAN_HighPriorityMessageCallback
       (+) HAL_FDCAN_TimestampWraparoundCallback
       (+) HAL_FDCAN_TimeoutOccurredCallback
@@ -3271,6 +3786,22 @@ __weak void HAL_FDCAN_TxBufferAbortCallback(FDCAN_HandleTypeDef *hfdcan, uint32_
    */
 }
 
+/**
+  * @brief  Tx batch complete callback.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @retval None
+  */
+__weak void HAL_FDCAN_TxBatchCompleteCallback(FDCAN_HandleTypeDef *hfdcan)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(hfdcan);
+
+  /* NOTE: This function Should not be modified, when the callback is needed,
+            the HAL_FDCAN_TxBatchCompleteCallback could be implemented in the user file
+   */
+}
+
 /**
   * @brief  Timestamp Wraparound callback.
   * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
@@ -3511,6 +4042,430 @@ static void FDCAN_CopyMessageToRAM(const FDCAN_HandleTypeDef *hfdcan, const FDCA
   }
 }
 
+/**
+  * @brief  Get the address of the Rx element to be read from the Rx FIFO zone.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxLocation Location of the received message to be read.
+  *         This parameter can be a value of @arg FDCAN_Rx_location.
+  * @param  pRxAddress pointer to the address of the Rx element in the message RAM.
+  * @param  pGetIndex pointer to the Rx FIFO get index of the element.
+  * @retval HAL status
+ */
+static HAL_StatusTypeDef FDCAN_GetRxElementAddress(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation,
+                                                   uint32_t **pRxAddress, uint32_t *pGetIndex)
+{
+  uint32_t *RxAddress;
+  uint32_t GetIndex;
+  uint32_t RxFifoStatus;
+
+  if (RxLocation == FDCAN_RX_FIFO0) /* Rx element is assigned to the Rx FIFO 0 */
+  {
+    /* Read the Rx FIFO 0 status once */
+    RxFifoStatus = hfdcan->Instance->RXF0S;
+
+    /* Check that the Rx FIFO 0 is not empty */
+    if ((RxFifoStatus & FDCAN_RXF0S_F0FL) == 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
+
+      return HAL_ERROR;
+    }
+    else
+    {
+      /* Calculate Rx FIFO 0 element index */
+      GetIndex = ((RxFifoStatus & FDCAN_RXF0S_F0GI) >> FDCAN_RXF0S_F0GI_Pos);
+
+      /* Check that the Rx FIFO 0 is full & overwrite mode is on */
+      if (((RxFifoStatus & FDCAN_RXF0S_F0F) >> FDCAN_RXF0S_F0F_Pos) == 1U)
+      {
+        if (((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F0OM) >> FDCAN_RXGFC_F0OM_Pos) == FDCAN_RX_FIFO_OVERWRITE)
+        {
+          /* When overwrite status is on discard first message in FIFO */
+          /* GetIndex is incremented by one and wraps to 0 in case it overflows the FIFO size */
+          GetIndex = (GetIndex + 1U) % SRAMCAN_RF0_NBR;
+        }
+      }
+
+      /* Calculate Rx FIFO 0 element address */
+      RxAddress = (uint32_t *)(hfdcan->msgRam.RxFIFO0SA + (GetIndex * SRAMCAN_RF0_SIZE));
+    }
+  }
+  else /* Rx element is assigned to the Rx FIFO 1 */
+  {
+    /* Read the Rx FIFO 1 status once */
+    RxFifoStatus = hfdcan->Instance->RXF1S;
+
+    /* Check that the Rx FIFO 1 is not empty */
+    if ((RxFifoStatus & FDCAN_RXF1S_F1FL) == 0U)
+    {
+      /* Update error code */
+      hfdcan->ErrorCode |= HAL_FDCAN_ERROR_FIFO_EMPTY;
+
+      return HAL_ERROR;
+    }
+    else
+    {
+      /* Calculate Rx FIFO 1 element index */
+      GetIndex = ((RxFifoStatus & FDCAN_RXF1S_F1GI) >> FDCAN_RXF1S_F1GI_Pos);
+
+      /* Check that the Rx FIFO 1 is full & overwrite mode is on */
+      if (((RxFifoStatus & FDCAN_RXF1S_F1F) >> FDCAN_RXF1S_F1F_Pos) == 1U)
+      {
+        if (((hfdcan->Instance->RXGFC & FDCAN_RXGFC_F1OM) >> FDCAN_RXGFC_F1OM_Pos) == FDCAN_RX_FIFO_OVERWRITE)
+        {
+          /* When overwrite status is on discard first message in FIFO */
+          /* GetIndex is incremented by one and wraps to 0 in case it overflows the FIFO size */
+          GetIndex = (GetIndex + 1U) % SRAMCAN_RF1_NBR;
+        }
+      }
+
+      /* Calculate Rx FIFO 1 element address */
+      RxAddress = (uint32_t *)(hfdcan->msgRam.RxFIFO1SA + (GetIndex * SRAMCAN_RF1_SIZE));
+    }
+  }
+
+  *pRxAddress = RxAddress;
+  *pGetIndex = GetIndex;
+
+  /* Return function status */
+  return HAL_OK;
+}
+
+/**
+  * @brief  Decode the header of an Rx element of the message RAM.
+  * @param  RxAddress address of the Rx element in the message RAM.
+  * @param  pRxHeader pointer to a FDCAN_RxHeaderTypeDef structure.
+  * @retval none
+ */
+static void FDCAN_GetRxHeader(const uint32_t *RxAddress, FDCAN_RxHeaderTypeDef *pRxHeader)
+{
+  /* Read the two header words of the Rx element once */
+  uint32_t RxElementW1 = RxAddress[0];
+  uint32_t RxElementW2 = RxAddress[1];
+
+  /* Retrieve IdType */
+  pRxHeader->IdType = RxElementW1 & FDCAN_ELEMENT_MASK_XTD;
+
+  /* Retrieve Identifier */
+  if (pRxHeader->IdType == FDCAN_STANDARD_ID) /* Standard ID element */
+  {
+    pRxHeader->Identifier = ((RxElementW1 & FDCAN_ELEMENT_MASK_STDID) >> 18U);
+  }
+  else /* Extended ID element */
+  {
+    pRxHeader->Identifier = (RxElementW1 & FDCAN_ELEMENT_MASK_EXTID);
+  }
+
+  /* Retrieve RxFrameType */
+  pRxHeader->RxFrameType = (RxElementW1 & FDCAN_ELEMENT_MASK_RTR);
+
+  /* Retrieve ErrorStateIndicator */
+  pRxHeader->ErrorStateIndicator = (RxElementW1 & FDCAN_ELEMENT_MASK_ESI);
+
+  /* Retrieve RxTimestamp */
+  pRxHeader->RxTimestamp = (RxElementW2 & FDCAN_ELEMENT_MASK_TS);
+
+  /* Retrieve DataLength */
+  pRxHeader->DataLength = ((RxElementW2 & FDCAN_ELEMENT_MASK_DLC) >> 16U);
+
+  /* Retrieve BitRateSwitch */
+  pRxHeader->BitRateSwitch = (RxElementW2 & FDCAN_ELEMENT_MASK_BRS);
+
+  /* Retrieve FDFormat */
+  pRxHeader->FDFormat = (RxElementW2 & FDCAN_ELEMENT_MASK_FDF);
+
+  /* Retrieve FilterIndex */
+  pRxHeader->FilterIndex = ((RxElementW2 & FDCAN_ELEMENT_MASK_FIDX) >> 24U);
+
+  /* Retrieve NonMatchingFrame */
+  pRxHeader->IsFilterMatchingFrame = ((RxElementW2 & FDCAN_ELEMENT_MASK_ANMF) >> 31U);
+}
+
+/**
+  * @brief  Copy Rx payload from the message RAM.
+  * @note   The message RAM is read by 32-bit words, the destination buffer
+  *         does not need to be word aligned.
+  * @param  RxAddress address of the payload of the Rx element in the message RAM.
+  * @param  pRxData pointer to a buffer where the payload of the Rx frame will be stored.
+  * @param  DataLength data length code of the Rx frame.
+  * @retval none
+ */
+static void FDCAN_CopyMessageFromRAM(const uint32_t *RxAddress, uint8_t *pRxData, uint32_t DataLength)
+{
+  const uint32_t *pRxWord = RxAddress;
+  uint32_t ByteCounter;
+  uint32_t ByteCount = DLCtoBytes[DataLength];
+  uint32_t RxWord;
+
+  /* Copy the complete words of the Rx payload */
+  for (ByteCounter = 0U; (ByteCounter + 4U) <= ByteCount; ByteCounter += 4U)
+  {
+    __UNALIGNED_UINT32_WRITE(&pRxData[ByteCounter], *pRxWord);
+    pRxWord++;
+  }
+
+  /* Copy the remaining bytes of the last word (classic CAN frames of 1 to 7 bytes) */
+  if (ByteCounter < ByteCount)
+  {
+    RxWord = *pRxWord;
+    while (ByteCounter < ByteCount)
+    {
+      pRxData[ByteCounter] = (uint8_t)RxWord;
+      RxWord >>= 8U;
+      ByteCounter++;
+    }
+  }
+}
+
+/**
+  * @brief  Acknowledge a read Rx element so that its message RAM location can be reused.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  RxLocation Location of the received message.
+  *         This parameter can be a value of @arg FDCAN_Rx_location.
+  * @param  GetIndex Rx FIFO get index of the element.
+  * @retval none
+ */
+static void FDCAN_AcknowledgeRxElement(FDCAN_HandleTypeDef *hfdcan, uint32_t RxLocation, uint32_t GetIndex)
+{
+  if (RxLocation == FDCAN_RX_FIFO0) /* Rx element is assigned to the Rx FIFO 0 */
+  {
+    /* Acknowledge the Rx FIFO 0 that the oldest element is read so that it increments the GetIndex */
+    hfdcan->Instance->RXF0A = GetIndex;
+  }
+  else /* Rx element is assigned to the Rx FIFO 1 */
+  {
+    /* Acknowledge the Rx FIFO 1 that the oldest element is read so that it increments the GetIndex */
+    hfdcan->Instance->RXF1A = GetIndex;
+  }
+}
+
+/**
+  * @brief  Signal the completion of the pending Tx batches.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @retval None
+  */
+static void FDCAN_CheckTxBatchComplete(FDCAN_HandleTypeDef *hfdcan)
+{
+  if (hfdcan->TxBatchPending != 0U)
+  {
+    /* The transmitted and cancelled buffers are no longer pending */
+    hfdcan->TxBatchPending &= ~(hfdcan->Instance->TXBTO | hfdcan->Instance->TXBCF);
+
+    if (hfdcan->TxBatchPending == 0U)
+    {
+#if USE_HAL_FDCAN_REGISTER_CALLBACKS == 1
+      /* Call registered callback*/
+      hfdcan->TxBatchCompleteCallback(hfdcan);
+#else
+      /* Tx batch complete Callback */
+      HAL_FDCAN_TxBatchCompleteCallback(hfdcan);
+#endif /* USE_HAL_FDCAN_REGISTER_CALLBACKS */
+    }
+  }
+}
+
+/**
+  * @brief  Compile a reception filter rule into the software filter.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  sFilterConfig pointer to an FDCAN_FilterTypeDef structure.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef FDCAN_AddSoftwareFilterRule(FDCAN_HandleTypeDef *hfdcan,
+                                                     const FDCAN_FilterTypeDef *sFilterConfig)
+{
+  FDCAN_SwFilterTypeDef *pSwFilter = hfdcan->pSwFilter;
+  uint32_t Identifier;
+  uint32_t Mask;
+  uint32_t FreeBits;
+  uint32_t SubSet;
+  uint32_t NonMatching;
+  HAL_StatusTypeDef status = HAL_OK;
+
+  /* Check function parameters */
+  assert_param(IS_FDCAN_ID_TYPE(sFilterConfig->IdType));
+  assert_param(IS_FDCAN_FILTER_CFG(sFilterConfig->FilterConfig));
+
+  /* Retrieve the Rx FIFO where the global filter stores the non-matching frames */
+  if (sFilterConfig->IdType == FDCAN_STANDARD_ID)
+  {
+    NonMatching = ((hfdcan->Instance->RXGFC & FDCAN_RXGFC_ANFS) >> FDCAN_RXGFC_ANFS_Pos);
+  }
+  else
+  {
+    NonMatching = ((hfdcan->Instance->RXGFC & FDCAN_RXGFC_ANFE) >> FDCAN_RXGFC_ANFE_Pos);
+  }
+
+  /* A software rule only sorts the frames already stored in that Rx FIFO: it can neither
+     move a frame to the other Rx FIFO nor raise a high priority message event */
+  if (((sFilterConfig->FilterConfig != FDCAN_FILTER_TO_RXFIFO0) || (NonMatching != FDCAN_ACCEPT_IN_RX_FIFO0)) &&
+      ((sFilterConfig->FilterConfig != FDCAN_FILTER_TO_RXFIFO1) || (NonMatching != FDCAN_ACCEPT_IN_RX_FIFO1)))
+  {
+    status = HAL_ERROR;
+  }
+  else if (sFilterConfig->IdType == FDCAN_STANDARD_ID)
+  {
+    /* Check function parameters */
+    assert_param(IS_FDCAN_MAX_VALUE(sFilterConfig->FilterID1, 0x7FFU));
+    assert_param(IS_FDCAN_MAX_VALUE(sFilterConfig->FilterID2, 0x7FFU));
+    assert_param(IS_FDCAN_STD_FILTER_TYPE(sFilterConfig->FilterType));
+
+    if ((sFilterConfig->FilterType != FDCAN_FILTER_MASK) &&
+        ((sFilterConfig->FilterID1 > 0x7FFU) || (sFilterConfig->FilterID2 > 0x7FFU)))
+    {
+      /* Identifiers above 0x7FF would be set past the end of the bitmap */
+      status = HAL_ERROR;
+    }
+    else if (sFilterConfig->FilterType == FDCAN_FILTER_RANGE)
+    {
+      for (Identifier = sFilterConfig->FilterID1; Identifier <= sFilterConfig->FilterID2; Identifier++)
+      {
+        FDCAN_SW_FILTER_STD_SET(pSwFilter, Identifier);
+      }
+    }
+    else if (sFilterConfig->FilterType == FDCAN_FILTER_DUAL)
+    {
+      FDCAN_SW_FILTER_STD_SET(pSwFilter, sFilterConfig->FilterID1);
+      FDCAN_SW_FILTER_STD_SET(pSwFilter, sFilterConfig->FilterID2);
+    }
+    else /* sFilterConfig->FilterType == FDCAN_FILTER_MASK */
+    {
+      /* Set every identifier matching the rule by walking the subsets of the unmasked bits */
+      Mask = (sFilterConfig->FilterID2 & 0x7FFU);
+      FreeBits = ((~Mask) & 0x7FFU);
+      Identifier = (sFilterConfig->FilterID1 & Mask);
+      SubSet = FreeBits;
+      do
+      {
+        FDCAN_SW_FILTER_STD_SET(pSwFilter, (Identifier | SubSet));
+        SubSet = ((SubSet - 1U) & FreeBits);
+      } while (SubSet != FreeBits);
+    }
+  }
+  else /* sFilterConfig->IdType == FDCAN_EXTENDED_ID */
+  {
+    /* Check function parameters */
+    assert_param(IS_FDCAN_MAX_VALUE(sFilterConfig->FilterID1, 0x1FFFFFFFU));
+    assert_param(IS_FDCAN_MAX_VALUE(sFilterConfig->FilterID2, 0x1FFFFFFFU));
+    assert_param(IS_FDCAN_EXT_FILTER_TYPE(sFilterConfig->FilterType));
+
+    if (sFilterConfig->FilterType == FDCAN_FILTER_DUAL)
+    {
+      status = FDCAN_AddSoftwareFilterKey(pSwFilter, sFilterConfig->FilterID1, 0x1FFFFFFFU);
+      if (status == HAL_OK)
+      {
+        status = FDCAN_AddSoftwareFilterKey(pSwFilter, sFilterConfig->FilterID2, 0x1FFFFFFFU);
+      }
+    }
+    else if (sFilterConfig->FilterType == FDCAN_FILTER_MASK)
+    {
+      status = FDCAN_AddSoftwareFilterKey(pSwFilter, sFilterConfig->FilterID1, sFilterConfig->FilterID2);
+    }
+    else /* Range filters */
+    {
+      /* Ranges of extended identifiers are not hashed */
+      status = HAL_ERROR;
+    }
+  }
+
+  if (status != HAL_OK)
+  {
+    /* Update error code */
+    hfdcan->ErrorCode |= HAL_FDCAN_ERROR_PARAM;
+  }
+
+  /* Return function status */
+  return status;
+}
+
+/**
+  * @brief  Insert an extended identifier key into the software filter hash table.
+  * @param  pSwFilter pointer to an FDCAN_SwFilterTypeDef structure.
+  * @param  Identifier extended identifier of the rule.
+  * @param  Mask mask of the rule.
+  * @retval HAL status
+  */
+static HAL_StatusTypeDef FDCAN_AddSoftwareFilterKey(FDCAN_SwFilterTypeDef *pSwFilter, uint32_t Identifier,
+                                                    uint32_t Mask)
+{
+  FDCAN_SwFilterEntryTypeDef *pEntry;
+  uint32_t RuleMask = (Mask & 0x1FFFFFFFU);
+  uint32_t Key = (Identifier & RuleMask);
+  uint32_t Group = 0U;
+  uint32_t Index;
+
+  /* Keep at least one free entry so that every probe sequence terminates */
+  if ((pSwFilter->ExtRulesNbr + 1U) >= pSwFilter->ExtTableSize)
+  {
+    return HAL_ERROR;
+  }
+
+  /* Look for the group of the rules sharing the same mask */
+  while ((Group < pSwFilter->ExtMasksNbr) && (pSwFilter->ExtMasks[Group] != RuleMask))
+  {
+    Group++;
+  }
+
+  if (Group == pSwFilter->ExtMasksNbr)
+  {
+    if (Group == FDCAN_SW_FILTER_EXT_MASKS)
+    {
+      return HAL_ERROR;
+    }
+
+    /* Open a new group for this mask */
+    pSwFilter->ExtMasks[Group] = RuleMask;
+    pSwFilter->ExtMasksNbr++;
+  }
+
+  /* Probe for the key or for the first free entry */
+  Index = FDCAN_SW_FILTER_HASH(Key, Group, pSwFilter->ExtTableShift);
+  pEntry = &pSwFilter->pExtTable[Index];
+  while ((pEntry->Key != FDCAN_SW_FILTER_FREE_KEY) && ((pEntry->Key != Key) || (pEntry->Group != Group)))
+  {
+    Index = ((Index + 1U) & (pSwFilter->ExtTableSize - 1U));
+    pEntry = &pSwFilter->pExtTable[Index];
+  }
+
+  if (pEntry->Key == FDCAN_SW_FILTER_FREE_KEY)
+  {
+    pEntry->Key = Key;
+    pEntry->Group = Group;
+    pSwFilter->ExtRulesNbr++;
+  }
+
+  return HAL_OK;
+}
+
+/**
+  * @brief  Check whether a received frame is rejected by the software filter.
+  * @note   Only the frames accepted as non-matching by the global filter are
+  *         checked, the frames matching a hardware filter are always kept.
+  * @param  hfdcan pointer to an FDCAN_HandleTypeDef structure that contains
+  *         the configuration information for the specified FDCAN.
+  * @param  pRxHeader pointer to the header of the received frame.
+  * @retval 1 if the frame is rejected, 0 otherwise
+  */
+static uint32_t FDCAN_IsRxMessageFiltered(const FDCAN_HandleTypeDef *hfdcan,
+                                          const FDCAN_RxHeaderTypeDef *pRxHeader)
+{
+  uint32_t Filtered = 0U;
+
+  if ((hfdcan->pSwFilter != NULL) && (pRxHeader->IsFilterMatchingFrame == 1U))
+  {
+    if (HAL_FDCAN_IsSoftwareFilterMatching(hfdcan, pRxHeader->IdType, pRxHeader->Identifier) == 0U)
+    {
+      Filtered = 1U;
+    }
+  }
+
+  return Filtered;
+}
+
 /**
   * @}
   */
@@ -128,6 +128,8 @@
     [..]
     For specific callback RxEventCallback, use dedicated registration/reset functions:
     respectively HAL_UART_RegisterRxEventCallback() , HAL_UART_UnRegisterRxEventCallback().
+    For specific callback TxBufferCpltCallback, use dedicated registration/reset functions:
+    respectively HAL_UART_RegisterTxBufferCpltCallback() , HAL_UART_UnRegisterTxBufferCpltCallback().
 
     [..]
     By default, after the HAL_UART_Init() and when the state is HAL_UART_STATE_RESET
@@ -201,6 +203,7 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart);
 #if defined(HAL_DMA_MODULE_ENABLED)
 static void UART_EndTxTransfer(UART_HandleTypeDef *huart);
 static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma);
+static HAL_StatusTypeDef UART_TxQueueNext(UART_HandleTypeDef *huart);
 static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMARxHalfCplt(DMA_HandleTypeDef *hdma);
 static void UART_DMATxHalfCplt(DMA_HandleTypeDef *hdma);
@@ -330,6 +333,12 @@ HAL_StatusTypeDef HAL_UART_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -397,6 +406,12 @@ HAL_StatusTypeDef HAL_HalfDuplex_Init(UART_HandleTypeDef *huart)
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -485,6 +500,12 @@ HAL_StatusTypeDef HAL_LIN_Init(UART_HandleTypeDef *huart, uint32_t BreakDetectLe
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -571,6 +592,12 @@ HAL_StatusTypeDef HAL_MultiProcessor_Init(UART_HandleTypeDef *huart, uint8_t Add
     /* Allocate lock resource and initialize it */
     huart->Lock = HAL_UNLOCKED;
 
+#if defined(HAL_DMA_MODULE_ENABLED)
+    /* No Tx queue nor Rx stream attached */
+    huart->pTxQueue = NULL;
+    huart->pRxStream = NULL;
+#endif /* HAL_DMA_MODULE_ENABLED */
+
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
     UART_InitCallbacksToDefault(huart);
 
@@ -664,6 +691,7 @@ HAL_StatusTypeDef HAL_UART_DeInit(UART_HandleTypeDef *huart)
   huart->gState = HAL_UART_STATE_RESET;
   huart->RxState = HAL_UART_STATE_RESET;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
   huart->RxEventType = HAL_UART_RXEVENT_TC;
 
   __HAL_UNLOCK(huart);
@@ -999,6 +1027,64 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
   return status;
 }
 
+/**
+  * @brief  Register a User UART Tx Queue Buffer Complete Callback
+  *         To be used instead of the weak predefined callback
+  * @param  huart     Uart handle
+  * @param  pCallback Pointer to the Tx Queue Buffer Complete Callback function
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_RegisterTxBufferCpltCallback(UART_HandleTypeDef *huart,
+                                                        pUART_TxBufferCpltCallbackTypeDef pCallback)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (pCallback == NULL)
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    return HAL_ERROR;
+  }
+
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    huart->TxBufferCpltCallback = pCallback;
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
+/**
+  * @brief  UnRegister the UART Tx Queue Buffer Complete Callback
+  *         UART Tx Queue Buffer Complete Callback is redirected to the weak HAL_UARTEx_TxBufferCpltCallback()
+  *         predefined callback
+  * @param  huart     Uart handle
+  * @retval HAL status
+  */
+HAL_StatusTypeDef HAL_UART_UnRegisterTxBufferCpltCallback(UART_HandleTypeDef *huart)
+{
+  HAL_StatusTypeDef status = HAL_OK;
+
+  if (huart->gState == HAL_UART_STATE_READY)
+  {
+    huart->TxBufferCpltCallback = HAL_UARTEx_TxBufferCpltCallback; /* Legacy weak UART Tx Buffer Complete Callback */
+  }
+  else
+  {
+    huart->ErrorCode |= HAL_UART_ERROR_INVALID_CALLBACK;
+
+    status =  HAL_ERROR;
+  }
+
+  return status;
+}
+
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
 
 /**
@@ -1069,6 +1155,9 @@ HAL_StatusTypeDef HAL_UART_UnRegisterRxEventCallback(UART_HandleTypeDef *huart)
         reception services:
         (++) HAL_UARTEx_RxEventCallback()
 
+    (#) A Tx buffer completion Callback is available for the queued transmission services:
+        (++) HAL_UARTEx_TxBufferCpltCallback()
+
     (#) In Non-Blocking mode transfers, possible errors are split into 2 categories.
         Errors are handled as follows :
        (++) Error is considered as Recoverable and non blocking : Transfer could go till end, but error severity is
@@ -1565,6 +1654,7 @@ HAL_StatusTypeDef HAL_UART_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pData
 
     /* Set Reception type to Standard reception */
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     if (!(IS_LPUART_INSTANCE(huart->Instance)))
     {
@@ -1863,6 +1953,7 @@ HAL_StatusTypeDef HAL_UART_Abort(UART_HandleTypeDef *huart)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   huart->ErrorCode = HAL_UART_ERROR_NONE;
 
@@ -1992,6 +2083,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive(UART_HandleTypeDef *huart)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   return HAL_OK;
 }
@@ -2137,6 +2229,7 @@ HAL_StatusTypeDef HAL_UART_Abort_IT(UART_HandleTypeDef *huart)
     huart->gState  = HAL_UART_STATE_READY;
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2304,6 +2397,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
       /* Restore huart->RxState to Ready */
       huart->RxState = HAL_UART_STATE_READY;
       huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+      huart->pRxStream = NULL;
 
       /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2327,6 +2421,7 @@ HAL_StatusTypeDef HAL_UART_AbortReceive_IT(UART_HandleTypeDef *huart)
     /* Restore huart->RxState to Ready */
     huart->RxState = HAL_UART_STATE_READY;
     huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+    huart->pRxStream = NULL;
 
     /* As no DMA to be aborted, call directly user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -2823,6 +2918,26 @@ __weak void HAL_UARTEx_RxEventCallback(UART_HandleTypeDef *huart, uint16_t Size)
    */
 }
 
+/**
+  * @brief  Tx queue buffer completion callback.
+  * @note   Called once the DMA has read all the data of a buffer enqueued with
+  *         HAL_UARTEx_TxQueue_Enqueue(): the buffer can be reused, while its last data may
+  *         still be in transmission.
+  * @param  huart    UART handle.
+  * @param  pContext Application cookie given with the buffer.
+  * @retval None
+  */
+__weak void HAL_UARTEx_TxBufferCpltCallback(UART_HandleTypeDef *huart, void *pContext)
+{
+  /* Prevent unused argument(s) compilation warning */
+  UNUSED(huart);
+  UNUSED(pContext);
+
+  /* NOTE : This function should not be modified, when the callback is needed,
+            the HAL_UARTEx_TxBufferCpltCallback can be implemented in the user file.
+   */
+}
+
 /**
   * @}
   */
@@ -3145,6 +3260,7 @@ void UART_InitCallbacksToDefault(UART_HandleTypeDef *huart)
   huart->RxFifoFullCallback        = HAL_UARTEx_RxFifoFullCallback;      /* Legacy weak RxFifoFullCallback        */
   huart->TxFifoEmptyCallback       = HAL_UARTEx_TxFifoEmptyCallback;     /* Legacy weak TxFifoEmptyCallback       */
   huart->RxEventCallback           = HAL_UARTEx_RxEventCallback;         /* Legacy weak RxEventCallback           */
+  huart->TxBufferCpltCallback      = HAL_UARTEx_TxBufferCpltCallback;    /* Legacy weak TxBufferCpltCallback      */
 
 }
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
@@ -3687,6 +3803,83 @@ HAL_StatusTypeDef UART_Start_Receive_DMA(UART_HandleTypeDef *huart, uint8_t *pDa
   return HAL_OK;
 }
 
+/**
+  * @brief  Start the transmission of the next buffer of the UART Tx queue.
+  * @note   Nothing is done when a Tx process is ongoing or when the queue is empty.
+  * @param  huart UART handle.
+  * @retval HAL status
+  */
+HAL_StatusTypeDef UART_TxQueueStart(UART_HandleTypeDef *huart)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  const UART_TxBufferTypeDef *pbuffer;
+  HAL_StatusTypeDef status = HAL_OK;
+  uint32_t primask;
+
+  /* Buffers may be enqueued from interrupts of any priority */
+  primask = __get_PRIMASK();
+  __disable_irq();
+
+  if ((huart->gState == HAL_UART_STATE_READY) && (pqueue->PutCount != pqueue->GetCount))
+  {
+    pbuffer = &pqueue->pBuffers[pqueue->GetCount % pqueue->BufferNumber];
+
+    pqueue->Active = 1U;
+    status = HAL_UART_Transmit_DMA(huart, pbuffer->pData, pbuffer->Size);
+    if (status != HAL_OK)
+    {
+      pqueue->Active = 0U;
+    }
+  }
+
+  __set_PRIMASK(primask);
+
+  return status;
+}
+
+/**
+  * @brief  Release the buffer of the UART Tx queue read by the DMA and chain the next one.
+  * @note   The next buffer is started while the last data of the previous one is still
+  *         being shifted out, so that no idle time is inserted between queued buffers.
+  * @param  huart UART handle.
+  * @retval HAL_OK when the next buffer is being sent, HAL_ERROR otherwise
+  */
+static HAL_StatusTypeDef UART_TxQueueNext(UART_HandleTypeDef *huart)
+{
+  UART_TxQueueTypeDef *pqueue = huart->pTxQueue;
+  HAL_StatusTypeDef status = HAL_ERROR;
+  void *pcontext;
+
+  if ((pqueue != NULL) && (pqueue->Active != 0U))
+  {
+    pcontext = pqueue->pBuffers[pqueue->GetCount % pqueue->BufferNumber].pContext;
+    pqueue->GetCount++;
+    pqueue->Active = 0U;
+
+    huart->gState = HAL_UART_STATE_READY;
+    if ((UART_TxQueueStart(huart) == HAL_OK) && (pqueue->Active != 0U))
+    {
+      status = HAL_OK;
+    }
+    else
+    {
+      /* No buffer left: end the transmission on the UART Transmit Complete event */
+      huart->gState = HAL_UART_STATE_BUSY_TX;
+    }
+
+    /* The buffer has been read by the DMA and can be reused by the application */
+#if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
+    /* Call registered Tx Buffer Complete Callback */
+    huart->TxBufferCpltCallback(huart, pcontext);
+#else
+    /* Call legacy weak Tx Buffer Complete Callback */
+    HAL_UARTEx_TxBufferCpltCallback(huart, pcontext);
+#endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+  }
+
+  return status;
+}
+
 
 /**
   * @brief  End ongoing Tx transfer on UART peripheral (following error detection or Transmit completion).
@@ -3725,6 +3918,7 @@ static void UART_EndRxTransfer(UART_HandleTypeDef *huart)
   /* At end of Rx process, restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Reset RxIsr function pointer */
   huart->RxISR = NULL;
@@ -3746,14 +3940,18 @@ static void UART_DMATransmitCplt(DMA_HandleTypeDef *hdma)
   {
     huart->TxXferCount = 0U;
 
+    /* Chain the next buffer of the Tx queue, if any */
+    if (UART_TxQueueNext(huart) != HAL_OK)
+    {
 #if !defined(USART_DMAREQUESTS_SW_WA)
-    /* Disable the DMA transfer for transmit request by resetting the DMAT bit
-       in the UART CR3 register */
-    ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
+      /* Disable the DMA transfer for transmit request by resetting the DMAT bit
+         in the UART CR3 register */
+      ATOMIC_CLEAR_BIT(huart->Instance->CR3, USART_CR3_DMAT);
 
 #endif /* !USART_DMAREQUESTS_SW_WA */
-    /* Enable the UART Transmit Complete Interrupt */
-    ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+      /* Enable the UART Transmit Complete Interrupt */
+      ATOMIC_SET_BIT(huart->Instance->CR1, USART_CR1_TCIE);
+    }
   }
   /* DMA Circular mode */
   else
@@ -3820,6 +4018,12 @@ static void UART_DMAReceiveCplt(DMA_HandleTypeDef *hdma)
     }
   }
 
+  /* Count the Rx stream buffer wraps, the consumer derives the write position from them */
+  if (huart->pRxStream != NULL)
+  {
+    huart->pRxStream->WrapCount++;
+  }
+
   /* Initialize type of RxEvent that correspond to RxEvent callback execution;
      In this case, Rx Event type is Transfer Complete */
   huart->RxEventType = HAL_UART_RXEVENT_TC;
@@ -4004,6 +4208,7 @@ static void UART_DMATxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -4052,6 +4257,7 @@ static void UART_DMARxAbortCallback(DMA_HandleTypeDef *hdma)
   huart->gState  = HAL_UART_STATE_READY;
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -4116,6 +4322,7 @@ static void UART_DMARxOnlyAbortCallback(DMA_HandleTypeDef *hdma)
   /* Restore huart->RxState to Ready */
   huart->RxState = HAL_UART_STATE_READY;
   huart->ReceptionType = HAL_UART_RECEPTION_STANDARD;
+  huart->pRxStream = NULL;
 
   /* Call user Abort complete callback */
 #if (USE_HAL_UART_REGISTER_CALLBACKS == 1)
@@ -4295,6 +4502,14 @@ static void UART_EndTransmit_IT(UART_HandleTypeDef *huart)
   /*Call legacy weak Tx complete callback*/
   HAL_UART_TxCpltCallback(huart);
 #endif /* USE_HAL_UART_REGISTER_CALLBACKS */
+
+#if defined(HAL_DMA_MODULE_ENABLED)
+  /* Start the buffers enqueued while the previous transmission was ending */
+  if (huart->pTxQueue != NULL)
+  {
+    (void)UART_TxQueueStart(huart);
+  }
+#endif /* HAL_DMA_MODULE_ENABLED */
 }
 
 /**
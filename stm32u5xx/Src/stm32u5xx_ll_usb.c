@@ -3202,6 +3202,8 @@ HAL_StatusTypeDef USB_DeActivateRemoteWakeup(USB_DRD_TypeDef *USBx)
 
 /**
   * @brief Copy a buffer from user memory area to packet memory area (PMA)
+  * @note   Word aligned user buffers are copied four words per loop iteration,
+  *         unaligned ones fall back to the byte-wise copy.
   * @param   USBx USB peripheral instance register address.
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
@@ -3218,6 +3220,7 @@ void USB_WritePMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMAB
   /* Due to the PMA access 32bit only so the last non word data should be processed alone */
   uint16_t remaining_bytes = wNBytes % 4U;
   uint8_t *pBuf = pbUsrBuf;
+  const uint32_t *pBuf32;
 
   /* Check if there is a remaining byte */
   if (remaining_bytes != 0U)
@@ -3229,15 +3232,42 @@ void USB_WritePMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMAB
   pdwVal = (__IO uint32_t *)(USB_DRD_PMAADDR + (uint32_t)wPMABufAddr);
 
   /* Write the Calculated Word into the PMA related Buffer */
-  for (count = NbWords; count != 0U; count--)
+  if (((uint32_t)pBuf & 0x3U) == 0U)
   {
-    *pdwVal = __UNALIGNED_UINT32_READ(pBuf);
-    pdwVal++;
-    /* Increment pBuf 4 Time as Word Increment */
-    pBuf++;
-    pBuf++;
-    pBuf++;
-    pBuf++;
+    /* Word aligned buffer: unrolled word copies */
+    pBuf32 = (const uint32_t *)(void *)pBuf;
+
+    for (count = NbWords >> 2U; count != 0U; count--)
+    {
+      pdwVal[0] = pBuf32[0];
+      pdwVal[1] = pBuf32[1];
+      pdwVal[2] = pBuf32[2];
+      pdwVal[3] = pBuf32[3];
+      pdwVal = &pdwVal[4];
+      pBuf32 = &pBuf32[4];
+    }
+
+    for (count = NbWords & 0x3U; count != 0U; count--)
+    {
+      *pdwVal = *pBuf32;
+      pdwVal++;
+      pBuf32++;
+    }
+
+    pBuf = (uint8_t *)(void *)pBuf32;
+  }
+  else
+  {
+    for (count = NbWords; count != 0U; count--)
+    {
+      *pdwVal = __UNALIGNED_UINT32_READ(pBuf);
+      pdwVal++;
+      /* Increment pBuf 4 Time as Word Increment */
+      pBuf++;
+      pBuf++;
+      pBuf++;
+      pBuf++;
+    }
   }
 
   /* When Number of data is not word aligned, write the remaining Byte */
@@ -3259,6 +3289,8 @@ void USB_WritePMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMAB
 
 /**
   * @brief Copy data from packet memory area (PMA) to user memory buffer
+  * @note   Word aligned user buffers are copied four words per loop iteration,
+  *         unaligned ones fall back to the byte-wise copy.
   * @param   USBx USB peripheral instance register address.
   * @param   pbUsrBuf pointer to user memory area.
   * @param   wPMABufAddr address into PMA.
@@ -3275,6 +3307,7 @@ void USB_ReadPMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABu
   /*Due to the PMA access 32bit only so the last non word data should be processed alone */
   uint16_t remaining_bytes = wNBytes % 4U;
   uint8_t *pBuf = pbUsrBuf;
+  uint32_t *pBuf32;
 
   /* Get the PMA Buffer pointer */
   pdwVal = (__IO uint32_t *)(USB_DRD_PMAADDR + (uint32_t)wPMABufAddr);
@@ -3286,15 +3319,42 @@ void USB_ReadPMA(USB_DRD_TypeDef const *USBx, uint8_t *pbUsrBuf, uint16_t wPMABu
   }
 
   /*Read the Calculated Word From the PMA related Buffer*/
-  for (count = NbWords; count != 0U; count--)
+  if (((uint32_t)pBuf & 0x3U) == 0U)
   {
-    __UNALIGNED_UINT32_WRITE(pBuf, *pdwVal);
+    /* Word aligned buffer: unrolled word copies */
+    pBuf32 = (uint32_t *)(void *)pBuf;
 
-    pdwVal++;
-    pBuf++;
-    pBuf++;
-    pBuf++;
-    pBuf++;
+    for (count = NbWords >> 2U; count != 0U; count--)
+    {
+      pBuf32[0] = pdwVal[0];
+      pBuf32[1] = pdwVal[1];
+      pBuf32[2] = pdwVal[2];
+      pBuf32[3] = pdwVal[3];
+      pdwVal = &pdwVal[4];
+      pBuf32 = &pBuf32[4];
+    }
+
+    for (count = NbWords & 0x3U; count != 0U; count--)
+    {
+      *pBuf32 = *pdwVal;
+      pdwVal++;
+      pBuf32++;
+    }
+
+    pBuf = (uint8_t *)(void *)pBuf32;
+  }
+  else
+  {
+    for (count = NbWords; count != 0U; count--)
+    {
+      __UNALIGNED_UINT32_WRITE(pBuf, *pdwVal);
+
+      pdwVal++;
+      pBuf++;
+      pBuf++;
+      pBuf++;
+      pBuf++;
+    }
   }
 
   /*When Number of data is not word aligned, read the remaining byte*/
@@ -160,6 +160,7 @@ extern "C" {
 #define  VDD_VALUE                          3300U                             /*!< Value of VDD in mv */
 #define  TICK_INT_PRIORITY                  ((1uL <<__NVIC_PRIO_BITS) - 1uL)  /*!< tick interrupt priority (lowest by default) */
 #define  USE_RTOS                           0U
+#define  USE_HAL_ATOMIC_LOCK                0U
 #define  PREFETCH_ENABLE                    0U
 #define  INSTRUCTION_CACHE_ENABLE           1U
 #define  DATA_CACHE_ENABLE                  1U